@@ -0,0 +1,459 @@
+#ifndef ASYNC_REDIS_H
+#define ASYNC_REDIS_H
+
+#include <hiredis/hiredis.h>
+#include <hiredis/async.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Commands to send back to back, kept in Redis's wire format so they can be
+// built on any thread and handed to a connection as they are.
+class RedisPipeline {
+public:
+    void add(int argc, const char* const* argv, const size_t* lengths) {
+        commands += '*';
+        commands += std::to_string(argc);
+        commands += "\r\n";
+        for (int i = 0; i < argc; ++i) {
+            commands += '$';
+            commands += std::to_string(lengths[i]);
+            commands += "\r\n";
+            commands.append(argv[i], lengths[i]);
+            commands += "\r\n";
+        }
+        ends.push_back(commands.size());
+    }
+
+    void add(std::initializer_list<std::string_view> args) {
+        std::vector<const char*> argv;
+        std::vector<size_t> lengths;
+        for (std::string_view arg : args) {
+            argv.push_back(arg.data());
+            lengths.push_back(arg.size());
+        }
+        add(static_cast<int>(argv.size()), argv.data(), lengths.data());
+    }
+
+    size_t size() const {
+        return ends.size();
+    }
+
+    bool empty() const {
+        return ends.empty();
+    }
+
+    std::string_view command(size_t i) const {
+        const size_t begin = i == 0 ? 0 : ends[i - 1];
+        return std::string_view(commands).substr(begin, ends[i] - begin);
+    }
+
+private:
+    std::string commands;
+    std::vector<size_t> ends;
+};
+
+// How a pipeline went. Unavailable: Redis could not be reached, or the
+// connection broke or timed out before every reply was in. Failed: a reply
+// handler threw, with its message.
+struct RedisResult {
+    enum class Code { Ok, Unavailable, Failed };
+
+    Code code = Code::Ok;
+    std::string message;
+
+    bool ok() const {
+        return code == Code::Ok;
+    }
+};
+
+// Called with each reply of a pipeline in order, while the reply is valid;
+// it throws to fail the pipeline. Replies after a failure are read but not
+// handed over.
+using RedisReplyHandler = std::function<void(size_t index, const redisReply& reply)>;
+using RedisDoneHandler = std::function<void(const RedisResult& result)>;
+
+// Runs pipeline on a blocking connection, for a caller with a thread of its
+// own to wait on. Every reply is read even after a failure, so none is left
+// behind to be taken for the answer to a later command.
+inline RedisResult runRedisPipeline(redisContext* context, const RedisPipeline& pipeline, const RedisReplyHandler& onReply) {
+    for (size_t i = 0; i < pipeline.size(); ++i) {
+        const std::string_view command = pipeline.command(i);
+        redisAppendFormattedCommand(context, command.data(), command.size());
+    }
+    RedisResult result;
+    for (size_t i = 0; i < pipeline.size(); ++i) {
+        void* reply = nullptr;
+        if (redisGetReply(context, &reply) != REDIS_OK || reply == nullptr) {
+            return {RedisResult::Code::Unavailable, std::string("Redis connection lost: ") + context->errstr};
+        }
+        if (result.ok()) {
+            try {
+                onReply(i, *static_cast<redisReply*>(reply));
+            } catch (const std::exception& e) {
+                result = {RedisResult::Code::Failed, e.what()};
+            }
+        }
+        freeReplyObject(reply);
+    }
+    return result;
+}
+
+// One non-blocking Redis connection driven by its own event-loop thread, so
+// any number of pipelines can be waiting for replies without a thread
+// waiting on each. send may be called from any thread; the pipeline goes out
+// on the loop, which hands each reply to its handler as it arrives and calls
+// done after the last. Handlers run on the loop thread and must not block.
+//
+// Replies come back in the order commands went out, so the oldest pipeline
+// in flight is always the next to finish. When it has waited longer than
+// timeout the connection is dropped: every pipeline in flight fails as
+// Unavailable and a new connection is opened. An idle connection is checked
+// with PING every healthCheck. While Redis is down, reconnects are tried at
+// most every retryDelay and pipelines sent meanwhile fail at once.
+class AsyncRedis {
+public:
+    AsyncRedis(std::string host, int port, std::chrono::milliseconds timeout, std::chrono::seconds healthCheck, size_t maxQueued)
+        : host(std::move(host)), port(port), timeout(timeout), healthCheck(healthCheck), maxQueued(maxQueued),
+          wakeFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+        if (wakeFd < 0) {
+            throw std::runtime_error("Failed to create an eventfd for the Redis event loop");
+        }
+        connect(Clock::now());
+        if (context == nullptr) {
+            ::close(wakeFd);
+            throw std::runtime_error("Failed to connect to Redis: " + lastError);
+        }
+        loop = std::thread([this]() { run(); });
+    }
+
+    ~AsyncRedis() {
+        stopping.store(true);
+        wake();
+        loop.join();
+        ::close(wakeFd);
+    }
+
+    AsyncRedis(const AsyncRedis&) = delete;
+    AsyncRedis& operator=(const AsyncRedis&) = delete;
+
+    // False, without sending anything or calling done, when maxQueued
+    // pipelines are already waiting; the caller should fail the request
+    // rather than wait.
+    bool send(RedisPipeline pipeline, RedisReplyHandler onReply, RedisDoneHandler done) {
+        if (pending.fetch_add(1) >= maxQueued) {
+            pending.fetch_sub(1);
+            return false;
+        }
+        auto* request = new Request(std::move(pipeline), std::move(onReply), std::move(done));
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            submitted.push_back(request);
+        }
+        wake();
+        return true;
+    }
+
+    // Pipelines sent and not yet done.
+    size_t outstanding() const {
+        return pending.load(std::memory_order_relaxed);
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::chrono::milliseconds retryDelay{250};
+
+    struct Request {
+        Request(RedisPipeline pipeline, RedisReplyHandler onReply, RedisDoneHandler done)
+            : pipeline(std::move(pipeline)), onReply(std::move(onReply)), done(std::move(done)) {}
+
+        RedisPipeline pipeline;
+        RedisReplyHandler onReply;
+        RedisDoneHandler done;
+        size_t expected = 0;
+        size_t received = 0;
+        RedisResult result;
+        Clock::time_point deadline;
+    };
+
+    void wake() {
+        const uint64_t one = 1;
+        [[maybe_unused]] ssize_t written = ::write(wakeFd, &one, sizeof(one));
+    }
+
+    void run() {
+        while (!stopping.load()) {
+            Clock::time_point now = Clock::now();
+            if (context == nullptr && now >= retryAt) {
+                connect(now);
+            }
+            dispatch(now);
+            if (context != nullptr && connected && inFlight.empty() && healthCheck.count() != 0 && now - lastActivity >= healthCheck) {
+                RedisPipeline ping;
+                ping.add({"PING"});
+                pending.fetch_add(1);
+                startRequest(new Request(std::move(ping), [](size_t, const redisReply&) {}, [](const RedisResult&) {}), now);
+            }
+
+            pollfd fds[2] = {{wakeFd, POLLIN, 0}, {-1, 0, 0}};
+            if (context != nullptr) {
+                fds[1].fd = context->c.fd;
+                fds[1].events = static_cast<short>((wantRead ? POLLIN : 0) | (wantWrite ? POLLOUT : 0));
+            }
+            ::poll(fds, 2, waitMilliseconds(now));
+
+            if (fds[0].revents & POLLIN) {
+                uint64_t count;
+                [[maybe_unused]] ssize_t read = ::read(wakeFd, &count, sizeof(count));
+            }
+            if (context != nullptr && (fds[1].revents & (POLLIN | POLLERR | POLLHUP))) {
+                redisAsyncHandleRead(context);
+            }
+            if (context != nullptr && (fds[1].revents & POLLOUT)) {
+                redisAsyncHandleWrite(context);
+            }
+            expire(Clock::now());
+        }
+        if (context != nullptr) {
+            lastError = "server shutting down";
+            redisAsyncFree(context);
+            context = nullptr;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        for (Request* request : submitted) {
+            request->result = {RedisResult::Code::Unavailable, "Redis is unavailable: server shutting down"};
+            finish(request);
+        }
+        submitted.clear();
+    }
+
+    // Until the oldest reply is due, the next reconnect or health check, or
+    // at most a second.
+    int waitMilliseconds(Clock::time_point now) const {
+        Clock::time_point until = now + std::chrono::seconds(1);
+        if (context == nullptr) {
+            until = std::min(until, retryAt);
+        } else if (!connected) {
+            until = std::min(until, connectDeadline);
+        }
+        if (!inFlight.empty()) {
+            until = std::min(until, inFlight.front()->deadline);
+        } else if (context != nullptr && connected && healthCheck.count() != 0) {
+            until = std::min(until, lastActivity + healthCheck);
+        }
+        auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(until - now).count() + 1;
+        return static_cast<int>(std::max<int64_t>(wait, 0));
+    }
+
+    void connect(Clock::time_point now) {
+        context = redisAsyncConnect(host.c_str(), port);
+        if (context == nullptr || context->err) {
+            lastError = context ? context->errstr : "out of memory";
+            if (context != nullptr) {
+                redisAsyncFree(context);
+                context = nullptr;
+            }
+            retryAt = now + retryDelay;
+            return;
+        }
+        context->data = this;
+        context->ev.data = this;
+        context->ev.addRead = [](void* loop) { static_cast<AsyncRedis*>(loop)->wantRead = true; };
+        context->ev.delRead = [](void* loop) { static_cast<AsyncRedis*>(loop)->wantRead = false; };
+        context->ev.addWrite = [](void* loop) { static_cast<AsyncRedis*>(loop)->wantWrite = true; };
+        context->ev.delWrite = [](void* loop) { static_cast<AsyncRedis*>(loop)->wantWrite = false; };
+        context->ev.cleanup = [](void* loop) {
+            static_cast<AsyncRedis*>(loop)->wantRead = false;
+            static_cast<AsyncRedis*>(loop)->wantWrite = false;
+        };
+        redisAsyncSetConnectCallback(context, onConnect);
+        redisAsyncSetDisconnectCallback(context, onDisconnect);
+        // The socket turns writable once the connect completes.
+        wantRead = false;
+        wantWrite = true;
+        connected = false;
+        connectDeadline = now + timeout;
+    }
+
+    static void onConnect(const redisAsyncContext* context, int status) {
+        auto* self = static_cast<AsyncRedis*>(context->data);
+        if (status != REDIS_OK) {
+            // hiredis frees the context once this returns.
+            self->lastError = context->errstr;
+            self->context = nullptr;
+            self->retryAt = Clock::now() + retryDelay;
+            self->reportDown();
+            return;
+        }
+        self->connected = true;
+        self->lastActivity = Clock::now();
+        if (self->down) {
+            std::cerr << "Reconnected to Redis" << std::endl;
+            self->down = false;
+        }
+    }
+
+    static void onDisconnect(const redisAsyncContext* context, int status) {
+        auto* self = static_cast<AsyncRedis*>(context->data);
+        if (status != REDIS_OK && context->errstr != nullptr) {
+            self->lastError = context->errstr;
+        }
+        self->context = nullptr;
+        self->connected = false;
+        self->retryAt = Clock::now();
+        self->reportDown();
+    }
+
+    void reportDown() {
+        if (!down && !stopping.load()) {
+            std::cerr << "Lost Redis connection: " << lastError << std::endl;
+            down = true;
+        }
+    }
+
+    // Sends what was submitted since the last turn of the loop, or fails it
+    // at once while there is no connection.
+    void dispatch(Clock::time_point now) {
+        std::vector<Request*> requests;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            requests.swap(submitted);
+        }
+        for (Request* request : requests) {
+            if (context == nullptr) {
+                request->result = {RedisResult::Code::Unavailable, "Redis is unavailable: " + lastError};
+                finish(request);
+                continue;
+            }
+            startRequest(request, now);
+        }
+    }
+
+    void startRequest(Request* request, Clock::time_point now) {
+        request->deadline = now + timeout;
+        request->expected = request->pipeline.size();
+        inFlight.push_back(request);
+        for (size_t i = 0; i < request->pipeline.size(); ++i) {
+            const std::string_view command = request->pipeline.command(i);
+            if (redisAsyncFormattedCommand(context, onReply, request, command.data(), command.size()) != REDIS_OK) {
+                // The context is going away; the commands already queued
+                // will still be answered, with no reply.
+                request->expected = i;
+                request->result = {RedisResult::Code::Unavailable, "Redis is unavailable: " + lastError};
+                if (i == 0) {
+                    complete(request);
+                }
+                return;
+            }
+        }
+    }
+
+    static void onReply(redisAsyncContext* context, void* reply, void* privdata) {
+        auto* self = static_cast<AsyncRedis*>(context->data);
+        if (reply == nullptr && context->err && context->errstr != nullptr) {
+            self->lastError = context->errstr;
+        }
+        self->received(static_cast<Request*>(privdata), static_cast<redisReply*>(reply));
+    }
+
+    void received(Request* request, redisReply* reply) {
+        const size_t index = request->received++;
+        if (reply == nullptr) {
+            if (request->result.ok()) {
+                request->result = {RedisResult::Code::Unavailable, "Redis connection lost: " + lastError};
+            }
+        } else {
+            lastActivity = Clock::now();
+            if (request->result.ok()) {
+                try {
+                    request->onReply(index, *reply);
+                } catch (const std::exception& e) {
+                    request->result = {RedisResult::Code::Failed, e.what()};
+                }
+            }
+        }
+        if (request->received == request->expected) {
+            complete(request);
+        }
+    }
+
+    void complete(Request* request) {
+        auto it = std::find(inFlight.begin(), inFlight.end(), request);
+        if (it != inFlight.end()) {
+            inFlight.erase(it);
+        }
+        finish(request);
+    }
+
+    void finish(Request* request) {
+        try {
+            request->done(request->result);
+        } catch (const std::exception& e) {
+            std::cerr << "Exception: " << e.what() << std::endl;
+        }
+        delete request;
+        pending.fetch_sub(1);
+    }
+
+    // Drops a connection whose oldest pipeline, or whose connect, is overdue.
+    void expire(Clock::time_point now) {
+        if (context == nullptr) {
+            return;
+        }
+        const bool connectOverdue = !connected && now >= connectDeadline;
+        const bool replyOverdue = !inFlight.empty() && now >= inFlight.front()->deadline;
+        if (!connectOverdue && !replyOverdue) {
+            return;
+        }
+        lastError = "no reply within " + std::to_string(timeout.count()) + " ms";
+        reportDown();
+        redisAsyncContext* overdue = context;
+        context = nullptr;
+        connected = false;
+        retryAt = now;
+        redisAsyncFree(overdue);
+    }
+
+    const std::string host;
+    const int port;
+    const std::chrono::milliseconds timeout;
+    const std::chrono::seconds healthCheck;
+    const size_t maxQueued;
+    const int wakeFd;
+
+    std::mutex mutex;
+    std::vector<Request*> submitted;
+    std::atomic<size_t> pending{0};
+    std::atomic<bool> stopping{false};
+
+    // Owned by the loop thread.
+    redisAsyncContext* context = nullptr;
+    bool wantRead = false;
+    bool wantWrite = false;
+    bool connected = false;
+    bool down = false;
+    std::string lastError;
+    std::deque<Request*> inFlight;
+    Clock::time_point connectDeadline;
+    Clock::time_point retryAt;
+    Clock::time_point lastActivity;
+    std::thread loop;
+};
+
+#endif // ASYNC_REDIS_H
@@ -0,0 +1,51 @@
+#ifndef BENCH_REPORT_H
+#define BENCH_REPORT_H
+
+#include <ctime>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <json/json.h>
+
+// Every result the benchmarks print, kept so --json=FILE can append them as
+// one JSON object per line. In the producer benchmarks each line is a tick,
+// so lines_per_s and ns_per_tick come from the same count; the server
+// benchmarks count requests.
+class BenchReport {
+public:
+    // The returned result can take extra fields until the next record call.
+    Json::Value& record(const std::string& benchmark, const std::string& variant, size_t lines, size_t bytes, double seconds) {
+        double safeSeconds = seconds > 0.0 ? seconds : 1e-9;
+        Json::Value result;
+        result["benchmark"] = benchmark;
+        result["variant"] = variant;
+        result["lines"] = Json::UInt64(lines);
+        result["bytes"] = Json::UInt64(bytes);
+        result["seconds"] = seconds;
+        result["lines_per_s"] = lines / safeSeconds;
+        result["ns_per_tick"] = lines > 0 ? seconds * 1e9 / lines : 0.0;
+        results.push_back(result);
+        return results.back();
+    }
+
+    void save(const std::string& path, const std::string& label) const {
+        std::ofstream out(path, std::ios::app);
+        if (!out.is_open()) {
+            throw std::runtime_error("Failed to open report: " + path);
+        }
+        Json::StreamWriterBuilder builder;
+        builder["indentation"] = "";
+        const Json::Int64 runTime = static_cast<Json::Int64>(std::time(nullptr));
+        for (Json::Value result : results) {
+            result["label"] = label;
+            result["time"] = runTime;
+            out << Json::writeString(builder, result) << "\n";
+        }
+    }
+
+private:
+    std::vector<Json::Value> results;
+};
+
+#endif // BENCH_REPORT_H
@@ -0,0 +1,222 @@
+#ifndef CANDLE_BUCKETS_H
+#define CANDLE_BUCKETS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ohlc_accumulator.h"
+#include "symbol_table.h"
+
+// One closed interval candle of one symbol; start is in nanoseconds since the
+// epoch and interval is the bucket length in nanoseconds.
+struct SealedCandle {
+    SymbolId symbol;
+    uint64_t interval;
+    uint64_t start;
+    OHLCAccumulator ohlc;
+};
+
+// Parses "1s,1m,5m,1h" (units ms, s, m, h) into nanoseconds.
+inline std::vector<uint64_t> parseIntervals(std::string_view text) {
+    std::vector<uint64_t> intervals;
+    while (!text.empty()) {
+        size_t comma = text.find(',');
+        std::string_view item = text.substr(0, comma);
+        text = comma == std::string_view::npos ? std::string_view() : text.substr(comma + 1);
+
+        size_t digits = 0;
+        while (digits < item.size() && item[digits] >= '0' && item[digits] <= '9') {
+            ++digits;
+        }
+        std::string_view unit = item.substr(digits);
+        uint64_t scale = unit == "ms" ? 1000000ULL
+                       : unit == "s"  ? 1000000000ULL
+                       : unit == "m"  ? 60000000000ULL
+                       : unit == "h"  ? 3600000000000ULL
+                       : 0;
+        if (digits == 0 || scale == 0) {
+            throw std::invalid_argument("Invalid interval: " + std::string(item));
+        }
+        uint64_t count = std::stoull(std::string(item.substr(0, digits)));
+        if (count == 0) {
+            throw std::invalid_argument("Invalid interval: " + std::string(item));
+        }
+        intervals.push_back(count * scale);
+    }
+    return intervals;
+}
+
+inline std::string formatInterval(uint64_t interval) {
+    if (interval % 3600000000000ULL == 0) return std::to_string(interval / 3600000000000ULL) + "h";
+    if (interval % 60000000000ULL == 0) return std::to_string(interval / 60000000000ULL) + "m";
+    if (interval % 1000000000ULL == 0) return std::to_string(interval / 1000000000ULL) + "s";
+    return std::to_string(interval / 1000000ULL) + "ms";
+}
+
+// Assigns ticks to fixed time buckets for several intervals at once. Every
+// (symbol, interval) pair has a ring of openBuckets consecutive buckets, so
+// ticks up to openBuckets - 1 buckets late are still counted. A bucket is
+// sealed and passed to the sink once a tick (or advanceTo) moves openBuckets
+// buckets past it; ticks for a bucket already sealed are dropped and counted
+// as late, so no bucket is passed on twice.
+//
+// Rings live in one flat vector that only grows when a new symbol shows up,
+// so opening and sealing buckets never allocates.
+class CandleBuckets {
+public:
+    explicit CandleBuckets(std::vector<uint64_t> intervals, size_t openBuckets = 2)
+        : intervals(std::move(intervals)), openBuckets(std::max<size_t>(openBuckets, 1)) {}
+
+    bool enabled() const {
+        return !intervals.empty();
+    }
+
+    const std::vector<uint64_t>& intervalList() const {
+        return intervals;
+    }
+
+    template <typename Sink>
+    void add(SymbolId symbol, uint64_t eventTime, double price, int quantity, Sink&& sink) {
+        if (symbol >= symbolCount) {
+            symbolCount = symbol + 1;
+            rings.resize(symbolCount * intervals.size());
+            slots.resize(symbolCount * intervals.size() * openBuckets);
+        }
+
+        for (size_t i = 0; i < intervals.size(); ++i) {
+            size_t ringIndex = symbol * intervals.size() + i;
+            Ring& ring = rings[ringIndex];
+            const uint64_t interval = intervals[i];
+
+            uint64_t number;
+            if (ring.open != 0 && eventTime >= ring.newestStart && eventTime - ring.newestStart < interval) {
+                number = ring.newest;
+            } else {
+                number = eventTime / interval;
+                if (number < ring.sealedBefore) {
+                    ++late;
+                    continue;
+                }
+                if (ring.open == 0 || number > ring.newest) {
+                    sealThrough(symbol, i, number >= openBuckets ? number - openBuckets : noBucket, sink);
+                    ring.newest = number;
+                    ring.newestStart = number * interval;
+                }
+            }
+
+            Slot& slot = slots[ringIndex * openBuckets + number % openBuckets];
+            if (slot.ohlc.ticks == 0) {
+                slot.number = number;
+                ++ring.open;
+            }
+            slot.ohlc.add(price, quantity);
+        }
+    }
+
+    // Seals, for every symbol, the buckets a tick at eventTime would push out
+    // of the ring; used to close buckets of quiet symbols as time moves on.
+    template <typename Sink>
+    void advanceTo(uint64_t eventTime, Sink&& sink) {
+        for (size_t i = 0; i < intervals.size(); ++i) {
+            uint64_t number = eventTime / intervals[i];
+            if (number < openBuckets) {
+                continue;
+            }
+            for (SymbolId symbol = 0; symbol < symbolCount; ++symbol) {
+                sealThrough(symbol, i, number - openBuckets, sink);
+            }
+        }
+    }
+
+    // Seals every open bucket.
+    template <typename Sink>
+    void flush(Sink&& sink) {
+        for (size_t i = 0; i < intervals.size(); ++i) {
+            for (SymbolId symbol = 0; symbol < symbolCount; ++symbol) {
+                sealThrough(symbol, i, rings[symbol * intervals.size() + i].newest, sink);
+            }
+        }
+    }
+
+    size_t lateTicks() const {
+        return late;
+    }
+
+    // Checkpoint support; load() expects the same intervals and ring size.
+    template <typename Writer>
+    void save(Writer& writer) const {
+        writer.putVector(intervals);
+        writer.put(static_cast<uint64_t>(openBuckets));
+        writer.put(static_cast<uint64_t>(symbolCount));
+        writer.putVector(rings);
+        writer.putVector(slots);
+        writer.put(static_cast<uint64_t>(late));
+    }
+
+    template <typename Reader>
+    void load(Reader& reader) {
+        if (reader.template getVector<uint64_t>() != intervals || reader.template get<uint64_t>() != openBuckets) {
+            throw std::runtime_error("Checkpoint was taken with different intervals or open buckets.");
+        }
+        symbolCount = reader.template get<uint64_t>();
+        rings = reader.template getVector<Ring>();
+        slots = reader.template getVector<Slot>();
+        late = reader.template get<uint64_t>();
+        if (rings.size() != symbolCount * intervals.size() || slots.size() != rings.size() * openBuckets) {
+            throw std::runtime_error("Checkpoint bucket state does not match its symbol count.");
+        }
+    }
+
+private:
+    static constexpr uint64_t noBucket = ~0ULL;
+
+    // Buckets numbered below sealedBefore are sealed, open or not.
+    struct Ring {
+        uint64_t newest = 0;
+        uint64_t newestStart = 0;
+        size_t open = 0;
+        uint64_t sealedBefore = 0;
+    };
+
+    struct Slot {
+        uint64_t number = 0;
+        OHLCAccumulator ohlc;
+    };
+
+    // Seals the ring's open buckets numbered <= last, oldest first, and
+    // marks the rest up to last sealed too.
+    template <typename Sink>
+    void sealThrough(SymbolId symbol, size_t intervalIndex, uint64_t last, Sink& sink) {
+        size_t ringIndex = symbol * intervals.size() + intervalIndex;
+        Ring& ring = rings[ringIndex];
+        if (last == noBucket) {
+            return;
+        }
+        ring.sealedBefore = std::max(ring.sealedBefore, last + 1);
+        if (ring.open == 0) {
+            return;
+        }
+
+        uint64_t oldest = ring.newest + 1 >= openBuckets ? ring.newest + 1 - openBuckets : 0;
+        for (uint64_t number = oldest; number <= std::min(last, ring.newest) && ring.open != 0; ++number) {
+            Slot& slot = slots[ringIndex * openBuckets + number % openBuckets];
+            if (slot.ohlc.ticks != 0 && slot.number == number) {
+                sink(SealedCandle{symbol, intervals[intervalIndex], number * intervals[intervalIndex], slot.ohlc});
+                slot.ohlc = OHLCAccumulator{};
+                --ring.open;
+            }
+        }
+    }
+
+    std::vector<uint64_t> intervals;
+    size_t openBuckets;
+    size_t symbolCount = 0;
+    std::vector<Ring> rings;
+    std::vector<Slot> slots;
+    size_t late = 0;
+};
+
+#endif // CANDLE_BUCKETS_H
@@ -0,0 +1,224 @@
+#ifndef CANDLE_CACHE_H
+#define CANDLE_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "ohlc.pb.h"
+
+// The latest candle of every symbol the server has stored or read, so
+// GetOHLC can be answered without a Redis round trip. Readers take no lock
+// and never hold up a writer:
+//
+// - Symbols are found in an open-addressing table of entry pointers. A new
+//   symbol is added under a mutex, filled in before its pointer is
+//   published, and never removed. When the table gets half full a twice as
+//   large copy replaces it; the old one is kept, not freed, so a reader
+//   still probing it stays safe and at worst misses the newest symbols. The
+//   old tables together are never larger than the current one.
+// - Each entry's candle sits behind a seqlock: a writer makes the version
+//   odd, stores the fields and makes it even again, and a reader copies the
+//   fields and retries if the version was odd or moved meanwhile. Writers of
+//   the same symbol take turns on the version; readers only retry.
+class CandleCache {
+public:
+    CandleCache() {
+        grow(64);
+    }
+
+    CandleCache(const CandleCache&) = delete;
+    CandleCache& operator=(const CandleCache&) = delete;
+
+    // Copies the cached candle of symbol into candle; false when there is
+    // none.
+    bool get(const std::string& symbol, ohlc::OHLC& candle) const {
+        const Entry* entry = find(*current.load(std::memory_order_acquire), symbol);
+        if (entry == nullptr) {
+            return false;
+        }
+        uint64_t words[wordCount];
+        entry->read(words);
+        candle.set_stock_code(entry->symbol);
+        candle.set_open(toDouble(words[0]));
+        candle.set_high(toDouble(words[1]));
+        candle.set_low(toDouble(words[2]));
+        candle.set_close(toDouble(words[3]));
+        candle.set_volume(toDouble(words[4]));
+        candle.set_value(toDouble(words[5]));
+        candle.set_sequence(words[sequenceWord]);
+        return true;
+    }
+
+    // Write-through: candle was just stored and is now the symbol's latest.
+    // A numbered candle older than the cached one is ignored, so a save that
+    // completes late cannot set the cache back; sequence 1 starts over, as
+    // a restarted producer numbers from 1 again.
+    void put(const ohlc::OHLC& candle) {
+        uint64_t words[wordCount];
+        toWords(candle, words);
+        if (Entry* entry = find(*current.load(std::memory_order_acquire), candle.stock_code())) {
+            entry->write(words);
+            return;
+        }
+        insert(candle.stock_code(), words, true);
+    }
+
+    // Read-through: candle was read from Redis, where a newer one may have
+    // been stored since, so it is only cached if the symbol is not yet.
+    void putIfAbsent(const ohlc::OHLC& candle) {
+        if (find(*current.load(std::memory_order_acquire), candle.stock_code()) != nullptr) {
+            return;
+        }
+        uint64_t words[wordCount];
+        toWords(candle, words);
+        insert(candle.stock_code(), words, false);
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(insertMutex);
+        return entries.size();
+    }
+
+private:
+    // open, high, low, close, volume, value and sequence, as raw bits.
+    static constexpr int wordCount = 7;
+    static constexpr int sequenceWord = 6;
+
+    struct Entry {
+        explicit Entry(const std::string& symbol) : symbol(symbol) {}
+
+        void read(uint64_t* out) const {
+            while (true) {
+                const uint64_t before = version.load(std::memory_order_acquire);
+                if ((before & 1) == 0) {
+                    for (int i = 0; i < wordCount; ++i) {
+                        out[i] = words[i].load(std::memory_order_relaxed);
+                    }
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (version.load(std::memory_order_relaxed) == before) {
+                        return;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        void write(const uint64_t* in) {
+            uint64_t before = version.load(std::memory_order_relaxed);
+            while ((before & 1) != 0 || !version.compare_exchange_weak(before, before + 1, std::memory_order_acquire)) {
+                if ((before & 1) != 0) {
+                    std::this_thread::yield();
+                    before = version.load(std::memory_order_relaxed);
+                }
+            }
+            const uint64_t sequence = in[sequenceWord];
+            if (sequence > 1 && sequence < words[sequenceWord].load(std::memory_order_relaxed)) {
+                version.store(before, std::memory_order_release);
+                return;
+            }
+            std::atomic_thread_fence(std::memory_order_release);
+            for (int i = 0; i < wordCount; ++i) {
+                words[i].store(in[i], std::memory_order_relaxed);
+            }
+            version.store(before + 2, std::memory_order_release);
+        }
+
+        const std::string symbol;
+        std::atomic<uint64_t> version{0};
+        std::atomic<uint64_t> words[wordCount] = {};
+    };
+
+    struct Table {
+        explicit Table(size_t capacity) : mask(capacity - 1), buckets(new std::atomic<Entry*>[capacity]) {
+            for (size_t i = 0; i < capacity; ++i) {
+                buckets[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        const size_t mask;
+        std::unique_ptr<std::atomic<Entry*>[]> buckets;
+    };
+
+    static double toDouble(uint64_t bits) {
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    static uint64_t toBits(double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static void toWords(const ohlc::OHLC& candle, uint64_t* words) {
+        words[0] = toBits(candle.open());
+        words[1] = toBits(candle.high());
+        words[2] = toBits(candle.low());
+        words[3] = toBits(candle.close());
+        words[4] = toBits(candle.volume());
+        words[5] = toBits(candle.value());
+        words[sequenceWord] = candle.sequence();
+    }
+
+    static size_t hashOf(std::string_view symbol) {
+        return std::hash<std::string_view>()(symbol);
+    }
+
+    static Entry* find(const Table& table, std::string_view symbol) {
+        for (size_t i = hashOf(symbol);; ++i) {
+            Entry* entry = table.buckets[i & table.mask].load(std::memory_order_acquire);
+            if (entry == nullptr || entry->symbol == symbol) {
+                return entry;
+            }
+        }
+    }
+
+    static void place(Table& table, Entry* entry) {
+        size_t i = hashOf(entry->symbol);
+        while (table.buckets[i & table.mask].load(std::memory_order_relaxed) != nullptr) {
+            ++i;
+        }
+        table.buckets[i & table.mask].store(entry, std::memory_order_release);
+    }
+
+    // Called with insertMutex held, or from the constructor.
+    void grow(size_t capacity) {
+        tables.push_back(std::make_unique<Table>(capacity));
+        for (Entry& entry : entries) {
+            place(*tables.back(), &entry);
+        }
+        current.store(tables.back().get(), std::memory_order_release);
+    }
+
+    void insert(const std::string& symbol, const uint64_t* words, bool replace) {
+        std::lock_guard<std::mutex> lock(insertMutex);
+        if (Entry* entry = find(*current.load(std::memory_order_relaxed), symbol)) {
+            if (replace) {
+                entry->write(words);
+            }
+            return;
+        }
+        if ((entries.size() + 1) * 2 > current.load(std::memory_order_relaxed)->mask + 1) {
+            grow(2 * (current.load(std::memory_order_relaxed)->mask + 1));
+        }
+        Entry& entry = entries.emplace_back(symbol);
+        entry.write(words);
+        place(*current.load(std::memory_order_relaxed), &entry);
+    }
+
+    std::atomic<Table*> current{nullptr};
+    mutable std::mutex insertMutex;
+    std::deque<Entry> entries;
+    std::vector<std::unique_ptr<Table>> tables;
+};
+
+#endif // CANDLE_CACHE_H
@@ -0,0 +1,95 @@
+#ifndef CANDLE_STORE_H
+#define CANDLE_STORE_H
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// How a store operation went. Unavailable: the store cannot be reached right
+// now; Busy: too many operations are already waiting on it. Callers may
+// retry both. Failed: anything else, with a message for the log.
+struct StoreResult {
+    enum class Code { Ok, Unavailable, Busy, Failed };
+
+    Code code = Code::Ok;
+    std::string message;
+
+    bool ok() const {
+        return code == Code::Ok;
+    }
+};
+
+// A running candle's stored value, kept under its stock code.
+struct LatestWrite {
+    std::string_view stockCode;
+    std::string_view value;
+};
+
+// A closed interval candle's stored value, kept in its symbol's history at
+// that interval under its start in milliseconds.
+struct HistoryWrite {
+    std::string_view stockCode;
+    uint64_t interval;
+    uint64_t startMilliseconds;
+    std::string_view value;
+};
+
+// Up to limit values from one symbol's history at one interval, with starts
+// from fromMilliseconds up to but not including toMilliseconds.
+struct HistoryQuery {
+    static constexpr uint64_t unbounded = UINT64_MAX;
+
+    std::string_view stockCode;
+    uint64_t interval;
+    uint64_t fromMilliseconds;
+    uint64_t toMilliseconds;
+    uint32_t limit;
+};
+
+// Called with each value a read finds, while the value is valid; it throws
+// to fail the read.
+using StoredValueHandler = std::function<void(size_t index, std::string_view value)>;
+using StoreDone = std::function<void(const StoreResult& result)>;
+
+// Where the server keeps candles, as the values of stored_candle.h. Each
+// operation calls done exactly once, on the calling thread or one of the
+// store's own; neither done nor onValue may block. The views an operation
+// is given need only last until it returns.
+class CandleStore {
+public:
+    virtual ~CandleStore() = default;
+
+    // For the startup line, such as "Redis at localhost:6379".
+    virtual std::string describe() const = 0;
+
+    // Keeps latest in order, so a symbol written twice ends up with its
+    // later value, and each history value in place of any with the same
+    // start. Nothing is kept unless done reports Ok. Writes are applied,
+    // and their done called, in the order write was called.
+    virtual void write(const std::vector<LatestWrite>& latest, const std::vector<HistoryWrite>& history, StoreDone done) = 0;
+
+    // onValue with the index in stockCodes of each symbol that has a value,
+    // in index order.
+    virtual void readLatest(const std::vector<std::string_view>& stockCodes, StoredValueHandler onValue, StoreDone done) = 0;
+
+    // onValue with each value of the range in start order, numbered from 0.
+    virtual void readHistory(const HistoryQuery& query, StoredValueHandler onValue, StoreDone done) = 0;
+
+    // Hands every latest value to onValue before returning; for startup.
+    // Throws when the store cannot be read.
+    virtual void scanLatest(const std::function<void(std::string_view stockCode, std::string_view value)>& onValue) = 0;
+};
+
+// write for a caller with a thread of its own to wait on.
+inline StoreResult writeAndWait(CandleStore& store, const std::vector<LatestWrite>& latest, const std::vector<HistoryWrite>& history) {
+    auto result = std::make_shared<std::promise<StoreResult>>();
+    std::future<StoreResult> written = result->get_future();
+    store.write(latest, history, [result](const StoreResult& outcome) { result->set_value(outcome); });
+    return written.get();
+}
+
+#endif // CANDLE_STORE_H
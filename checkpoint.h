@@ -0,0 +1,246 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include "candle_buckets.h"
+#include "mapped_file.h"
+#include "ohlc_accumulator.h"
+#include "symbol_table.h"
+#include "tick_parser.h"
+
+// Binary checkpoint: "OHLCCKPT", a version, the payload written by the caller
+// and a trailing FNV-1a checksum of everything before it. Values are stored
+// in host byte order, so a checkpoint is only meant to be read back on the
+// machine that wrote it.
+constexpr char checkpointMagic[8] = {'O', 'H', 'L', 'C', 'C', 'K', 'P', 'T'};
+constexpr uint32_t checkpointVersion = 4;
+
+inline uint64_t checkpointChecksum(std::string_view bytes) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char c : bytes) {
+        hash = (hash ^ c) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+class CheckpointWriter {
+public:
+    CheckpointWriter() {
+        buffer.append(checkpointMagic, sizeof(checkpointMagic));
+        put(checkpointVersion);
+    }
+
+    template <typename T>
+    void put(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "checkpoint values must be trivially copyable");
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void putString(std::string_view text) {
+        put(static_cast<uint32_t>(text.size()));
+        buffer.append(text.data(), text.size());
+    }
+
+    template <typename T>
+    void putVector(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>, "checkpoint values must be trivially copyable");
+        put(static_cast<uint64_t>(values.size()));
+        buffer.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    // Writes to path + ".tmp", forces it to the disk and renames it over
+    // path, then forces the rename too, so neither a crash nor a power loss
+    // while saving leaves anything but the previous or the new checkpoint.
+    void save(const std::string& path) {
+        put(checkpointChecksum(buffer));
+
+        const std::string tempPath = path + ".tmp";
+        int fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to create checkpoint: " + tempPath);
+        }
+        size_t written = 0;
+        while (written < buffer.size()) {
+            ssize_t n = ::write(fd, buffer.data() + written, buffer.size() - written);
+            if (n <= 0) {
+                ::close(fd);
+                throw std::runtime_error("Failed to write checkpoint: " + tempPath);
+            }
+            written += static_cast<size_t>(n);
+        }
+        if (::fsync(fd) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Failed to write checkpoint: " + tempPath);
+        }
+        ::close(fd);
+
+        if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+            throw std::runtime_error("Failed to replace checkpoint: " + path);
+        }
+        const size_t slash = path.rfind('/');
+        const std::string folder = slash == std::string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+        int folderFd = ::open(folder.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (folderFd < 0 || ::fsync(folderFd) != 0) {
+            if (folderFd >= 0) {
+                ::close(folderFd);
+            }
+            throw std::runtime_error("Failed to replace checkpoint: " + path);
+        }
+        ::close(folderFd);
+    }
+
+    size_t size() const {
+        return buffer.size();
+    }
+
+private:
+    std::string buffer;
+};
+
+// Reads a checkpoint in place from a memory mapping of the file.
+class CheckpointReader {
+public:
+    explicit CheckpointReader(const std::string& path) : file(path) {
+        std::string_view bytes = file.view();
+        if (bytes.size() < sizeof(checkpointMagic) + sizeof(uint32_t) + sizeof(uint64_t) ||
+            std::memcmp(bytes.data(), checkpointMagic, sizeof(checkpointMagic)) != 0) {
+            throw std::runtime_error("Not a checkpoint: " + path);
+        }
+
+        uint64_t expected;
+        std::memcpy(&expected, bytes.data() + bytes.size() - sizeof(expected), sizeof(expected));
+        payload = bytes.substr(0, bytes.size() - sizeof(expected));
+        if (checkpointChecksum(payload) != expected) {
+            throw std::runtime_error("Corrupt checkpoint: " + path);
+        }
+
+        payload.remove_prefix(sizeof(checkpointMagic));
+        if (get<uint32_t>() != checkpointVersion) {
+            throw std::runtime_error("Unsupported checkpoint version: " + path);
+        }
+    }
+
+    template <typename T>
+    T get() {
+        T value;
+        std::memcpy(&value, take(sizeof(T)).data(), sizeof(T));
+        return value;
+    }
+
+    std::string_view getString() {
+        return take(get<uint32_t>());
+    }
+
+    template <typename T>
+    std::vector<T> getVector() {
+        uint64_t count = get<uint64_t>();
+        if (count > payload.size() / sizeof(T)) {
+            throw std::runtime_error("Truncated checkpoint.");
+        }
+        std::vector<T> values(count);
+        std::memcpy(values.data(), take(count * sizeof(T)).data(), count * sizeof(T));
+        return values;
+    }
+
+    size_t size() const {
+        return file.size();
+    }
+
+private:
+    std::string_view take(size_t bytes) {
+        if (bytes > payload.size()) {
+            throw std::runtime_error("Truncated checkpoint.");
+        }
+        std::string_view taken = payload.substr(0, bytes);
+        payload.remove_prefix(bytes);
+        return taken;
+    }
+
+    MappedFile file;
+    std::string_view payload;
+};
+
+// Symbols are written in id order, so ids are the same after loading.
+template <typename T>
+void saveSymbolMap(CheckpointWriter& writer, const SymbolMap<T>& map) {
+    writer.put(static_cast<uint32_t>(map.size()));
+    for (SymbolId id = 0; id < map.size(); ++id) {
+        writer.putString(map.name(id));
+        writer.put(map[id]);
+    }
+}
+
+template <typename T>
+void loadSymbolMap(CheckpointReader& reader, SymbolMap<T>& map) {
+    uint32_t count = reader.get<uint32_t>();
+    for (uint32_t i = 0; i < count; ++i) {
+        std::string_view name = reader.getString();
+        map[name] = reader.get<T>();
+    }
+}
+
+// How far the producer has read one data file, and the nanosecond time in
+// its name.
+struct FilePosition {
+    uint64_t timestamp = 0;
+    uint64_t offset = 0;
+};
+
+// The producer's checkpoint payload: lines, skipped line counts, the
+// position in every file read so far, the running candles in id order, the
+// bucket rings and the sealed candles. Everything is a flat copy of the
+// in-memory state, so resuming costs time proportional to the checkpoint
+// rather than to the data read. Returns the checkpoint's size in bytes.
+inline size_t saveProducerCheckpoint(const std::string& path, uint64_t lines, const ParseErrorCounts& errors,
+                                     const std::map<std::string, FilePosition>& files, const SymbolMap<OHLCAccumulator>& candles,
+                                     const CandleBuckets& buckets, const std::vector<SealedCandle>& sealed) {
+    CheckpointWriter writer;
+    writer.put(lines);
+    writer.put(errors);
+    writer.put(static_cast<uint64_t>(files.size()));
+    for (const auto& [filePath, file] : files) {
+        writer.putString(filePath);
+        writer.put(file.timestamp);
+        writer.put(file.offset);
+    }
+    saveSymbolMap(writer, candles);
+    buckets.save(writer);
+    writer.putVector(sealed);
+    size_t bytes = writer.size();
+    writer.save(path);
+    return bytes;
+}
+
+// Reads back what saveProducerCheckpoint wrote into empty state; buckets
+// must have the intervals the checkpoint was taken with. Throws when the
+// checkpoint cannot be read, leaving the state partly filled. Returns the
+// checkpoint's size in bytes.
+inline size_t loadProducerCheckpoint(const std::string& path, uint64_t& lines, ParseErrorCounts& errors,
+                                     std::map<std::string, FilePosition>& files, SymbolMap<OHLCAccumulator>& candles,
+                                     CandleBuckets& buckets, std::vector<SealedCandle>& sealed) {
+    CheckpointReader reader(path);
+    lines = reader.get<uint64_t>();
+    errors = reader.get<ParseErrorCounts>();
+    uint64_t fileCount = reader.get<uint64_t>();
+    for (uint64_t i = 0; i < fileCount; ++i) {
+        FilePosition& file = files[std::string(reader.getString())];
+        file.timestamp = reader.get<uint64_t>();
+        file.offset = reader.get<uint64_t>();
+    }
+    loadSymbolMap(reader, candles);
+    buckets.load(reader);
+    sealed = reader.getVector<SealedCandle>();
+    return reader.size();
+}
+
+#endif // CHECKPOINT_H
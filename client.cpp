@@ -1,7 +1,11 @@
 #include <grpc++/grpc++.h>
 #include "ohlc.grpc.pb.h"
+#include "candle_buckets.h"
+#include <cstdint>
 #include <iostream>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 template <typename ExceptionType>
 class ExceptionHandler {
@@ -25,7 +29,7 @@ struct OHLCData {
     double high;
     double low;
     double close;
-    int volume;
+    int64_t volume;
     double value;
     std::string stockCode;
 };
@@ -57,6 +61,87 @@ public:
         return response;
     }
 
+    // All of stockCodes in one GetOHLCBatch call.
+    ohlc::OHLCBatch getOHLCBatch(const std::vector<std::string>& stockCodes) {
+        ohlc::StockBatchRequest request;
+        for (const std::string& stockCode : stockCodes) {
+            request.add_stock_codes(stockCode);
+        }
+
+        ohlc::OHLCBatch response;
+        grpc::ClientContext context;
+
+        ExceptionHandler<OHLCWithGrpcException>::Handle([&]() {
+            grpc::Status status = stub_->GetOHLCBatch(&context, request, &response);
+
+            if (!status.ok()) {
+                throw OHLCWithGrpcException("Error getting OHLC data for " + std::to_string(stockCodes.size()) + " stocks. Error: " + status.error_message());
+            }
+
+            std::cout << "Received OHLC data for " << response.candles_size() << " of " << stockCodes.size() << " stocks" << std::endl;
+        }, "Error communicating with gRPC server.");
+
+        return response;
+    }
+
+    // Prints every candle the server pushes for stockCodes, or for every
+    // symbol when it is empty, until the server ends the stream.
+    void subscribeOHLCData(const std::vector<std::string>& stockCodes) {
+        ohlc::SubscribeRequest request;
+        for (const std::string& stockCode : stockCodes) {
+            request.add_stock_codes(stockCode);
+        }
+
+        grpc::ClientContext context;
+
+        ExceptionHandler<OHLCWithGrpcException>::Handle([&]() {
+            std::unique_ptr<grpc::ClientReader<ohlc::OHLC>> reader = stub_->SubscribeOHLC(&context, request);
+
+            ohlc::OHLC ohlcData;
+            while (reader->Read(&ohlcData)) {
+                displayOHLCData(ohlcData);
+            }
+
+            grpc::Status status = reader->Finish();
+            if (!status.ok()) {
+                throw OHLCWithGrpcException("Subscription ended. Error: " + status.error_message());
+            }
+        }, "Error communicating with gRPC server.");
+    }
+
+    // Prints the candles of stockCode at interval whose start is in
+    // [from, to), nanoseconds since the epoch, oldest first, as the server
+    // streams them page by page.
+    void getOHLCRange(const std::string& stockCode, uint64_t interval, uint64_t from, uint64_t to) {
+        ohlc::OHLCRangeRequest request;
+        request.set_stock_code(stockCode);
+        request.set_interval(interval);
+        request.set_from_time(from);
+        request.set_to_time(to);
+
+        grpc::ClientContext context;
+
+        ExceptionHandler<OHLCWithGrpcException>::Handle([&]() {
+            std::unique_ptr<grpc::ClientReader<ohlc::OHLCPage>> reader = stub_->GetOHLCRange(&context, request);
+
+            ohlc::OHLCPage page;
+            size_t candles = 0;
+            while (reader->Read(&page)) {
+                for (const ohlc::OHLC& ohlcData : page.candles()) {
+                    displayOHLCData(ohlcData);
+                }
+                candles += page.candles_size();
+            }
+
+            grpc::Status status = reader->Finish();
+            if (!status.ok()) {
+                throw OHLCWithGrpcException("Error getting OHLC range for stock: " + stockCode + ". Error: " + status.error_message());
+            }
+
+            std::cout << "Received " << candles << " " << formatInterval(interval) << " candles for stock: " << stockCode << std::endl;
+        }, "Error communicating with gRPC server.");
+    }
+
     void displayOHLCData(const ohlc::OHLC& ohlcData) {
         // Add your code to display the OHLC data as needed
         std::cout << "OHLC Data:\n"
@@ -67,6 +152,9 @@ public:
                   << "  Close: " << ohlcData.close() << "\n"
                   << "  Volume: " << ohlcData.volume() << "\n"
                   << "  Value: " << ohlcData.value() << std::endl;
+        if (ohlcData.interval() != 0) {
+            std::cout << "  Start: " << ohlcData.start_time() << " (" << formatInterval(ohlcData.interval()) << ")" << std::endl;
+        }
     }
 
 private:
@@ -75,13 +163,10 @@ private:
 
 int main(int argc, char** argv) {
     ExceptionHandler<OHLCWithGrpcException>::Handle([&]() {
-        if (argc != 2) {
-            throw std::invalid_argument("Usage: " + std::string(argv[0]) + " <stock_code>");
+        if (argc < 2) {
+            throw std::invalid_argument("Usage: " + std::string(argv[0]) + " <stock_code> [stock_code ...] | --subscribe [stock_code ...] | --range <stock_code> <interval> [from_ns] [to_ns]");
         }
 
-        // Extract stock code from command-line arguments
-        std::string stockCode = argv[1];
-
         // Create a gRPC channel to communicate with the server
         std::shared_ptr<grpc::Channel> channel = grpc::CreateChannel("localhost:50051", grpc::InsecureChannelCredentials());
 
@@ -92,6 +177,40 @@ int main(int argc, char** argv) {
 
         OHLCClient client(channel);
 
+        // Follow live candles for the listed stock codes, or every symbol
+        if (std::string(argv[1]) == "--subscribe") {
+            client.subscribeOHLCData(std::vector<std::string>(argv + 2, argv + argc));
+            return;
+        }
+
+        // History of one stock code at one interval, e.g. --range BBCA 1m
+        if (std::string(argv[1]) == "--range") {
+            if (argc < 4 || argc > 6) {
+                throw std::invalid_argument("Usage: " + std::string(argv[0]) + " --range <stock_code> <interval> [from_ns] [to_ns]");
+            }
+            std::vector<uint64_t> intervals = parseIntervals(argv[3]);
+            if (intervals.size() != 1) {
+                throw std::invalid_argument("--range takes one interval, not " + std::string(argv[3]));
+            }
+            client.getOHLCRange(argv[2], intervals[0], argc > 4 ? std::stoull(argv[4]) : 0, argc > 5 ? std::stoull(argv[5]) : 0);
+            return;
+        }
+
+        // Several stock codes are fetched together in one batch call
+        if (argc > 2) {
+            ohlc::OHLCBatch batch = client.getOHLCBatch(std::vector<std::string>(argv + 1, argv + argc));
+            for (const ohlc::OHLC& ohlcData : batch.candles()) {
+                client.displayOHLCData(ohlcData);
+            }
+            for (const std::string& stockCode : batch.missing_codes()) {
+                std::cout << "No OHLC data for stock: " << stockCode << std::endl;
+            }
+            return;
+        }
+
+        // Extract stock code from command-line arguments
+        std::string stockCode = argv[1];
+
         // Get OHLC data for the provided stock code
         ohlc::OHLC ohlcData = client.getOHLCData(stockCode);
 
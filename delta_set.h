@@ -0,0 +1,87 @@
+#ifndef DELTA_SET_H
+#define DELTA_SET_H
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "symbol_table.h"
+
+// When a continuously running producer sends the symbols that changed.
+// With neither threshold set it sends after every batch of reads; otherwise
+// once maxTicks ticks have arrived since the last flush or maxDelay has
+// passed since it, whichever comes first.
+struct FlushPolicy {
+    size_t maxTicks = 0;
+    std::chrono::milliseconds maxDelay{0};
+
+    bool due(size_t ticks, std::chrono::steady_clock::duration sinceFlush) const {
+        if (maxTicks == 0 && maxDelay.count() == 0) {
+            return true;
+        }
+        return (maxTicks != 0 && ticks >= maxTicks) || (maxDelay.count() != 0 && sinceFlush >= maxDelay);
+    }
+};
+
+// The symbols whose candle changed since the last flush, and the sequence
+// number of each symbol's latest delta. A symbol is listed once however
+// many ticks it took, in the order it first changed, so a flush costs one
+// candle per active symbol and nothing for quiet ones. Sequence numbers
+// start at 1 and go up by one per flushed delta of that symbol, which lets
+// the receiver tell a lost delta from a repeated one.
+class DeltaSet {
+public:
+    void touch(SymbolId id) {
+        ++tickCount;
+        markDirty(id);
+    }
+
+    // Lists id for the next flush without counting a tick, e.g. to resend it.
+    void markDirty(SymbolId id) {
+        if (id >= isDirty.size()) {
+            isDirty.resize(id + 1, false);
+        }
+        if (!isDirty[id]) {
+            isDirty[id] = true;
+            dirty.push_back(id);
+        }
+    }
+
+    bool empty() const {
+        return dirty.empty();
+    }
+
+    // Ticks since the last flush.
+    size_t ticks() const {
+        return tickCount;
+    }
+
+    // Numbers every dirty symbol's next delta and returns their ids, leaving
+    // the set empty.
+    std::vector<SymbolId> flush() {
+        std::vector<SymbolId> flushed;
+        flushed.swap(dirty);
+        for (SymbolId id : flushed) {
+            isDirty[id] = false;
+            if (id >= sequenceNumbers.size()) {
+                sequenceNumbers.resize(id + 1, 0);
+            }
+            ++sequenceNumbers[id];
+        }
+        tickCount = 0;
+        return flushed;
+    }
+
+    // Sequence number of the latest flushed delta of each id, 0 for ids never
+    // flushed; indexed by SymbolId.
+    const std::vector<uint64_t>& sequences() const {
+        return sequenceNumbers;
+    }
+
+private:
+    std::vector<SymbolId> dirty;
+    std::vector<bool> isDirty;
+    std::vector<uint64_t> sequenceNumbers;
+    size_t tickCount = 0;
+};
+
+#endif // DELTA_SET_H
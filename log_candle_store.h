@@ -0,0 +1,530 @@
+#ifndef LOG_CANDLE_STORE_H
+#define LOG_CANDLE_STORE_H
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "candle_store.h"
+
+// Candles kept in the server's own process: an append-only log file, mapped
+// into memory, and an in-memory index of where each symbol's latest value and
+// history values sit in it. Writes are copied into a queue of up to maxQueued
+// and return; the store's writer thread appends them in order and calls
+// their done. Reads look values up in the index and hand them over straight
+// from the mapping, with no copy and no system call, on the calling thread.
+//
+// The file is an 8 byte header, "OHLCLOG1", then records:
+//
+//   u32    length n of what follows the checksum
+//   u32    FNV-1a hash of those n bytes
+//   u8     kind: latestRecord or historyRecord
+//   u8     length of the stock code, then the stock code
+//   u64    interval and start in milliseconds, history records only
+//   bytes  value, to the end of the record
+//
+// Integers are little-endian. The file grows in growthStep steps and is
+// zero past the last record; a record cut short or damaged by a crash ends
+// the log when it is reopened, and is cut off. The whole of maxLogSize is
+// mapped up front, so the mapping only moves when the log is compacted, and
+// reads hand out values under the lock that compaction waits for. The file
+// only grows by blocks the disk has room for, so a full disk fails a write
+// instead of faulting the process on its first store to the new pages.
+//
+// Records left behind by newer ones are dropped by rewriting the file, on
+// open and by the writer thread after the write that tips them over, once
+// they take up more space than the live ones and than growthStep. Reads go
+// on during the copy, and only the swap to the new file holds them up;
+// writes queue behind it. Each copy is paid for by at least as many bytes
+// written since the last, so the file stays within about twice its live
+// records. Written
+// records reach the disk when the kernel flushes them: a crash of the
+// server loses nothing, a crash of the machine may lose the last writes.
+class LogCandleStore final : public CandleStore {
+public:
+    static constexpr uint64_t maxLogSize = 1ull << 38;
+    static constexpr uint64_t growthStep = 64ull << 20;
+
+    LogCandleStore(std::string path, size_t maxQueued) : path(std::move(path)), maxQueued(std::max<size_t>(maxQueued, 1)) {
+        open();
+        compactIfDue();
+        writer = std::thread([this]() { run(); });
+    }
+
+    // Writes still queued are applied first.
+    ~LogCandleStore() override {
+        if (writer.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                stopping = true;
+            }
+            wake.notify_one();
+            writer.join();
+        }
+        close();
+    }
+
+    LogCandleStore(const LogCandleStore&) = delete;
+    LogCandleStore& operator=(const LogCandleStore&) = delete;
+
+    std::string describe() const override {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return "candle log " + path + " (" + std::to_string(latest.size()) + " symbols, " + std::to_string(end >> 10) + " KiB)";
+    }
+
+    void write(const std::vector<LatestWrite>& latestWrites, const std::vector<HistoryWrite>& historyWrites, StoreDone done) override {
+        size_t size = 0;
+        for (const LatestWrite& candle : latestWrites) {
+            size += candle.stockCode.size() + candle.value.size();
+        }
+        for (const HistoryWrite& candle : historyWrites) {
+            size += candle.stockCode.size() + candle.value.size();
+        }
+        QueuedWrite queued;
+        queued.bytes = std::make_unique<char[]>(size);
+        char* cursor = queued.bytes.get();
+        auto own = [&cursor](std::string_view text) {
+            std::memcpy(cursor, text.data(), text.size());
+            cursor += text.size();
+            return std::string_view(cursor - text.size(), text.size());
+        };
+        queued.latest.reserve(latestWrites.size());
+        for (const LatestWrite& candle : latestWrites) {
+            queued.latest.push_back({own(candle.stockCode), own(candle.value)});
+        }
+        queued.history.reserve(historyWrites.size());
+        for (const HistoryWrite& candle : historyWrites) {
+            queued.history.push_back({own(candle.stockCode), candle.interval, candle.startMilliseconds, own(candle.value)});
+        }
+        queued.done = std::move(done);
+
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            if (queue.size() < maxQueued) {
+                queue.push_back(std::move(queued));
+                wake.notify_one();
+                return;
+            }
+        }
+        queued.done(StoreResult{StoreResult::Code::Busy, "Candle log queue is full"});
+    }
+
+    void readLatest(const std::vector<std::string_view>& stockCodes, StoredValueHandler onValue, StoreDone done) override {
+        StoreResult result;
+        try {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            std::string stockCode;
+            for (size_t i = 0; i < stockCodes.size(); ++i) {
+                stockCode.assign(stockCodes[i]);
+                auto found = latest.find(stockCode);
+                if (found != latest.end()) {
+                    onValue(i, valueAt(found->second));
+                }
+            }
+        } catch (const std::exception& e) {
+            result = {StoreResult::Code::Failed, e.what()};
+        }
+        done(result);
+    }
+
+    void readHistory(const HistoryQuery& query, StoredValueHandler onValue, StoreDone done) override {
+        StoreResult result;
+        try {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            auto series = history.find({std::string(query.stockCode), query.interval});
+            if (series != history.end()) {
+                size_t count = 0;
+                for (auto it = series->second.lower_bound(query.fromMilliseconds);
+                     it != series->second.end() && it->first < query.toMilliseconds && count < query.limit; ++it) {
+                    onValue(count++, valueAt(it->second));
+                }
+            }
+        } catch (const std::exception& e) {
+            result = {StoreResult::Code::Failed, e.what()};
+        }
+        done(result);
+    }
+
+    void scanLatest(const std::function<void(std::string_view stockCode, std::string_view value)>& onValue) override {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        for (const auto& [stockCode, location] : latest) {
+            onValue(stockCode, valueAt(location));
+        }
+    }
+
+private:
+    static constexpr char magic[8] = {'O', 'H', 'L', 'C', 'L', 'O', 'G', '1'};
+    static constexpr uint64_t headerSize = sizeof(magic);
+    static constexpr uint8_t latestRecord = 1;
+    static constexpr uint8_t historyRecord = 2;
+    // Length and checksum.
+    static constexpr uint64_t recordPrefix = 8;
+
+    // A write waiting for the writer thread, its views pointing into bytes.
+    struct QueuedWrite {
+        std::unique_ptr<char[]> bytes;
+        std::vector<LatestWrite> latest;
+        std::vector<HistoryWrite> history;
+        StoreDone done;
+    };
+
+    // Where a value is in the mapping, and the size of the record around it.
+    struct Location {
+        uint64_t offset = 0;
+        uint32_t size = 0;
+        uint32_t recordSize = 0;
+    };
+
+    static uint32_t fnv1a(const char* data, size_t size) {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ static_cast<uint8_t>(data[i])) * 16777619u;
+        }
+        return hash;
+    }
+
+    static void putU32(char* out, uint32_t value) {
+        for (int i = 0; i < 4; ++i) {
+            out[i] = static_cast<char>(value >> (8 * i));
+        }
+    }
+
+    static void putU64(char* out, uint64_t value) {
+        for (int i = 0; i < 8; ++i) {
+            out[i] = static_cast<char>(value >> (8 * i));
+        }
+    }
+
+    static uint32_t getU32(const char* in) {
+        uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) {
+            value |= static_cast<uint32_t>(static_cast<uint8_t>(in[i])) << (8 * i);
+        }
+        return value;
+    }
+
+    static uint64_t getU64(const char* in) {
+        uint64_t value = 0;
+        for (int i = 0; i < 8; ++i) {
+            value |= static_cast<uint64_t>(static_cast<uint8_t>(in[i])) << (8 * i);
+        }
+        return value;
+    }
+
+    static uint64_t recordSize(uint8_t kind, std::string_view stockCode, std::string_view value) {
+        if (stockCode.size() > 255) {
+            throw std::invalid_argument("Stock code too long to store: " + std::string(stockCode.substr(0, 32)) + "...");
+        }
+        return recordPrefix + 2 + stockCode.size() + (kind == historyRecord ? 16 : 0) + value.size();
+    }
+
+    std::string_view valueAt(const Location& location) const {
+        return std::string_view(base + location.offset, location.size);
+    }
+
+    // Points slot at a newer record; the one it pointed at is dead.
+    void keep(Location& slot, const Location& location) {
+        if (slot.recordSize != 0) {
+            deadBytes += slot.recordSize;
+            liveBytes -= slot.recordSize;
+        }
+        slot = location;
+        liveBytes += location.recordSize;
+    }
+
+    void open() {
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to open candle log " + path + ": " + std::strerror(errno));
+        }
+        if (::flock(fd, LOCK_EX | LOCK_NB) != 0) {
+            throw std::runtime_error("Candle log " + path + " is in use by another process");
+        }
+        struct stat status;
+        if (::fstat(fd, &status) != 0) {
+            throw std::runtime_error("Failed to read candle log " + path + ": " + std::strerror(errno));
+        }
+        capacity = static_cast<uint64_t>(status.st_size);
+        if (capacity > maxLogSize) {
+            throw std::runtime_error("Candle log " + path + " is larger than " + std::to_string(maxLogSize >> 30) + " GiB");
+        }
+        void* mapping = ::mmap(nullptr, maxLogSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_NORESERVE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error("Failed to map candle log " + path + ": " + std::strerror(errno));
+        }
+        base = static_cast<char*>(mapping);
+        if (capacity == 0) {
+            reserve(headerSize);
+            std::memcpy(base, magic, headerSize);
+            end = headerSize;
+            return;
+        }
+        if (capacity < headerSize || std::memcmp(base, magic, headerSize) != 0) {
+            throw std::runtime_error(path + " is not a candle log");
+        }
+        replay();
+    }
+
+    void close() {
+        if (base != nullptr) {
+            ::msync(base, end, MS_SYNC);
+            ::munmap(base, maxLogSize);
+            base = nullptr;
+        }
+        if (fd >= 0) {
+            [[maybe_unused]] int truncated = ::ftruncate(fd, static_cast<off_t>(end));
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+    // Indexes every whole record. The first one cut short or failing its
+    // checksum, and anything after it, is left to be overwritten.
+    void replay() {
+        uint64_t offset = headerSize;
+        while (capacity - offset >= recordPrefix) {
+            const uint32_t length = getU32(base + offset);
+            if (length < 2 || length > capacity - offset - recordPrefix) {
+                break;
+            }
+            const char* body = base + offset + recordPrefix;
+            if (fnv1a(body, length) != getU32(base + offset + 4)) {
+                break;
+            }
+            const uint8_t kind = static_cast<uint8_t>(body[0]);
+            const size_t codeLength = static_cast<uint8_t>(body[1]);
+            const uint64_t fixed = 2 + codeLength + (kind == historyRecord ? 16 : 0);
+            if ((kind != latestRecord && kind != historyRecord) || fixed > length) {
+                break;
+            }
+            std::string stockCode(body + 2, codeLength);
+            Location location{offset + recordPrefix + fixed, static_cast<uint32_t>(length - fixed), static_cast<uint32_t>(recordPrefix + length)};
+            if (kind == latestRecord) {
+                keep(latest[stockCode], location);
+            } else {
+                const uint64_t interval = getU64(body + 2 + codeLength);
+                const uint64_t start = getU64(body + 10 + codeLength);
+                keep(history[{std::move(stockCode), interval}][start], location);
+            }
+            offset += recordPrefix + length;
+        }
+        end = offset;
+        bool torn = false;
+        for (uint64_t i = end; i < capacity && i < end + recordPrefix; ++i) {
+            torn = torn || base[i] != 0;
+        }
+        if (torn) {
+            // Cut the file back so that what is left of the record reads as
+            // zeros, then grow it again.
+            std::cerr << "Candle log " << path << ": dropped a damaged record at offset " << end << std::endl;
+            if (::ftruncate(fd, static_cast<off_t>(end)) != 0) {
+                throw std::runtime_error("Failed to truncate candle log " + path + ": " + std::strerror(errno));
+            }
+            capacity = end;
+        }
+    }
+
+    // Grows the file, a growthStep at a time, until size bytes fit.
+    void reserve(uint64_t size) {
+        if (size <= capacity) {
+            return;
+        }
+        if (size > maxLogSize) {
+            throw std::runtime_error("Candle log " + path + " is full");
+        }
+        const uint64_t grown = std::min(maxLogSize, (size + growthStep - 1) / growthStep * growthStep);
+        const int error = ::posix_fallocate(fd, static_cast<off_t>(capacity), static_cast<off_t>(grown - capacity));
+        if (error != 0) {
+            throw std::runtime_error("Failed to grow candle log " + path + ": " + std::strerror(error));
+        }
+        capacity = grown;
+    }
+
+    // Called with the lock held and room reserved.
+    Location append(uint8_t kind, std::string_view stockCode, uint64_t interval, uint64_t start, std::string_view value) {
+        const uint64_t size = recordSize(kind, stockCode, value);
+        char* record = base + end;
+        char* body = record + recordPrefix;
+        char* cursor = body;
+        *cursor++ = static_cast<char>(kind);
+        *cursor++ = static_cast<char>(stockCode.size());
+        std::memcpy(cursor, stockCode.data(), stockCode.size());
+        cursor += stockCode.size();
+        if (kind == historyRecord) {
+            putU64(cursor, interval);
+            putU64(cursor + 8, start);
+            cursor += 16;
+        }
+        std::memcpy(cursor, value.data(), value.size());
+        const uint32_t length = static_cast<uint32_t>(size - recordPrefix);
+        putU32(record + 4, fnv1a(body, length));
+        putU32(record, length);
+        Location location{static_cast<uint64_t>(cursor - base), static_cast<uint32_t>(value.size()), static_cast<uint32_t>(size)};
+        end += size;
+        return location;
+    }
+
+    // The writer thread. It is the only one that changes the log, so it
+    // reads the index without the lock and only takes it to change it.
+    void run() {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        while (true) {
+            wake.wait(lock, [this]() { return stopping || !queue.empty(); });
+            if (queue.empty()) {
+                return;
+            }
+            QueuedWrite queued = std::move(queue.front());
+            queue.pop_front();
+            lock.unlock();
+            StoreResult result;
+            try {
+                apply(queued.latest, queued.history);
+            } catch (const std::exception& e) {
+                result = {StoreResult::Code::Failed, e.what()};
+            }
+            queued.done(result);
+            compactIfDue();
+            lock.lock();
+        }
+    }
+
+    // Appends the records of one write, all or, when they do not fit, none.
+    void apply(const std::vector<LatestWrite>& latestWrites, const std::vector<HistoryWrite>& historyWrites) {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        uint64_t needed = 0;
+        for (const LatestWrite& candle : latestWrites) {
+            needed += recordSize(latestRecord, candle.stockCode, candle.value);
+        }
+        for (const HistoryWrite& candle : historyWrites) {
+            needed += recordSize(historyRecord, candle.stockCode, candle.value);
+        }
+        reserve(end + needed);
+        for (const LatestWrite& candle : latestWrites) {
+            Location location = append(latestRecord, candle.stockCode, 0, 0, candle.value);
+            keep(latest[std::string(candle.stockCode)], location);
+        }
+        for (const HistoryWrite& candle : historyWrites) {
+            Location location = append(historyRecord, candle.stockCode, candle.interval, candle.startMilliseconds, candle.value);
+            keep(history[{std::string(candle.stockCode), candle.interval}][candle.startMilliseconds], location);
+        }
+    }
+
+    // Compacts once dead records outweigh the live ones and growthStep. A
+    // failed compaction is logged and not tried again until the dead
+    // records have doubled; the log stays as it was.
+    void compactIfDue() {
+        if (deadBytes <= liveBytes || deadBytes <= compactAfter) {
+            return;
+        }
+        try {
+            compact();
+            compactAfter = growthStep;
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            compactAfter = deadBytes * 2;
+        }
+    }
+
+    // Writes the live records to a new file, puts it in place of the log and
+    // carries on with it. Called from the writer thread or the constructor;
+    // readers are only shut out while the files are swapped.
+    void compact() {
+        const std::string compacted = path + ".compact";
+        const uint64_t before = end;
+        try {
+            LogCandleStore copy(compacted, Fresh{});
+            std::vector<LatestWrite> latestWrites;
+            for (const auto& [stockCode, location] : latest) {
+                latestWrites.push_back({stockCode, valueAt(location)});
+            }
+            std::vector<HistoryWrite> historyWrites;
+            for (const auto& [series, values] : history) {
+                for (const auto& [start, location] : values) {
+                    historyWrites.push_back({series.first, series.second, start, valueAt(location)});
+                }
+            }
+            copy.apply(latestWrites, historyWrites);
+            copy.flush();
+            if (std::rename(compacted.c_str(), path.c_str()) != 0) {
+                throw std::runtime_error(std::strerror(errno));
+            }
+            std::unique_lock<std::shared_mutex> lock(mutex);
+            std::swap(fd, copy.fd);
+            std::swap(base, copy.base);
+            std::swap(capacity, copy.capacity);
+            std::swap(end, copy.end);
+            std::swap(liveBytes, copy.liveBytes);
+            std::swap(deadBytes, copy.deadBytes);
+            latest.swap(copy.latest);
+            history.swap(copy.history);
+            copy.discard();
+        } catch (const std::exception& e) {
+            ::unlink(compacted.c_str());
+            throw std::runtime_error("Failed to compact candle log " + path + ": " + e.what());
+        }
+        std::cout << "Compacted candle log " << path << " from " << (before >> 10) << " to " << (end >> 10) << " KiB" << std::endl;
+    }
+
+    // Forces the records written so far to the disk.
+    void flush() {
+        ::msync(base, end, MS_SYNC);
+        ::fsync(fd);
+    }
+
+    // Lets go of a log that has been replaced, without writing it back.
+    void discard() {
+        ::munmap(base, maxLogSize);
+        base = nullptr;
+        ::close(fd);
+        fd = -1;
+    }
+
+    struct Fresh {};
+
+    // An empty log at path, replacing any file there, with no writer thread.
+    LogCandleStore(std::string path, Fresh) : path(std::move(path)), maxQueued(1) {
+        ::unlink(this->path.c_str());
+        open();
+    }
+
+    const std::string path;
+    int fd = -1;
+    char* base = nullptr;
+    uint64_t capacity = 0;
+    uint64_t end = 0;
+    uint64_t liveBytes = 0;
+    uint64_t deadBytes = 0;
+    uint64_t compactAfter = growthStep;
+
+    mutable std::shared_mutex mutex;
+    std::unordered_map<std::string, Location> latest;
+    std::map<std::pair<std::string, uint64_t>, std::map<uint64_t, Location>> history;
+
+    const size_t maxQueued;
+    std::mutex queueMutex;
+    std::condition_variable wake;
+    std::deque<QueuedWrite> queue;
+    bool stopping = false;
+    std::thread writer;
+};
+
+#endif // LOG_CANDLE_STORE_H
@@ -0,0 +1,121 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Read-only memory mapping of a whole file. Lines are handed out as
+// string_views into the mapping, so nothing is copied or allocated per line.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& filePath) {
+        int fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to open file: " + filePath);
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Failed to stat file: " + filePath);
+        }
+
+        length = static_cast<size_t>(st.st_size);
+        if (length > 0) {
+            void* mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Failed to map file: " + filePath);
+            }
+            ::madvise(mapping, length, MADV_SEQUENTIAL);
+            bytes = static_cast<const char*>(mapping);
+        }
+        ::close(fd);
+    }
+
+    ~MappedFile() {
+        if (bytes != nullptr) {
+            ::munmap(const_cast<char*>(bytes), length);
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : bytes(std::exchange(other.bytes, nullptr)), length(std::exchange(other.length, 0)) {}
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        std::swap(bytes, other.bytes);
+        std::swap(length, other.length);
+        return *this;
+    }
+
+    const char* data() const {
+        return bytes;
+    }
+
+    size_t size() const {
+        return length;
+    }
+
+    std::string_view view() const {
+        return {bytes, length};
+    }
+
+    // Calls func(std::string_view) for every line, without the trailing '\n'.
+    // A final line without a newline is still delivered; empty lines are not.
+    template <typename Func>
+    size_t forEachLine(Func func) const {
+        return forEachLine(view(), func);
+    }
+
+    template <typename Func>
+    static size_t forEachLine(std::string_view text, Func func) {
+        size_t lines = 0;
+        const char* cursor = text.data();
+        const char* end = cursor + text.size();
+
+        while (cursor < end) {
+            const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+            const char* lineEnd = newline ? newline : end;
+
+            if (lineEnd > cursor) {
+                func(std::string_view(cursor, lineEnd - cursor));
+                ++lines;
+            }
+            cursor = lineEnd + 1;
+        }
+        return lines;
+    }
+
+    // Narrows text to the lines that start in [begin, end), so adjacent byte
+    // ranges of one file see every line exactly once.
+    static std::string_view linesStartingIn(std::string_view text, size_t begin, size_t end) {
+        auto lineStartAtOrAfter = [&](size_t offset) {
+            if (offset == 0 || offset >= text.size()) {
+                return std::min(offset, text.size());
+            }
+            size_t newline = text.find('\n', offset - 1);
+            return newline == std::string_view::npos ? text.size() : newline + 1;
+        };
+
+        size_t first = lineStartAtOrAfter(begin);
+        size_t last = lineStartAtOrAfter(end);
+        return text.substr(first, last > first ? last - first : 0);
+    }
+
+private:
+    const char* bytes = nullptr;
+    size_t length = 0;
+};
+
+#endif // MAPPED_FILE_H
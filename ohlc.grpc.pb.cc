@@ -15,7 +15,7 @@
 #include <grpcpp/support/method_handler.h>
 #include <grpcpp/impl/rpc_service_method.h>
 #include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
 #include <grpcpp/server_context.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/support/sync_stream.h>
@@ -24,6 +24,12 @@ namespace ohlc {
 static const char* OHLCConsumerService_method_names[] = {
   "/ohlc.OHLCConsumerService/SendOHLC",
   "/ohlc.OHLCConsumerService/GetOHLC",
+  "/ohlc.OHLCConsumerService/GetOHLCBatch",
+  "/ohlc.OHLCConsumerService/SendOHLCStream",
+  "/ohlc.OHLCConsumerService/SendOHLCFixedStream",
+  "/ohlc.OHLCConsumerService/SendOHLCColumns",
+  "/ohlc.OHLCConsumerService/GetOHLCRange",
+  "/ohlc.OHLCConsumerService/SubscribeOHLC",
 };
 
 std::unique_ptr< OHLCConsumerService::Stub> OHLCConsumerService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -35,6 +41,12 @@ std::unique_ptr< OHLCConsumerService::Stub> OHLCConsumerService::NewStub(const s
 OHLCConsumerService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_SendOHLC_(OHLCConsumerService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetOHLC_(OHLCConsumerService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetOHLCBatch_(OHLCConsumerService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SendOHLCStream_(OHLCConsumerService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::CLIENT_STREAMING, channel)
+  , rpcmethod_SendOHLCFixedStream_(OHLCConsumerService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::CLIENT_STREAMING, channel)
+  , rpcmethod_SendOHLCColumns_(OHLCConsumerService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::CLIENT_STREAMING, channel)
+  , rpcmethod_GetOHLCRange_(OHLCConsumerService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_SubscribeOHLC_(OHLCConsumerService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
   {}
 
 ::grpc::Status OHLCConsumerService::Stub::SendOHLC(::grpc::ClientContext* context, const ::ohlc::OHLC& request, ::ohlc::SendOHLCResponse* response) {
@@ -83,6 +95,109 @@ void OHLCConsumerService::Stub::async::GetOHLC(::grpc::ClientContext* context, c
   return result;
 }
 
+::grpc::Status OHLCConsumerService::Stub::GetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::ohlc::OHLCBatch* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::ohlc::StockBatchRequest, ::ohlc::OHLCBatch, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetOHLCBatch_, context, request, response);
+}
+
+void OHLCConsumerService::Stub::async::GetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest* request, ::ohlc::OHLCBatch* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::ohlc::StockBatchRequest, ::ohlc::OHLCBatch, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetOHLCBatch_, context, request, response, std::move(f));
+}
+
+void OHLCConsumerService::Stub::async::GetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest* request, ::ohlc::OHLCBatch* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetOHLCBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::ohlc::OHLCBatch>* OHLCConsumerService::Stub::PrepareAsyncGetOHLCBatchRaw(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::ohlc::OHLCBatch, ::ohlc::StockBatchRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetOHLCBatch_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::ohlc::OHLCBatch>* OHLCConsumerService::Stub::AsyncGetOHLCBatchRaw(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetOHLCBatchRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientWriter< ::ohlc::OHLC>* OHLCConsumerService::Stub::SendOHLCStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) {
+  return ::grpc::internal::ClientWriterFactory< ::ohlc::OHLC>::Create(channel_.get(), rpcmethod_SendOHLCStream_, context, response);
+}
+
+void OHLCConsumerService::Stub::async::SendOHLCStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::ClientWriteReactor< ::ohlc::OHLC>* reactor) {
+  ::grpc::internal::ClientCallbackWriterFactory< ::ohlc::OHLC>::Create(stub_->channel_.get(), stub_->rpcmethod_SendOHLCStream_, context, response, reactor);
+}
+
+::grpc::ClientAsyncWriter< ::ohlc::OHLC>* OHLCConsumerService::Stub::AsyncSendOHLCStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::ohlc::OHLC>::Create(channel_.get(), cq, rpcmethod_SendOHLCStream_, context, response, true, tag);
+}
+
+::grpc::ClientAsyncWriter< ::ohlc::OHLC>* OHLCConsumerService::Stub::PrepareAsyncSendOHLCStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::ohlc::OHLC>::Create(channel_.get(), cq, rpcmethod_SendOHLCStream_, context, response, false, nullptr);
+}
+
+::grpc::ClientWriter< ::ohlc::OHLCFixed>* OHLCConsumerService::Stub::SendOHLCFixedStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) {
+  return ::grpc::internal::ClientWriterFactory< ::ohlc::OHLCFixed>::Create(channel_.get(), rpcmethod_SendOHLCFixedStream_, context, response);
+}
+
+void OHLCConsumerService::Stub::async::SendOHLCFixedStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::ClientWriteReactor< ::ohlc::OHLCFixed>* reactor) {
+  ::grpc::internal::ClientCallbackWriterFactory< ::ohlc::OHLCFixed>::Create(stub_->channel_.get(), stub_->rpcmethod_SendOHLCFixedStream_, context, response, reactor);
+}
+
+::grpc::ClientAsyncWriter< ::ohlc::OHLCFixed>* OHLCConsumerService::Stub::AsyncSendOHLCFixedStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::ohlc::OHLCFixed>::Create(channel_.get(), cq, rpcmethod_SendOHLCFixedStream_, context, response, true, tag);
+}
+
+::grpc::ClientAsyncWriter< ::ohlc::OHLCFixed>* OHLCConsumerService::Stub::PrepareAsyncSendOHLCFixedStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::ohlc::OHLCFixed>::Create(channel_.get(), cq, rpcmethod_SendOHLCFixedStream_, context, response, false, nullptr);
+}
+
+::grpc::ClientWriter< ::ohlc::OHLCColumns>* OHLCConsumerService::Stub::SendOHLCColumnsRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) {
+  return ::grpc::internal::ClientWriterFactory< ::ohlc::OHLCColumns>::Create(channel_.get(), rpcmethod_SendOHLCColumns_, context, response);
+}
+
+void OHLCConsumerService::Stub::async::SendOHLCColumns(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::ClientWriteReactor< ::ohlc::OHLCColumns>* reactor) {
+  ::grpc::internal::ClientCallbackWriterFactory< ::ohlc::OHLCColumns>::Create(stub_->channel_.get(), stub_->rpcmethod_SendOHLCColumns_, context, response, reactor);
+}
+
+::grpc::ClientAsyncWriter< ::ohlc::OHLCColumns>* OHLCConsumerService::Stub::AsyncSendOHLCColumnsRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::ohlc::OHLCColumns>::Create(channel_.get(), cq, rpcmethod_SendOHLCColumns_, context, response, true, tag);
+}
+
+::grpc::ClientAsyncWriter< ::ohlc::OHLCColumns>* OHLCConsumerService::Stub::PrepareAsyncSendOHLCColumnsRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::ohlc::OHLCColumns>::Create(channel_.get(), cq, rpcmethod_SendOHLCColumns_, context, response, false, nullptr);
+}
+
+::grpc::ClientReader< ::ohlc::OHLCPage>* OHLCConsumerService::Stub::GetOHLCRangeRaw(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::ohlc::OHLCPage>::Create(channel_.get(), rpcmethod_GetOHLCRange_, context, request);
+}
+
+void OHLCConsumerService::Stub::async::GetOHLCRange(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest* request, ::grpc::ClientReadReactor< ::ohlc::OHLCPage>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::ohlc::OHLCPage>::Create(stub_->channel_.get(), stub_->rpcmethod_GetOHLCRange_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::ohlc::OHLCPage>* OHLCConsumerService::Stub::AsyncGetOHLCRangeRaw(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::ohlc::OHLCPage>::Create(channel_.get(), cq, rpcmethod_GetOHLCRange_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::ohlc::OHLCPage>* OHLCConsumerService::Stub::PrepareAsyncGetOHLCRangeRaw(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::ohlc::OHLCPage>::Create(channel_.get(), cq, rpcmethod_GetOHLCRange_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::ohlc::OHLC>* OHLCConsumerService::Stub::SubscribeOHLCRaw(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::ohlc::OHLC>::Create(channel_.get(), rpcmethod_SubscribeOHLC_, context, request);
+}
+
+void OHLCConsumerService::Stub::async::SubscribeOHLC(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest* request, ::grpc::ClientReadReactor< ::ohlc::OHLC>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::ohlc::OHLC>::Create(stub_->channel_.get(), stub_->rpcmethod_SubscribeOHLC_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::ohlc::OHLC>* OHLCConsumerService::Stub::AsyncSubscribeOHLCRaw(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::ohlc::OHLC>::Create(channel_.get(), cq, rpcmethod_SubscribeOHLC_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::ohlc::OHLC>* OHLCConsumerService::Stub::PrepareAsyncSubscribeOHLCRaw(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::ohlc::OHLC>::Create(channel_.get(), cq, rpcmethod_SubscribeOHLC_, context, request, false, nullptr);
+}
+
 OHLCConsumerService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       OHLCConsumerService_method_names[0],
@@ -104,6 +219,66 @@ OHLCConsumerService::Service::Service() {
              ::ohlc::OHLC* resp) {
                return service->GetOHLC(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      OHLCConsumerService_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< OHLCConsumerService::Service, ::ohlc::StockBatchRequest, ::ohlc::OHLCBatch, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](OHLCConsumerService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::ohlc::StockBatchRequest* req,
+             ::ohlc::OHLCBatch* resp) {
+               return service->GetOHLCBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      OHLCConsumerService_method_names[3],
+      ::grpc::internal::RpcMethod::CLIENT_STREAMING,
+      new ::grpc::internal::ClientStreamingHandler< OHLCConsumerService::Service, ::ohlc::OHLC, ::ohlc::SendOHLCResponse>(
+          [](OHLCConsumerService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReader<::ohlc::OHLC>* reader,
+             ::ohlc::SendOHLCResponse* resp) {
+               return service->SendOHLCStream(ctx, reader, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      OHLCConsumerService_method_names[4],
+      ::grpc::internal::RpcMethod::CLIENT_STREAMING,
+      new ::grpc::internal::ClientStreamingHandler< OHLCConsumerService::Service, ::ohlc::OHLCFixed, ::ohlc::SendOHLCResponse>(
+          [](OHLCConsumerService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReader<::ohlc::OHLCFixed>* reader,
+             ::ohlc::SendOHLCResponse* resp) {
+               return service->SendOHLCFixedStream(ctx, reader, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      OHLCConsumerService_method_names[5],
+      ::grpc::internal::RpcMethod::CLIENT_STREAMING,
+      new ::grpc::internal::ClientStreamingHandler< OHLCConsumerService::Service, ::ohlc::OHLCColumns, ::ohlc::SendOHLCResponse>(
+          [](OHLCConsumerService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReader<::ohlc::OHLCColumns>* reader,
+             ::ohlc::SendOHLCResponse* resp) {
+               return service->SendOHLCColumns(ctx, reader, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      OHLCConsumerService_method_names[6],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< OHLCConsumerService::Service, ::ohlc::OHLCRangeRequest, ::ohlc::OHLCPage>(
+          [](OHLCConsumerService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::ohlc::OHLCRangeRequest* req,
+             ::grpc::ServerWriter<::ohlc::OHLCPage>* writer) {
+               return service->GetOHLCRange(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      OHLCConsumerService_method_names[7],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< OHLCConsumerService::Service, ::ohlc::SubscribeRequest, ::ohlc::OHLC>(
+          [](OHLCConsumerService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::ohlc::SubscribeRequest* req,
+             ::grpc::ServerWriter<::ohlc::OHLC>* writer) {
+               return service->SubscribeOHLC(ctx, req, writer);
+             }, this)));
 }
 
 OHLCConsumerService::Service::~Service() {
@@ -123,6 +298,48 @@ OHLCConsumerService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status OHLCConsumerService::Service::GetOHLCBatch(::grpc::ServerContext* context, const ::ohlc::StockBatchRequest* request, ::ohlc::OHLCBatch* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status OHLCConsumerService::Service::SendOHLCStream(::grpc::ServerContext* context, ::grpc::ServerReader< ::ohlc::OHLC>* reader, ::ohlc::SendOHLCResponse* response) {
+  (void) context;
+  (void) reader;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status OHLCConsumerService::Service::SendOHLCFixedStream(::grpc::ServerContext* context, ::grpc::ServerReader< ::ohlc::OHLCFixed>* reader, ::ohlc::SendOHLCResponse* response) {
+  (void) context;
+  (void) reader;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status OHLCConsumerService::Service::SendOHLCColumns(::grpc::ServerContext* context, ::grpc::ServerReader< ::ohlc::OHLCColumns>* reader, ::ohlc::SendOHLCResponse* response) {
+  (void) context;
+  (void) reader;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status OHLCConsumerService::Service::GetOHLCRange(::grpc::ServerContext* context, const ::ohlc::OHLCRangeRequest* request, ::grpc::ServerWriter< ::ohlc::OHLCPage>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status OHLCConsumerService::Service::SubscribeOHLC(::grpc::ServerContext* context, const ::ohlc::SubscribeRequest* request, ::grpc::ServerWriter< ::ohlc::OHLC>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace ohlc
 
@@ -15,10 +15,10 @@
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/support/message_allocator.h>
 #include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
 #include <grpcpp/impl/rpc_method.h>
 #include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
 #include <grpcpp/server_context.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/support/status.h>
@@ -49,6 +49,58 @@ class OHLCConsumerService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ohlc::OHLC>> PrepareAsyncGetOHLC(::grpc::ClientContext* context, const ::ohlc::StockRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ohlc::OHLC>>(PrepareAsyncGetOHLCRaw(context, request, cq));
     }
+    virtual ::grpc::Status GetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::ohlc::OHLCBatch* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ohlc::OHLCBatch>> AsyncGetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ohlc::OHLCBatch>>(AsyncGetOHLCBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ohlc::OHLCBatch>> PrepareAsyncGetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ohlc::OHLCBatch>>(PrepareAsyncGetOHLCBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientWriterInterface< ::ohlc::OHLC>> SendOHLCStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) {
+      return std::unique_ptr< ::grpc::ClientWriterInterface< ::ohlc::OHLC>>(SendOHLCStreamRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLC>> AsyncSendOHLCStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLC>>(AsyncSendOHLCStreamRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLC>> PrepareAsyncSendOHLCStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLC>>(PrepareAsyncSendOHLCStreamRaw(context, response, cq));
+    }
+    std::unique_ptr< ::grpc::ClientWriterInterface< ::ohlc::OHLCFixed>> SendOHLCFixedStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) {
+      return std::unique_ptr< ::grpc::ClientWriterInterface< ::ohlc::OHLCFixed>>(SendOHLCFixedStreamRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLCFixed>> AsyncSendOHLCFixedStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLCFixed>>(AsyncSendOHLCFixedStreamRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLCFixed>> PrepareAsyncSendOHLCFixedStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLCFixed>>(PrepareAsyncSendOHLCFixedStreamRaw(context, response, cq));
+    }
+    std::unique_ptr< ::grpc::ClientWriterInterface< ::ohlc::OHLCColumns>> SendOHLCColumns(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) {
+      return std::unique_ptr< ::grpc::ClientWriterInterface< ::ohlc::OHLCColumns>>(SendOHLCColumnsRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLCColumns>> AsyncSendOHLCColumns(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLCColumns>>(AsyncSendOHLCColumnsRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLCColumns>> PrepareAsyncSendOHLCColumns(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLCColumns>>(PrepareAsyncSendOHLCColumnsRaw(context, response, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::ohlc::OHLCPage>> GetOHLCRange(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::ohlc::OHLCPage>>(GetOHLCRangeRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::ohlc::OHLCPage>> AsyncGetOHLCRange(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::ohlc::OHLCPage>>(AsyncGetOHLCRangeRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::ohlc::OHLCPage>> PrepareAsyncGetOHLCRange(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::ohlc::OHLCPage>>(PrepareAsyncGetOHLCRangeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::ohlc::OHLC>> SubscribeOHLC(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::ohlc::OHLC>>(SubscribeOHLCRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::ohlc::OHLC>> AsyncSubscribeOHLC(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::ohlc::OHLC>>(AsyncSubscribeOHLCRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::ohlc::OHLC>> PrepareAsyncSubscribeOHLC(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::ohlc::OHLC>>(PrepareAsyncSubscribeOHLCRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -56,6 +108,13 @@ class OHLCConsumerService final {
       virtual void SendOHLC(::grpc::ClientContext* context, const ::ohlc::OHLC* request, ::ohlc::SendOHLCResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetOHLC(::grpc::ClientContext* context, const ::ohlc::StockRequest* request, ::ohlc::OHLC* response, std::function<void(::grpc::Status)>) = 0;
       virtual void GetOHLC(::grpc::ClientContext* context, const ::ohlc::StockRequest* request, ::ohlc::OHLC* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void GetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest* request, ::ohlc::OHLCBatch* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest* request, ::ohlc::OHLCBatch* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void SendOHLCStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::ClientWriteReactor< ::ohlc::OHLC>* reactor) = 0;
+      virtual void SendOHLCFixedStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::ClientWriteReactor< ::ohlc::OHLCFixed>* reactor) = 0;
+      virtual void SendOHLCColumns(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::ClientWriteReactor< ::ohlc::OHLCColumns>* reactor) = 0;
+      virtual void GetOHLCRange(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest* request, ::grpc::ClientReadReactor< ::ohlc::OHLCPage>* reactor) = 0;
+      virtual void SubscribeOHLC(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest* request, ::grpc::ClientReadReactor< ::ohlc::OHLC>* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -65,6 +124,23 @@ class OHLCConsumerService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::ohlc::SendOHLCResponse>* PrepareAsyncSendOHLCRaw(::grpc::ClientContext* context, const ::ohlc::OHLC& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::ohlc::OHLC>* AsyncGetOHLCRaw(::grpc::ClientContext* context, const ::ohlc::StockRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::ohlc::OHLC>* PrepareAsyncGetOHLCRaw(::grpc::ClientContext* context, const ::ohlc::StockRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ohlc::OHLCBatch>* AsyncGetOHLCBatchRaw(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ohlc::OHLCBatch>* PrepareAsyncGetOHLCBatchRaw(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientWriterInterface< ::ohlc::OHLC>* SendOHLCStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLC>* AsyncSendOHLCStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLC>* PrepareAsyncSendOHLCStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientWriterInterface< ::ohlc::OHLCFixed>* SendOHLCFixedStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLCFixed>* AsyncSendOHLCFixedStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLCFixed>* PrepareAsyncSendOHLCFixedStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientWriterInterface< ::ohlc::OHLCColumns>* SendOHLCColumnsRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLCColumns>* AsyncSendOHLCColumnsRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::ohlc::OHLCColumns>* PrepareAsyncSendOHLCColumnsRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::ohlc::OHLCPage>* GetOHLCRangeRaw(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::ohlc::OHLCPage>* AsyncGetOHLCRangeRaw(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::ohlc::OHLCPage>* PrepareAsyncGetOHLCRangeRaw(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::ohlc::OHLC>* SubscribeOHLCRaw(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::ohlc::OHLC>* AsyncSubscribeOHLCRaw(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::ohlc::OHLC>* PrepareAsyncSubscribeOHLCRaw(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -83,6 +159,58 @@ class OHLCConsumerService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ohlc::OHLC>> PrepareAsyncGetOHLC(::grpc::ClientContext* context, const ::ohlc::StockRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ohlc::OHLC>>(PrepareAsyncGetOHLCRaw(context, request, cq));
     }
+    ::grpc::Status GetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::ohlc::OHLCBatch* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ohlc::OHLCBatch>> AsyncGetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ohlc::OHLCBatch>>(AsyncGetOHLCBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ohlc::OHLCBatch>> PrepareAsyncGetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ohlc::OHLCBatch>>(PrepareAsyncGetOHLCBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientWriter< ::ohlc::OHLC>> SendOHLCStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) {
+      return std::unique_ptr< ::grpc::ClientWriter< ::ohlc::OHLC>>(SendOHLCStreamRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::ohlc::OHLC>> AsyncSendOHLCStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::ohlc::OHLC>>(AsyncSendOHLCStreamRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::ohlc::OHLC>> PrepareAsyncSendOHLCStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::ohlc::OHLC>>(PrepareAsyncSendOHLCStreamRaw(context, response, cq));
+    }
+    std::unique_ptr< ::grpc::ClientWriter< ::ohlc::OHLCFixed>> SendOHLCFixedStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) {
+      return std::unique_ptr< ::grpc::ClientWriter< ::ohlc::OHLCFixed>>(SendOHLCFixedStreamRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::ohlc::OHLCFixed>> AsyncSendOHLCFixedStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::ohlc::OHLCFixed>>(AsyncSendOHLCFixedStreamRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::ohlc::OHLCFixed>> PrepareAsyncSendOHLCFixedStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::ohlc::OHLCFixed>>(PrepareAsyncSendOHLCFixedStreamRaw(context, response, cq));
+    }
+    std::unique_ptr< ::grpc::ClientWriter< ::ohlc::OHLCColumns>> SendOHLCColumns(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) {
+      return std::unique_ptr< ::grpc::ClientWriter< ::ohlc::OHLCColumns>>(SendOHLCColumnsRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::ohlc::OHLCColumns>> AsyncSendOHLCColumns(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::ohlc::OHLCColumns>>(AsyncSendOHLCColumnsRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::ohlc::OHLCColumns>> PrepareAsyncSendOHLCColumns(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::ohlc::OHLCColumns>>(PrepareAsyncSendOHLCColumnsRaw(context, response, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::ohlc::OHLCPage>> GetOHLCRange(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::ohlc::OHLCPage>>(GetOHLCRangeRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::ohlc::OHLCPage>> AsyncGetOHLCRange(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::ohlc::OHLCPage>>(AsyncGetOHLCRangeRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::ohlc::OHLCPage>> PrepareAsyncGetOHLCRange(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::ohlc::OHLCPage>>(PrepareAsyncGetOHLCRangeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::ohlc::OHLC>> SubscribeOHLC(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::ohlc::OHLC>>(SubscribeOHLCRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::ohlc::OHLC>> AsyncSubscribeOHLC(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::ohlc::OHLC>>(AsyncSubscribeOHLCRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::ohlc::OHLC>> PrepareAsyncSubscribeOHLC(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::ohlc::OHLC>>(PrepareAsyncSubscribeOHLCRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -90,6 +218,13 @@ class OHLCConsumerService final {
       void SendOHLC(::grpc::ClientContext* context, const ::ohlc::OHLC* request, ::ohlc::SendOHLCResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetOHLC(::grpc::ClientContext* context, const ::ohlc::StockRequest* request, ::ohlc::OHLC* response, std::function<void(::grpc::Status)>) override;
       void GetOHLC(::grpc::ClientContext* context, const ::ohlc::StockRequest* request, ::ohlc::OHLC* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest* request, ::ohlc::OHLCBatch* response, std::function<void(::grpc::Status)>) override;
+      void GetOHLCBatch(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest* request, ::ohlc::OHLCBatch* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SendOHLCStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::ClientWriteReactor< ::ohlc::OHLC>* reactor) override;
+      void SendOHLCFixedStream(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::ClientWriteReactor< ::ohlc::OHLCFixed>* reactor) override;
+      void SendOHLCColumns(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::ClientWriteReactor< ::ohlc::OHLCColumns>* reactor) override;
+      void GetOHLCRange(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest* request, ::grpc::ClientReadReactor< ::ohlc::OHLCPage>* reactor) override;
+      void SubscribeOHLC(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest* request, ::grpc::ClientReadReactor< ::ohlc::OHLC>* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -105,8 +240,31 @@ class OHLCConsumerService final {
     ::grpc::ClientAsyncResponseReader< ::ohlc::SendOHLCResponse>* PrepareAsyncSendOHLCRaw(::grpc::ClientContext* context, const ::ohlc::OHLC& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::ohlc::OHLC>* AsyncGetOHLCRaw(::grpc::ClientContext* context, const ::ohlc::StockRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::ohlc::OHLC>* PrepareAsyncGetOHLCRaw(::grpc::ClientContext* context, const ::ohlc::StockRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ohlc::OHLCBatch>* AsyncGetOHLCBatchRaw(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ohlc::OHLCBatch>* PrepareAsyncGetOHLCBatchRaw(::grpc::ClientContext* context, const ::ohlc::StockBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientWriter< ::ohlc::OHLC>* SendOHLCStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) override;
+    ::grpc::ClientAsyncWriter< ::ohlc::OHLC>* AsyncSendOHLCStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncWriter< ::ohlc::OHLC>* PrepareAsyncSendOHLCStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientWriter< ::ohlc::OHLCFixed>* SendOHLCFixedStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) override;
+    ::grpc::ClientAsyncWriter< ::ohlc::OHLCFixed>* AsyncSendOHLCFixedStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncWriter< ::ohlc::OHLCFixed>* PrepareAsyncSendOHLCFixedStreamRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientWriter< ::ohlc::OHLCColumns>* SendOHLCColumnsRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response) override;
+    ::grpc::ClientAsyncWriter< ::ohlc::OHLCColumns>* AsyncSendOHLCColumnsRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncWriter< ::ohlc::OHLCColumns>* PrepareAsyncSendOHLCColumnsRaw(::grpc::ClientContext* context, ::ohlc::SendOHLCResponse* response, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::ohlc::OHLCPage>* GetOHLCRangeRaw(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request) override;
+    ::grpc::ClientAsyncReader< ::ohlc::OHLCPage>* AsyncGetOHLCRangeRaw(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::ohlc::OHLCPage>* PrepareAsyncGetOHLCRangeRaw(::grpc::ClientContext* context, const ::ohlc::OHLCRangeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::ohlc::OHLC>* SubscribeOHLCRaw(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request) override;
+    ::grpc::ClientAsyncReader< ::ohlc::OHLC>* AsyncSubscribeOHLCRaw(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::ohlc::OHLC>* PrepareAsyncSubscribeOHLCRaw(::grpc::ClientContext* context, const ::ohlc::SubscribeRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_SendOHLC_;
     const ::grpc::internal::RpcMethod rpcmethod_GetOHLC_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetOHLCBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_SendOHLCStream_;
+    const ::grpc::internal::RpcMethod rpcmethod_SendOHLCFixedStream_;
+    const ::grpc::internal::RpcMethod rpcmethod_SendOHLCColumns_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetOHLCRange_;
+    const ::grpc::internal::RpcMethod rpcmethod_SubscribeOHLC_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -116,6 +274,12 @@ class OHLCConsumerService final {
     virtual ~Service();
     virtual ::grpc::Status SendOHLC(::grpc::ServerContext* context, const ::ohlc::OHLC* request, ::ohlc::SendOHLCResponse* response);
     virtual ::grpc::Status GetOHLC(::grpc::ServerContext* context, const ::ohlc::StockRequest* request, ::ohlc::OHLC* response);
+    virtual ::grpc::Status GetOHLCBatch(::grpc::ServerContext* context, const ::ohlc::StockBatchRequest* request, ::ohlc::OHLCBatch* response);
+    virtual ::grpc::Status SendOHLCStream(::grpc::ServerContext* context, ::grpc::ServerReader< ::ohlc::OHLC>* reader, ::ohlc::SendOHLCResponse* response);
+    virtual ::grpc::Status SendOHLCFixedStream(::grpc::ServerContext* context, ::grpc::ServerReader< ::ohlc::OHLCFixed>* reader, ::ohlc::SendOHLCResponse* response);
+    virtual ::grpc::Status SendOHLCColumns(::grpc::ServerContext* context, ::grpc::ServerReader< ::ohlc::OHLCColumns>* reader, ::ohlc::SendOHLCResponse* response);
+    virtual ::grpc::Status GetOHLCRange(::grpc::ServerContext* context, const ::ohlc::OHLCRangeRequest* request, ::grpc::ServerWriter< ::ohlc::OHLCPage>* writer);
+    virtual ::grpc::Status SubscribeOHLC(::grpc::ServerContext* context, const ::ohlc::SubscribeRequest* request, ::grpc::ServerWriter< ::ohlc::OHLC>* writer);
   };
   template <class BaseClass>
   class WithAsyncMethod_SendOHLC : public BaseClass {
@@ -157,7 +321,127 @@ class OHLCConsumerService final {
       ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_SendOHLC<WithAsyncMethod_GetOHLC<Service > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_GetOHLCBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetOHLCBatch() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_GetOHLCBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetOHLCBatch(::grpc::ServerContext* /*context*/, const ::ohlc::StockBatchRequest* /*request*/, ::ohlc::OHLCBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetOHLCBatch(::grpc::ServerContext* context, ::ohlc::StockBatchRequest* request, ::grpc::ServerAsyncResponseWriter< ::ohlc::OHLCBatch>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SendOHLCStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SendOHLCStream() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_SendOHLCStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLC>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSendOHLCStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::ohlc::SendOHLCResponse, ::ohlc::OHLC>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(3, context, reader, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SendOHLCFixedStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SendOHLCFixedStream() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_SendOHLCFixedStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCFixedStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLCFixed>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSendOHLCFixedStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::ohlc::SendOHLCResponse, ::ohlc::OHLCFixed>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(4, context, reader, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SendOHLCColumns : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SendOHLCColumns() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_SendOHLCColumns() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCColumns(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLCColumns>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSendOHLCColumns(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::ohlc::SendOHLCResponse, ::ohlc::OHLCColumns>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(5, context, reader, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetOHLCRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetOHLCRange() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_GetOHLCRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetOHLCRange(::grpc::ServerContext* /*context*/, const ::ohlc::OHLCRangeRequest* /*request*/, ::grpc::ServerWriter< ::ohlc::OHLCPage>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetOHLCRange(::grpc::ServerContext* context, ::ohlc::OHLCRangeRequest* request, ::grpc::ServerAsyncWriter< ::ohlc::OHLCPage>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(6, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SubscribeOHLC : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SubscribeOHLC() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_SubscribeOHLC() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeOHLC(::grpc::ServerContext* /*context*/, const ::ohlc::SubscribeRequest* /*request*/, ::grpc::ServerWriter< ::ohlc::OHLC>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribeOHLC(::grpc::ServerContext* context, ::ohlc::SubscribeRequest* request, ::grpc::ServerAsyncWriter< ::ohlc::OHLC>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(7, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_SendOHLC<WithAsyncMethod_GetOHLC<WithAsyncMethod_GetOHLCBatch<WithAsyncMethod_SendOHLCStream<WithAsyncMethod_SendOHLCFixedStream<WithAsyncMethod_SendOHLCColumns<WithAsyncMethod_GetOHLCRange<WithAsyncMethod_SubscribeOHLC<Service > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_SendOHLC : public BaseClass {
    private:
@@ -212,7 +496,144 @@ class OHLCConsumerService final {
     virtual ::grpc::ServerUnaryReactor* GetOHLC(
       ::grpc::CallbackServerContext* /*context*/, const ::ohlc::StockRequest* /*request*/, ::ohlc::OHLC* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_SendOHLC<WithCallbackMethod_GetOHLC<Service > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_GetOHLCBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetOHLCBatch() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::ohlc::StockBatchRequest, ::ohlc::OHLCBatch>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::ohlc::StockBatchRequest* request, ::ohlc::OHLCBatch* response) { return this->GetOHLCBatch(context, request, response); }));}
+    void SetMessageAllocatorFor_GetOHLCBatch(
+        ::grpc::MessageAllocator< ::ohlc::StockBatchRequest, ::ohlc::OHLCBatch>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::ohlc::StockBatchRequest, ::ohlc::OHLCBatch>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetOHLCBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetOHLCBatch(::grpc::ServerContext* /*context*/, const ::ohlc::StockBatchRequest* /*request*/, ::ohlc::OHLCBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetOHLCBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::ohlc::StockBatchRequest* /*request*/, ::ohlc::OHLCBatch* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SendOHLCStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SendOHLCStream() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::ohlc::OHLC, ::ohlc::SendOHLCResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::ohlc::SendOHLCResponse* response) { return this->SendOHLCStream(context, response); }));
+    }
+    ~WithCallbackMethod_SendOHLCStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLC>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::ohlc::OHLC>* SendOHLCStream(
+      ::grpc::CallbackServerContext* /*context*/, ::ohlc::SendOHLCResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SendOHLCFixedStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SendOHLCFixedStream() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::ohlc::OHLCFixed, ::ohlc::SendOHLCResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::ohlc::SendOHLCResponse* response) { return this->SendOHLCFixedStream(context, response); }));
+    }
+    ~WithCallbackMethod_SendOHLCFixedStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCFixedStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLCFixed>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::ohlc::OHLCFixed>* SendOHLCFixedStream(
+      ::grpc::CallbackServerContext* /*context*/, ::ohlc::SendOHLCResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SendOHLCColumns : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SendOHLCColumns() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::ohlc::OHLCColumns, ::ohlc::SendOHLCResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::ohlc::SendOHLCResponse* response) { return this->SendOHLCColumns(context, response); }));
+    }
+    ~WithCallbackMethod_SendOHLCColumns() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCColumns(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLCColumns>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::ohlc::OHLCColumns>* SendOHLCColumns(
+      ::grpc::CallbackServerContext* /*context*/, ::ohlc::SendOHLCResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetOHLCRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetOHLCRange() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::ohlc::OHLCRangeRequest, ::ohlc::OHLCPage>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::ohlc::OHLCRangeRequest* request) { return this->GetOHLCRange(context, request); }));
+    }
+    ~WithCallbackMethod_GetOHLCRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetOHLCRange(::grpc::ServerContext* /*context*/, const ::ohlc::OHLCRangeRequest* /*request*/, ::grpc::ServerWriter< ::ohlc::OHLCPage>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::ohlc::OHLCPage>* GetOHLCRange(
+      ::grpc::CallbackServerContext* /*context*/, const ::ohlc::OHLCRangeRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SubscribeOHLC : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SubscribeOHLC() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::ohlc::SubscribeRequest, ::ohlc::OHLC>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::ohlc::SubscribeRequest* request) { return this->SubscribeOHLC(context, request); }));
+    }
+    ~WithCallbackMethod_SubscribeOHLC() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeOHLC(::grpc::ServerContext* /*context*/, const ::ohlc::SubscribeRequest* /*request*/, ::grpc::ServerWriter< ::ohlc::OHLC>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::ohlc::OHLC>* SubscribeOHLC(
+      ::grpc::CallbackServerContext* /*context*/, const ::ohlc::SubscribeRequest* /*request*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_SendOHLC<WithCallbackMethod_GetOHLC<WithCallbackMethod_GetOHLCBatch<WithCallbackMethod_SendOHLCStream<WithCallbackMethod_SendOHLCFixedStream<WithCallbackMethod_SendOHLCColumns<WithCallbackMethod_GetOHLCRange<WithCallbackMethod_SubscribeOHLC<Service > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_SendOHLC : public BaseClass {
@@ -249,6 +670,108 @@ class OHLCConsumerService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_GetOHLCBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetOHLCBatch() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_GetOHLCBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetOHLCBatch(::grpc::ServerContext* /*context*/, const ::ohlc::StockBatchRequest* /*request*/, ::ohlc::OHLCBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SendOHLCStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SendOHLCStream() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_SendOHLCStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLC>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SendOHLCFixedStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SendOHLCFixedStream() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_SendOHLCFixedStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCFixedStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLCFixed>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SendOHLCColumns : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SendOHLCColumns() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_SendOHLCColumns() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCColumns(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLCColumns>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetOHLCRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetOHLCRange() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_GetOHLCRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetOHLCRange(::grpc::ServerContext* /*context*/, const ::ohlc::OHLCRangeRequest* /*request*/, ::grpc::ServerWriter< ::ohlc::OHLCPage>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SubscribeOHLC : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SubscribeOHLC() {
+      ::grpc::Service::MarkMethodGeneric(7);
+    }
+    ~WithGenericMethod_SubscribeOHLC() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeOHLC(::grpc::ServerContext* /*context*/, const ::ohlc::SubscribeRequest* /*request*/, ::grpc::ServerWriter< ::ohlc::OHLC>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_SendOHLC : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -289,6 +812,126 @@ class OHLCConsumerService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_GetOHLCBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetOHLCBatch() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_GetOHLCBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetOHLCBatch(::grpc::ServerContext* /*context*/, const ::ohlc::StockBatchRequest* /*request*/, ::ohlc::OHLCBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetOHLCBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SendOHLCStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SendOHLCStream() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_SendOHLCStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLC>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSendOHLCStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(3, context, reader, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SendOHLCFixedStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SendOHLCFixedStream() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_SendOHLCFixedStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCFixedStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLCFixed>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSendOHLCFixedStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(4, context, reader, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SendOHLCColumns : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SendOHLCColumns() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_SendOHLCColumns() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCColumns(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLCColumns>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSendOHLCColumns(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(5, context, reader, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetOHLCRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetOHLCRange() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_GetOHLCRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetOHLCRange(::grpc::ServerContext* /*context*/, const ::ohlc::OHLCRangeRequest* /*request*/, ::grpc::ServerWriter< ::ohlc::OHLCPage>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetOHLCRange(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(6, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SubscribeOHLC : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SubscribeOHLC() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_SubscribeOHLC() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeOHLC(::grpc::ServerContext* /*context*/, const ::ohlc::SubscribeRequest* /*request*/, ::grpc::ServerWriter< ::ohlc::OHLC>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribeOHLC(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(7, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_SendOHLC : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -333,6 +976,138 @@ class OHLCConsumerService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_GetOHLCBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetOHLCBatch() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetOHLCBatch(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetOHLCBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetOHLCBatch(::grpc::ServerContext* /*context*/, const ::ohlc::StockBatchRequest* /*request*/, ::ohlc::OHLCBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetOHLCBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SendOHLCStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SendOHLCStream() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::grpc::ByteBuffer* response) { return this->SendOHLCStream(context, response); }));
+    }
+    ~WithRawCallbackMethod_SendOHLCStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLC>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::grpc::ByteBuffer>* SendOHLCStream(
+      ::grpc::CallbackServerContext* /*context*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SendOHLCFixedStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SendOHLCFixedStream() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::grpc::ByteBuffer* response) { return this->SendOHLCFixedStream(context, response); }));
+    }
+    ~WithRawCallbackMethod_SendOHLCFixedStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCFixedStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLCFixed>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::grpc::ByteBuffer>* SendOHLCFixedStream(
+      ::grpc::CallbackServerContext* /*context*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SendOHLCColumns : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SendOHLCColumns() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::grpc::ByteBuffer* response) { return this->SendOHLCColumns(context, response); }));
+    }
+    ~WithRawCallbackMethod_SendOHLCColumns() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendOHLCColumns(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::ohlc::OHLCColumns>* /*reader*/, ::ohlc::SendOHLCResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::grpc::ByteBuffer>* SendOHLCColumns(
+      ::grpc::CallbackServerContext* /*context*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetOHLCRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetOHLCRange() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request) { return this->GetOHLCRange(context, request); }));
+    }
+    ~WithRawCallbackMethod_GetOHLCRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetOHLCRange(::grpc::ServerContext* /*context*/, const ::ohlc::OHLCRangeRequest* /*request*/, ::grpc::ServerWriter< ::ohlc::OHLCPage>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* GetOHLCRange(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SubscribeOHLC : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SubscribeOHLC() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request) { return this->SubscribeOHLC(context, request); }));
+    }
+    ~WithRawCallbackMethod_SubscribeOHLC() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeOHLC(::grpc::ServerContext* /*context*/, const ::ohlc::SubscribeRequest* /*request*/, ::grpc::ServerWriter< ::ohlc::OHLC>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* SubscribeOHLC(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_SendOHLC : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -386,9 +1161,90 @@ class OHLCConsumerService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedGetOHLC(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ohlc::StockRequest,::ohlc::OHLC>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_SendOHLC<WithStreamedUnaryMethod_GetOHLC<Service > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_SendOHLC<WithStreamedUnaryMethod_GetOHLC<Service > > StreamedService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetOHLCBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetOHLCBatch() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::ohlc::StockBatchRequest, ::ohlc::OHLCBatch>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::ohlc::StockBatchRequest, ::ohlc::OHLCBatch>* streamer) {
+                       return this->StreamedGetOHLCBatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetOHLCBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetOHLCBatch(::grpc::ServerContext* /*context*/, const ::ohlc::StockBatchRequest* /*request*/, ::ohlc::OHLCBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetOHLCBatch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ohlc::StockBatchRequest,::ohlc::OHLCBatch>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_SendOHLC<WithStreamedUnaryMethod_GetOHLC<WithStreamedUnaryMethod_GetOHLCBatch<Service > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_GetOHLCRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_GetOHLCRange() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::ohlc::OHLCRangeRequest, ::ohlc::OHLCPage>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::ohlc::OHLCRangeRequest, ::ohlc::OHLCPage>* streamer) {
+                       return this->StreamedGetOHLCRange(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_GetOHLCRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetOHLCRange(::grpc::ServerContext* /*context*/, const ::ohlc::OHLCRangeRequest* /*request*/, ::grpc::ServerWriter< ::ohlc::OHLCPage>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedGetOHLCRange(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::ohlc::OHLCRangeRequest,::ohlc::OHLCPage>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_SubscribeOHLC : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_SubscribeOHLC() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::ohlc::SubscribeRequest, ::ohlc::OHLC>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::ohlc::SubscribeRequest, ::ohlc::OHLC>* streamer) {
+                       return this->StreamedSubscribeOHLC(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_SubscribeOHLC() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SubscribeOHLC(::grpc::ServerContext* /*context*/, const ::ohlc::SubscribeRequest* /*request*/, ::grpc::ServerWriter< ::ohlc::OHLC>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedSubscribeOHLC(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::ohlc::SubscribeRequest,::ohlc::OHLC>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_GetOHLCRange<WithSplitStreamingMethod_SubscribeOHLC<Service > > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_SendOHLC<WithStreamedUnaryMethod_GetOHLC<WithStreamedUnaryMethod_GetOHLCBatch<WithSplitStreamingMethod_GetOHLCRange<WithSplitStreamingMethod_SubscribeOHLC<Service > > > > > StreamedService;
 };
 
 }  // namespace ohlc
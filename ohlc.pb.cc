@@ -4,589 +4,876 @@
 #include "ohlc.pb.h"
 
 #include <algorithm>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-// Must be included last.
-#include "google/protobuf/port_def.inc"
 PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-namespace ohlc {
 
-inline constexpr StockRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : stock_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-template <typename>
-PROTOBUF_CONSTEXPR StockRequest::StockRequest(::_pbi::ConstantInitialized)
-    : _impl_(::_pbi::ConstantInitialized()) {}
+namespace ohlc {
+PROTOBUF_CONSTEXPR OHLC::OHLC(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stock_code_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.open_)*/0
+  , /*decltype(_impl_.high_)*/0
+  , /*decltype(_impl_.low_)*/0
+  , /*decltype(_impl_.close_)*/0
+  , /*decltype(_impl_.volume_)*/0
+  , /*decltype(_impl_.value_)*/0
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.start_time_)*/uint64_t{0u}
+  , /*decltype(_impl_.interval_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OHLCDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OHLCDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OHLCDefaultTypeInternal() {}
+  union {
+    OHLC _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OHLCDefaultTypeInternal _OHLC_default_instance_;
+PROTOBUF_CONSTEXPR OHLCFixed::OHLCFixed(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stock_code_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.open_)*/int64_t{0}
+  , /*decltype(_impl_.high_)*/int64_t{0}
+  , /*decltype(_impl_.low_)*/int64_t{0}
+  , /*decltype(_impl_.close_)*/int64_t{0}
+  , /*decltype(_impl_.volume_)*/int64_t{0}
+  , /*decltype(_impl_.value_)*/int64_t{0}
+  , /*decltype(_impl_.price_scale_)*/0u
+  , /*decltype(_impl_.symbol_id_)*/0u
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OHLCFixedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OHLCFixedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OHLCFixedDefaultTypeInternal() {}
+  union {
+    OHLCFixed _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OHLCFixedDefaultTypeInternal _OHLCFixed_default_instance_;
+PROTOBUF_CONSTEXPR OHLCColumns_SymbolNamesEntry_DoNotUse::OHLCColumns_SymbolNamesEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct OHLCColumns_SymbolNamesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OHLCColumns_SymbolNamesEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OHLCColumns_SymbolNamesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    OHLCColumns_SymbolNamesEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OHLCColumns_SymbolNamesEntry_DoNotUseDefaultTypeInternal _OHLCColumns_SymbolNamesEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR OHLCColumns::OHLCColumns(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.symbol_names_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.symbol_ids_)*/{}
+  , /*decltype(_impl_._symbol_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.open_)*/{}
+  , /*decltype(_impl_._open_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.high_minus_open_)*/{}
+  , /*decltype(_impl_._high_minus_open_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.low_minus_open_)*/{}
+  , /*decltype(_impl_._low_minus_open_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.close_minus_open_)*/{}
+  , /*decltype(_impl_._close_minus_open_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.volume_)*/{}
+  , /*decltype(_impl_._volume_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_._value_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.sequence_)*/{}
+  , /*decltype(_impl_._sequence_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.price_scale_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OHLCColumnsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OHLCColumnsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OHLCColumnsDefaultTypeInternal() {}
+  union {
+    OHLCColumns _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OHLCColumnsDefaultTypeInternal _OHLCColumns_default_instance_;
+PROTOBUF_CONSTEXPR StockRequest::StockRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stock_code_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct StockRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR StockRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR StockRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~StockRequestDefaultTypeInternal() {}
   union {
     StockRequest _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StockRequestDefaultTypeInternal _StockRequest_default_instance_;
-
-inline constexpr SendOHLCResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : message_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SendOHLCResponse::SendOHLCResponse(::_pbi::ConstantInitialized)
-    : _impl_(::_pbi::ConstantInitialized()) {}
-struct SendOHLCResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SendOHLCResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SendOHLCResponseDefaultTypeInternal() {}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StockRequestDefaultTypeInternal _StockRequest_default_instance_;
+PROTOBUF_CONSTEXPR StockBatchRequest::StockBatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stock_codes_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StockBatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StockBatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StockBatchRequestDefaultTypeInternal() {}
   union {
-    SendOHLCResponse _instance;
+    StockBatchRequest _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendOHLCResponseDefaultTypeInternal _SendOHLCResponse_default_instance_;
-
-inline constexpr OHLC::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : stock_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        open_{0},
-        high_{0},
-        low_{0},
-        close_{0},
-        volume_{0},
-        value_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR OHLC::OHLC(::_pbi::ConstantInitialized)
-    : _impl_(::_pbi::ConstantInitialized()) {}
-struct OHLCDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR OHLCDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~OHLCDefaultTypeInternal() {}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StockBatchRequestDefaultTypeInternal _StockBatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR OHLCBatch::OHLCBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.candles_)*/{}
+  , /*decltype(_impl_.missing_codes_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OHLCBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OHLCBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OHLCBatchDefaultTypeInternal() {}
   union {
-    OHLC _instance;
+    OHLCBatch _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OHLCDefaultTypeInternal _OHLC_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OHLCBatchDefaultTypeInternal _OHLCBatch_default_instance_;
+PROTOBUF_CONSTEXPR OHLCRangeRequest::OHLCRangeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stock_code_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.interval_)*/uint64_t{0u}
+  , /*decltype(_impl_.from_time_)*/uint64_t{0u}
+  , /*decltype(_impl_.to_time_)*/uint64_t{0u}
+  , /*decltype(_impl_.page_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OHLCRangeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OHLCRangeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OHLCRangeRequestDefaultTypeInternal() {}
+  union {
+    OHLCRangeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OHLCRangeRequestDefaultTypeInternal _OHLCRangeRequest_default_instance_;
+PROTOBUF_CONSTEXPR OHLCPage::OHLCPage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.candles_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OHLCPageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OHLCPageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OHLCPageDefaultTypeInternal() {}
+  union {
+    OHLCPage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OHLCPageDefaultTypeInternal _OHLCPage_default_instance_;
+PROTOBUF_CONSTEXPR SubscribeRequest::SubscribeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stock_codes_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SubscribeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubscribeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubscribeRequestDefaultTypeInternal() {}
+  union {
+    SubscribeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubscribeRequestDefaultTypeInternal _SubscribeRequest_default_instance_;
+PROTOBUF_CONSTEXPR SendOHLCResponse::SendOHLCResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SendOHLCResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SendOHLCResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SendOHLCResponseDefaultTypeInternal() {}
+  union {
+    SendOHLCResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendOHLCResponseDefaultTypeInternal _SendOHLCResponse_default_instance_;
 }  // namespace ohlc
-static ::_pb::Metadata file_level_metadata_ohlc_2eproto[3];
-static constexpr const ::_pb::EnumDescriptor**
-    file_level_enum_descriptors_ohlc_2eproto = nullptr;
-static constexpr const ::_pb::ServiceDescriptor**
-    file_level_service_descriptors_ohlc_2eproto = nullptr;
-const ::uint32_t TableStruct_ohlc_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
-    protodesc_cold) = {
-    ~0u,  // no _has_bits_
-    PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _weak_field_map_
-    ~0u,  // no _inlined_string_donated_
-    ~0u,  // no _split_
-    ~0u,  // no sizeof(Split)
-    PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.open_),
-    PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.high_),
-    PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.low_),
-    PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.close_),
-    PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.volume_),
-    PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.value_),
-    PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.stock_code_),
-    ~0u,  // no _has_bits_
-    PROTOBUF_FIELD_OFFSET(::ohlc::StockRequest, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _weak_field_map_
-    ~0u,  // no _inlined_string_donated_
-    ~0u,  // no _split_
-    ~0u,  // no sizeof(Split)
-    PROTOBUF_FIELD_OFFSET(::ohlc::StockRequest, _impl_.stock_code_),
-    ~0u,  // no _has_bits_
-    PROTOBUF_FIELD_OFFSET(::ohlc::SendOHLCResponse, _internal_metadata_),
-    ~0u,  // no _extensions_
-    ~0u,  // no _oneof_case_
-    ~0u,  // no _weak_field_map_
-    ~0u,  // no _inlined_string_donated_
-    ~0u,  // no _split_
-    ~0u,  // no sizeof(Split)
-    PROTOBUF_FIELD_OFFSET(::ohlc::SendOHLCResponse, _impl_.message_),
-};
-
-static const ::_pbi::MigrationSchema
-    schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-        {0, -1, -1, sizeof(::ohlc::OHLC)},
-        {15, -1, -1, sizeof(::ohlc::StockRequest)},
-        {24, -1, -1, sizeof(::ohlc::SendOHLCResponse)},
+static ::_pb::Metadata file_level_metadata_ohlc_2eproto[11];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ohlc_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ohlc_2eproto = nullptr;
+
+const uint32_t TableStruct_ohlc_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.open_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.high_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.low_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.close_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.volume_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.stock_code_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.start_time_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLC, _impl_.interval_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCFixed, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCFixed, _impl_.open_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCFixed, _impl_.high_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCFixed, _impl_.low_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCFixed, _impl_.close_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCFixed, _impl_.volume_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCFixed, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCFixed, _impl_.price_scale_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCFixed, _impl_.stock_code_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCFixed, _impl_.symbol_id_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCFixed, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns_SymbolNamesEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns_SymbolNamesEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns_SymbolNamesEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns_SymbolNamesEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns, _impl_.price_scale_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns, _impl_.symbol_names_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns, _impl_.symbol_ids_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns, _impl_.open_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns, _impl_.high_minus_open_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns, _impl_.low_minus_open_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns, _impl_.close_minus_open_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns, _impl_.volume_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCColumns, _impl_.sequence_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ohlc::StockRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ohlc::StockRequest, _impl_.stock_code_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ohlc::StockBatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ohlc::StockBatchRequest, _impl_.stock_codes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCBatch, _impl_.candles_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCBatch, _impl_.missing_codes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCRangeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCRangeRequest, _impl_.stock_code_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCRangeRequest, _impl_.interval_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCRangeRequest, _impl_.from_time_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCRangeRequest, _impl_.to_time_),
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCRangeRequest, _impl_.page_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCPage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ohlc::OHLCPage, _impl_.candles_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ohlc::SubscribeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ohlc::SubscribeRequest, _impl_.stock_codes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ohlc::SendOHLCResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ohlc::SendOHLCResponse, _impl_.message_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::ohlc::OHLC)},
+  { 16, -1, -1, sizeof(::ohlc::OHLCFixed)},
+  { 32, 40, -1, sizeof(::ohlc::OHLCColumns_SymbolNamesEntry_DoNotUse)},
+  { 42, -1, -1, sizeof(::ohlc::OHLCColumns)},
+  { 58, -1, -1, sizeof(::ohlc::StockRequest)},
+  { 65, -1, -1, sizeof(::ohlc::StockBatchRequest)},
+  { 72, -1, -1, sizeof(::ohlc::OHLCBatch)},
+  { 80, -1, -1, sizeof(::ohlc::OHLCRangeRequest)},
+  { 91, -1, -1, sizeof(::ohlc::OHLCPage)},
+  { 98, -1, -1, sizeof(::ohlc::SubscribeRequest)},
+  { 105, -1, -1, sizeof(::ohlc::SendOHLCResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
-    &::ohlc::_OHLC_default_instance_._instance,
-    &::ohlc::_StockRequest_default_instance_._instance,
-    &::ohlc::_SendOHLCResponse_default_instance_._instance,
-};
-const char descriptor_table_protodef_ohlc_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-    "\n\nohlc.proto\022\004ohlc\"q\n\004OHLC\022\014\n\004open\030\001 \001(\001"
-    "\022\014\n\004high\030\002 \001(\001\022\013\n\003low\030\003 \001(\001\022\r\n\005close\030\004 \001"
-    "(\001\022\016\n\006volume\030\005 \001(\001\022\r\n\005value\030\006 \001(\001\022\022\n\nsto"
-    "ck_code\030\007 \001(\t\"\"\n\014StockRequest\022\022\n\nstock_c"
-    "ode\030\001 \001(\t\"#\n\020SendOHLCResponse\022\017\n\007message"
-    "\030\001 \001(\t2p\n\023OHLCConsumerService\022.\n\010SendOHL"
-    "C\022\n.ohlc.OHLC\032\026.ohlc.SendOHLCResponse\022)\n"
-    "\007GetOHLC\022\022.ohlc.StockRequest\032\n.ohlc.OHLC"
-    "b\006proto3"
-};
-static ::absl::once_flag descriptor_table_ohlc_2eproto_once;
+  &::ohlc::_OHLC_default_instance_._instance,
+  &::ohlc::_OHLCFixed_default_instance_._instance,
+  &::ohlc::_OHLCColumns_SymbolNamesEntry_DoNotUse_default_instance_._instance,
+  &::ohlc::_OHLCColumns_default_instance_._instance,
+  &::ohlc::_StockRequest_default_instance_._instance,
+  &::ohlc::_StockBatchRequest_default_instance_._instance,
+  &::ohlc::_OHLCBatch_default_instance_._instance,
+  &::ohlc::_OHLCRangeRequest_default_instance_._instance,
+  &::ohlc::_OHLCPage_default_instance_._instance,
+  &::ohlc::_SubscribeRequest_default_instance_._instance,
+  &::ohlc::_SendOHLCResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ohlc_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\nohlc.proto\022\004ohlc\"\251\001\n\004OHLC\022\014\n\004open\030\001 \001("
+  "\001\022\014\n\004high\030\002 \001(\001\022\013\n\003low\030\003 \001(\001\022\r\n\005close\030\004 "
+  "\001(\001\022\016\n\006volume\030\005 \001(\001\022\r\n\005value\030\006 \001(\001\022\022\n\nst"
+  "ock_code\030\007 \001(\t\022\020\n\010sequence\030\010 \001(\004\022\022\n\nstar"
+  "t_time\030\t \001(\004\022\020\n\010interval\030\n \001(\004\"\260\001\n\tOHLCF"
+  "ixed\022\014\n\004open\030\001 \001(\022\022\014\n\004high\030\002 \001(\022\022\013\n\003low\030"
+  "\003 \001(\022\022\r\n\005close\030\004 \001(\022\022\016\n\006volume\030\005 \001(\003\022\r\n\005"
+  "value\030\006 \001(\003\022\023\n\013price_scale\030\007 \001(\r\022\022\n\nstoc"
+  "k_code\030\010 \001(\t\022\021\n\tsymbol_id\030\t \001(\r\022\020\n\010seque"
+  "nce\030\n \001(\004\"\256\002\n\013OHLCColumns\022\023\n\013price_scale"
+  "\030\001 \001(\r\0228\n\014symbol_names\030\002 \003(\0132\".ohlc.OHLC"
+  "Columns.SymbolNamesEntry\022\022\n\nsymbol_ids\030\003"
+  " \003(\r\022\014\n\004open\030\004 \003(\022\022\027\n\017high_minus_open\030\005 "
+  "\003(\022\022\026\n\016low_minus_open\030\006 \003(\022\022\030\n\020close_min"
+  "us_open\030\007 \003(\022\022\016\n\006volume\030\010 \003(\003\022\r\n\005value\030\t"
+  " \003(\003\022\020\n\010sequence\030\n \003(\004\0322\n\020SymbolNamesEnt"
+  "ry\022\013\n\003key\030\001 \001(\r\022\r\n\005value\030\002 \001(\t:\0028\001\"\"\n\014St"
+  "ockRequest\022\022\n\nstock_code\030\001 \001(\t\"(\n\021StockB"
+  "atchRequest\022\023\n\013stock_codes\030\001 \003(\t\"\?\n\tOHLC"
+  "Batch\022\033\n\007candles\030\001 \003(\0132\n.ohlc.OHLC\022\025\n\rmi"
+  "ssing_codes\030\002 \003(\t\"o\n\020OHLCRangeRequest\022\022\n"
+  "\nstock_code\030\001 \001(\t\022\020\n\010interval\030\002 \001(\004\022\021\n\tf"
+  "rom_time\030\003 \001(\004\022\017\n\007to_time\030\004 \001(\004\022\021\n\tpage_"
+  "size\030\005 \001(\r\"\'\n\010OHLCPage\022\033\n\007candles\030\001 \003(\0132"
+  "\n.ohlc.OHLC\"\'\n\020SubscribeRequest\022\023\n\013stock"
+  "_codes\030\001 \003(\t\"#\n\020SendOHLCResponse\022\017\n\007mess"
+  "age\030\001 \001(\t2\325\003\n\023OHLCConsumerService\022.\n\010Sen"
+  "dOHLC\022\n.ohlc.OHLC\032\026.ohlc.SendOHLCRespons"
+  "e\022)\n\007GetOHLC\022\022.ohlc.StockRequest\032\n.ohlc."
+  "OHLC\0228\n\014GetOHLCBatch\022\027.ohlc.StockBatchRe"
+  "quest\032\017.ohlc.OHLCBatch\0226\n\016SendOHLCStream"
+  "\022\n.ohlc.OHLC\032\026.ohlc.SendOHLCResponse(\001\022@"
+  "\n\023SendOHLCFixedStream\022\017.ohlc.OHLCFixed\032\026"
+  ".ohlc.SendOHLCResponse(\001\022>\n\017SendOHLCColu"
+  "mns\022\021.ohlc.OHLCColumns\032\026.ohlc.SendOHLCRe"
+  "sponse(\001\0228\n\014GetOHLCRange\022\026.ohlc.OHLCRang"
+  "eRequest\032\016.ohlc.OHLCPage0\001\0225\n\rSubscribeO"
+  "HLC\022\026.ohlc.SubscribeRequest\032\n.ohlc.OHLC0"
+  "\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_ohlc_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_ohlc_2eproto = {
-    false,
-    false,
-    328,
-    descriptor_table_protodef_ohlc_2eproto,
+    false, false, 1529, descriptor_table_protodef_ohlc_2eproto,
     "ohlc.proto",
-    &descriptor_table_ohlc_2eproto_once,
-    nullptr,
-    0,
-    3,
-    schemas,
-    file_default_instances,
-    TableStruct_ohlc_2eproto::offsets,
-    file_level_metadata_ohlc_2eproto,
-    file_level_enum_descriptors_ohlc_2eproto,
+    &descriptor_table_ohlc_2eproto_once, nullptr, 0, 11,
+    schemas, file_default_instances, TableStruct_ohlc_2eproto::offsets,
+    file_level_metadata_ohlc_2eproto, file_level_enum_descriptors_ohlc_2eproto,
     file_level_service_descriptors_ohlc_2eproto,
 };
-
-// This function exists to be marked as weak.
-// It can significantly speed up compilation by breaking up LLVM's SCC
-// in the .pb.cc translation units. Large translation units see a
-// reduction of more than 35% of walltime for optimized builds. Without
-// the weak attribute all the messages in the file, including all the
-// vtables and everything they use become part of the same SCC through
-// a cycle like:
-// GetMetadata -> descriptor table -> default instances ->
-//   vtables -> GetMetadata
-// By adding a weak function here we break the connection from the
-// individual vtables back into the descriptor table.
 PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ohlc_2eproto_getter() {
   return &descriptor_table_ohlc_2eproto;
 }
+
 // Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2
-static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ohlc_2eproto(&descriptor_table_ohlc_2eproto);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ohlc_2eproto(&descriptor_table_ohlc_2eproto);
 namespace ohlc {
+
 // ===================================================================
 
 class OHLC::_Internal {
  public:
 };
 
-OHLC::OHLC(::google::protobuf::Arena* arena)
-    : ::google::protobuf::Message(arena) {
-  SharedCtor(arena);
+OHLC::OHLC(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:ohlc.OHLC)
 }
-inline PROTOBUF_NDEBUG_INLINE OHLC::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : stock_code_(arena, from.stock_code_),
-        _cached_size_{0} {}
-
-OHLC::OHLC(
-    ::google::protobuf::Arena* arena,
-    const OHLC& from)
-    : ::google::protobuf::Message(arena) {
-  OHLC* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, open_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, open_),
-           offsetof(Impl_, value_) -
-               offsetof(Impl_, open_) +
-               sizeof(Impl_::value_));
-
+OHLC::OHLC(const OHLC& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OHLC* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stock_code_){}
+    , decltype(_impl_.open_){}
+    , decltype(_impl_.high_){}
+    , decltype(_impl_.low_){}
+    , decltype(_impl_.close_){}
+    , decltype(_impl_.volume_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.start_time_){}
+    , decltype(_impl_.interval_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.stock_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stock_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_stock_code().empty()) {
+    _this->_impl_.stock_code_.Set(from._internal_stock_code(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.open_, &from._impl_.open_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.interval_) -
+    reinterpret_cast<char*>(&_impl_.open_)) + sizeof(_impl_.interval_));
   // @@protoc_insertion_point(copy_constructor:ohlc.OHLC)
 }
-inline PROTOBUF_NDEBUG_INLINE OHLC::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : stock_code_(arena),
-        _cached_size_{0} {}
-
-inline void OHLC::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, open_),
-           0,
-           offsetof(Impl_, value_) -
-               offsetof(Impl_, open_) +
-               sizeof(Impl_::value_));
+
+inline void OHLC::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stock_code_){}
+    , decltype(_impl_.open_){0}
+    , decltype(_impl_.high_){0}
+    , decltype(_impl_.low_){0}
+    , decltype(_impl_.close_){0}
+    , decltype(_impl_.volume_){0}
+    , decltype(_impl_.value_){0}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , decltype(_impl_.start_time_){uint64_t{0u}}
+    , decltype(_impl_.interval_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.stock_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stock_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
+
 OHLC::~OHLC() {
   // @@protoc_insertion_point(destructor:ohlc.OHLC)
-  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
+
 inline void OHLC::SharedDtor() {
-  ABSL_DCHECK(GetArena() == nullptr);
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.stock_code_.Destroy();
-  _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void OHLC::Clear() {
+void OHLC::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OHLC::Clear() {
 // @@protoc_insertion_point(message_clear_start:ohlc.OHLC)
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.stock_code_.ClearToEmpty();
-  ::memset(&_impl_.open_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.value_) -
-      reinterpret_cast<char*>(&_impl_.open_)) + sizeof(_impl_.value_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+  ::memset(&_impl_.open_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.interval_) -
+      reinterpret_cast<char*>(&_impl_.open_)) + sizeof(_impl_.interval_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* OHLC::_InternalParse(
-    const char* ptr, ::_pbi::ParseContext* ctx) {
-  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+const char* OHLC::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double open = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.open_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double high = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.high_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double low = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.low_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double close = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.close_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double volume = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.volume_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double value = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // string stock_code = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_stock_code();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ohlc.OHLC.stock_code"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sequence = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 start_time = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.start_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 interval = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
   return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 7, 0, 28, 2> OHLC::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    7, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967168,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    7,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_OHLC_default_instance_._instance,
-    ::_pbi::TcParser::GenericFallback,  // fallback
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // double open = 1;
-    {::_pbi::TcParser::FastF64S1,
-     {9, 63, 0, PROTOBUF_FIELD_OFFSET(OHLC, _impl_.open_)}},
-    // double high = 2;
-    {::_pbi::TcParser::FastF64S1,
-     {17, 63, 0, PROTOBUF_FIELD_OFFSET(OHLC, _impl_.high_)}},
-    // double low = 3;
-    {::_pbi::TcParser::FastF64S1,
-     {25, 63, 0, PROTOBUF_FIELD_OFFSET(OHLC, _impl_.low_)}},
-    // double close = 4;
-    {::_pbi::TcParser::FastF64S1,
-     {33, 63, 0, PROTOBUF_FIELD_OFFSET(OHLC, _impl_.close_)}},
-    // double volume = 5;
-    {::_pbi::TcParser::FastF64S1,
-     {41, 63, 0, PROTOBUF_FIELD_OFFSET(OHLC, _impl_.volume_)}},
-    // double value = 6;
-    {::_pbi::TcParser::FastF64S1,
-     {49, 63, 0, PROTOBUF_FIELD_OFFSET(OHLC, _impl_.value_)}},
-    // string stock_code = 7;
-    {::_pbi::TcParser::FastUS1,
-     {58, 63, 0, PROTOBUF_FIELD_OFFSET(OHLC, _impl_.stock_code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // double open = 1;
-    {PROTOBUF_FIELD_OFFSET(OHLC, _impl_.open_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // double high = 2;
-    {PROTOBUF_FIELD_OFFSET(OHLC, _impl_.high_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // double low = 3;
-    {PROTOBUF_FIELD_OFFSET(OHLC, _impl_.low_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // double close = 4;
-    {PROTOBUF_FIELD_OFFSET(OHLC, _impl_.close_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // double volume = 5;
-    {PROTOBUF_FIELD_OFFSET(OHLC, _impl_.volume_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // double value = 6;
-    {PROTOBUF_FIELD_OFFSET(OHLC, _impl_.value_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // string stock_code = 7;
-    {PROTOBUF_FIELD_OFFSET(OHLC, _impl_.stock_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\11\0\0\0\0\0\0\12"
-    "ohlc.OHLC"
-    "stock_code"
-  }},
-};
-
-::uint8_t* OHLC::_InternalSerialize(
-    ::uint8_t* target,
-    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+uint8_t* OHLC::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ohlc.OHLC)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
   // double open = 1;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_open = this->_internal_open();
-  ::uint64_t raw_open;
+  uint64_t raw_open;
   memcpy(&raw_open, &tmp_open, sizeof(tmp_open));
   if (raw_open != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-        1, this->_internal_open(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_open(), target);
   }
 
   // double high = 2;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_high = this->_internal_high();
-  ::uint64_t raw_high;
+  uint64_t raw_high;
   memcpy(&raw_high, &tmp_high, sizeof(tmp_high));
   if (raw_high != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-        2, this->_internal_high(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_high(), target);
   }
 
   // double low = 3;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_low = this->_internal_low();
-  ::uint64_t raw_low;
+  uint64_t raw_low;
   memcpy(&raw_low, &tmp_low, sizeof(tmp_low));
   if (raw_low != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-        3, this->_internal_low(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_low(), target);
   }
 
   // double close = 4;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_close = this->_internal_close();
-  ::uint64_t raw_close;
+  uint64_t raw_close;
   memcpy(&raw_close, &tmp_close, sizeof(tmp_close));
   if (raw_close != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-        4, this->_internal_close(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_close(), target);
   }
 
   // double volume = 5;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_volume = this->_internal_volume();
-  ::uint64_t raw_volume;
+  uint64_t raw_volume;
   memcpy(&raw_volume, &tmp_volume, sizeof(tmp_volume));
   if (raw_volume != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-        5, this->_internal_volume(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_volume(), target);
   }
 
   // double value = 6;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_value = this->_internal_value();
-  ::uint64_t raw_value;
+  uint64_t raw_value;
   memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
   if (raw_value != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-        6, this->_internal_value(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_value(), target);
   }
 
   // string stock_code = 7;
   if (!this->_internal_stock_code().empty()) {
-    const std::string& _s = this->_internal_stock_code();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "ohlc.OHLC.stock_code");
-    target = stream->WriteStringMaybeAliased(7, _s, target);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_stock_code().data(), static_cast<int>(this->_internal_stock_code().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ohlc.OHLC.stock_code");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_stock_code(), target);
+  }
+
+  // uint64 sequence = 8;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_sequence(), target);
+  }
+
+  // uint64 start_time = 9;
+  if (this->_internal_start_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_start_time(), target);
+  }
+
+  // uint64 interval = 10;
+  if (this->_internal_interval() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_interval(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:ohlc.OHLC)
   return target;
 }
 
-::size_t OHLC::ByteSizeLong() const {
+size_t OHLC::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ohlc.OHLC)
-  ::size_t total_size = 0;
+  size_t total_size = 0;
 
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string stock_code = 7;
   if (!this->_internal_stock_code().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_stock_code());
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_stock_code());
   }
 
   // double open = 1;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_open = this->_internal_open();
-  ::uint64_t raw_open;
+  uint64_t raw_open;
   memcpy(&raw_open, &tmp_open, sizeof(tmp_open));
   if (raw_open != 0) {
-    total_size += 9;
+    total_size += 1 + 8;
   }
 
   // double high = 2;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_high = this->_internal_high();
-  ::uint64_t raw_high;
+  uint64_t raw_high;
   memcpy(&raw_high, &tmp_high, sizeof(tmp_high));
   if (raw_high != 0) {
-    total_size += 9;
+    total_size += 1 + 8;
   }
 
   // double low = 3;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_low = this->_internal_low();
-  ::uint64_t raw_low;
+  uint64_t raw_low;
   memcpy(&raw_low, &tmp_low, sizeof(tmp_low));
   if (raw_low != 0) {
-    total_size += 9;
+    total_size += 1 + 8;
   }
 
   // double close = 4;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_close = this->_internal_close();
-  ::uint64_t raw_close;
+  uint64_t raw_close;
   memcpy(&raw_close, &tmp_close, sizeof(tmp_close));
   if (raw_close != 0) {
-    total_size += 9;
+    total_size += 1 + 8;
   }
 
   // double volume = 5;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_volume = this->_internal_volume();
-  ::uint64_t raw_volume;
+  uint64_t raw_volume;
   memcpy(&raw_volume, &tmp_volume, sizeof(tmp_volume));
   if (raw_volume != 0) {
-    total_size += 9;
+    total_size += 1 + 8;
   }
 
   // double value = 6;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_value = this->_internal_value();
-  ::uint64_t raw_value;
+  uint64_t raw_value;
   memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
   if (raw_value != 0) {
-    total_size += 9;
+    total_size += 1 + 8;
+  }
+
+  // uint64 sequence = 8;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+  }
+
+  // uint64 start_time = 9;
+  if (this->_internal_start_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_time());
+  }
+
+  // uint64 interval = 10;
+  if (this->_internal_interval() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_interval());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData OHLC::_class_data_ = {
-    OHLC::MergeImpl,
-    nullptr,  // OnDemandRegisterArenaDtor
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OHLC::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OHLC::MergeImpl
 };
-const ::google::protobuf::Message::ClassData* OHLC::GetClassData() const {
-  return &_class_data_;
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OHLC::GetClassData() const { return &_class_data_; }
+
 
-void OHLC::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+void OHLC::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
   auto* const _this = static_cast<OHLC*>(&to_msg);
   auto& from = static_cast<const OHLC&>(from_msg);
   // @@protoc_insertion_point(class_specific_merge_from_start:ohlc.OHLC)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_stock_code().empty()) {
     _this->_internal_set_stock_code(from._internal_stock_code());
   }
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_open = from._internal_open();
-  ::uint64_t raw_open;
+  uint64_t raw_open;
   memcpy(&raw_open, &tmp_open, sizeof(tmp_open));
   if (raw_open != 0) {
     _this->_internal_set_open(from._internal_open());
   }
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_high = from._internal_high();
-  ::uint64_t raw_high;
+  uint64_t raw_high;
   memcpy(&raw_high, &tmp_high, sizeof(tmp_high));
   if (raw_high != 0) {
     _this->_internal_set_high(from._internal_high());
   }
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_low = from._internal_low();
-  ::uint64_t raw_low;
+  uint64_t raw_low;
   memcpy(&raw_low, &tmp_low, sizeof(tmp_low));
   if (raw_low != 0) {
     _this->_internal_set_low(from._internal_low());
   }
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_close = from._internal_close();
-  ::uint64_t raw_close;
+  uint64_t raw_close;
   memcpy(&raw_close, &tmp_close, sizeof(tmp_close));
   if (raw_close != 0) {
     _this->_internal_set_close(from._internal_close());
   }
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_volume = from._internal_volume();
-  ::uint64_t raw_volume;
+  uint64_t raw_volume;
   memcpy(&raw_volume, &tmp_volume, sizeof(tmp_volume));
   if (raw_volume != 0) {
     _this->_internal_set_volume(from._internal_volume());
   }
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_value = from._internal_value();
-  ::uint64_t raw_value;
+  uint64_t raw_value;
   memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
   if (raw_value != 0) {
     _this->_internal_set_value(from._internal_value());
   }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  if (from._internal_start_time() != 0) {
+    _this->_internal_set_start_time(from._internal_start_time());
+  }
+  if (from._internal_interval() != 0) {
+    _this->_internal_set_interval(from._internal_interval());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void OHLC::CopyFrom(const OHLC& from) {
@@ -596,417 +883,2610 @@ void OHLC::CopyFrom(const OHLC& from) {
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool OHLC::IsInitialized() const {
+bool OHLC::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* OHLC::AccessCachedSize() const {
-  return &_impl_._cached_size_;
-}
-void OHLC::InternalSwap(OHLC* PROTOBUF_RESTRICT other) {
+void OHLC::InternalSwap(OHLC* other) {
   using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.stock_code_, &other->_impl_.stock_code_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(OHLC, _impl_.value_)
-      + sizeof(OHLC::_impl_.value_)
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.stock_code_, lhs_arena,
+      &other->_impl_.stock_code_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OHLC, _impl_.interval_)
+      + sizeof(OHLC::_impl_.interval_)
       - PROTOBUF_FIELD_OFFSET(OHLC, _impl_.open_)>(
           reinterpret_cast<char*>(&_impl_.open_),
           reinterpret_cast<char*>(&other->_impl_.open_));
 }
 
-::google::protobuf::Metadata OHLC::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata OHLC::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_ohlc_2eproto_getter, &descriptor_table_ohlc_2eproto_once,
       file_level_metadata_ohlc_2eproto[0]);
 }
+
 // ===================================================================
 
-class StockRequest::_Internal {
+class OHLCFixed::_Internal {
  public:
 };
 
-StockRequest::StockRequest(::google::protobuf::Arena* arena)
-    : ::google::protobuf::Message(arena) {
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:ohlc.StockRequest)
+OHLCFixed::OHLCFixed(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ohlc.OHLCFixed)
 }
-inline PROTOBUF_NDEBUG_INLINE StockRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : stock_code_(arena, from.stock_code_),
-        _cached_size_{0} {}
-
-StockRequest::StockRequest(
-    ::google::protobuf::Arena* arena,
-    const StockRequest& from)
-    : ::google::protobuf::Message(arena) {
-  StockRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-
-  // @@protoc_insertion_point(copy_constructor:ohlc.StockRequest)
+OHLCFixed::OHLCFixed(const OHLCFixed& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OHLCFixed* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stock_code_){}
+    , decltype(_impl_.open_){}
+    , decltype(_impl_.high_){}
+    , decltype(_impl_.low_){}
+    , decltype(_impl_.close_){}
+    , decltype(_impl_.volume_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.price_scale_){}
+    , decltype(_impl_.symbol_id_){}
+    , decltype(_impl_.sequence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.stock_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stock_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_stock_code().empty()) {
+    _this->_impl_.stock_code_.Set(from._internal_stock_code(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.open_, &from._impl_.open_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sequence_) -
+    reinterpret_cast<char*>(&_impl_.open_)) + sizeof(_impl_.sequence_));
+  // @@protoc_insertion_point(copy_constructor:ohlc.OHLCFixed)
 }
-inline PROTOBUF_NDEBUG_INLINE StockRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : stock_code_(arena),
-        _cached_size_{0} {}
 
-inline void StockRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
+inline void OHLCFixed::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stock_code_){}
+    , decltype(_impl_.open_){int64_t{0}}
+    , decltype(_impl_.high_){int64_t{0}}
+    , decltype(_impl_.low_){int64_t{0}}
+    , decltype(_impl_.close_){int64_t{0}}
+    , decltype(_impl_.volume_){int64_t{0}}
+    , decltype(_impl_.value_){int64_t{0}}
+    , decltype(_impl_.price_scale_){0u}
+    , decltype(_impl_.symbol_id_){0u}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.stock_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stock_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
-StockRequest::~StockRequest() {
-  // @@protoc_insertion_point(destructor:ohlc.StockRequest)
-  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+
+OHLCFixed::~OHLCFixed() {
+  // @@protoc_insertion_point(destructor:ohlc.OHLCFixed)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
-inline void StockRequest::SharedDtor() {
-  ABSL_DCHECK(GetArena() == nullptr);
+
+inline void OHLCFixed::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.stock_code_.Destroy();
-  _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void StockRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:ohlc.StockRequest)
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ::uint32_t cached_has_bits = 0;
+void OHLCFixed::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OHLCFixed::Clear() {
+// @@protoc_insertion_point(message_clear_start:ohlc.OHLCFixed)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.stock_code_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+  ::memset(&_impl_.open_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.sequence_) -
+      reinterpret_cast<char*>(&_impl_.open_)) + sizeof(_impl_.sequence_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* StockRequest::_InternalParse(
-    const char* ptr, ::_pbi::ParseContext* ctx) {
-  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+const char* OHLCFixed::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // sint64 open = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.open_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint64 high = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.high_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint64 low = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.low_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint64 close = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.close_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 volume = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.volume_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 value = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 price_scale = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.price_scale_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string stock_code = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_stock_code();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ohlc.OHLCFixed.stock_code"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 symbol_id = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.symbol_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sequence = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
   return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
+uint8_t* OHLCFixed::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ohlc.OHLCFixed)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 36, 2> StockRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_StockRequest_default_instance_._instance,
-    ::_pbi::TcParser::GenericFallback,  // fallback
-  }, {{
-    // string stock_code = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(StockRequest, _impl_.stock_code_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string stock_code = 1;
-    {PROTOBUF_FIELD_OFFSET(StockRequest, _impl_.stock_code_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\21\12\0\0\0\0\0\0"
-    "ohlc.StockRequest"
-    "stock_code"
-  }},
-};
-
-::uint8_t* StockRequest::_InternalSerialize(
-    ::uint8_t* target,
-    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:ohlc.StockRequest)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
+  // sint64 open = 1;
+  if (this->_internal_open() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt64ToArray(1, this->_internal_open(), target);
+  }
 
-  // string stock_code = 1;
+  // sint64 high = 2;
+  if (this->_internal_high() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt64ToArray(2, this->_internal_high(), target);
+  }
+
+  // sint64 low = 3;
+  if (this->_internal_low() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt64ToArray(3, this->_internal_low(), target);
+  }
+
+  // sint64 close = 4;
+  if (this->_internal_close() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt64ToArray(4, this->_internal_close(), target);
+  }
+
+  // int64 volume = 5;
+  if (this->_internal_volume() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_volume(), target);
+  }
+
+  // int64 value = 6;
+  if (this->_internal_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_value(), target);
+  }
+
+  // uint32 price_scale = 7;
+  if (this->_internal_price_scale() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_price_scale(), target);
+  }
+
+  // string stock_code = 8;
   if (!this->_internal_stock_code().empty()) {
-    const std::string& _s = this->_internal_stock_code();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "ohlc.StockRequest.stock_code");
-    target = stream->WriteStringMaybeAliased(1, _s, target);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_stock_code().data(), static_cast<int>(this->_internal_stock_code().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ohlc.OHLCFixed.stock_code");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_stock_code(), target);
+  }
+
+  // uint32 symbol_id = 9;
+  if (this->_internal_symbol_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_symbol_id(), target);
+  }
+
+  // uint64 sequence = 10;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_sequence(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:ohlc.StockRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:ohlc.OHLCFixed)
   return target;
 }
 
-::size_t StockRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ohlc.StockRequest)
-  ::size_t total_size = 0;
+size_t OHLCFixed::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ohlc.OHLCFixed)
+  size_t total_size = 0;
 
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string stock_code = 1;
+  // string stock_code = 8;
   if (!this->_internal_stock_code().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_stock_code());
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_stock_code());
+  }
+
+  // sint64 open = 1;
+  if (this->_internal_open() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt64SizePlusOne(this->_internal_open());
+  }
+
+  // sint64 high = 2;
+  if (this->_internal_high() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt64SizePlusOne(this->_internal_high());
+  }
+
+  // sint64 low = 3;
+  if (this->_internal_low() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt64SizePlusOne(this->_internal_low());
+  }
+
+  // sint64 close = 4;
+  if (this->_internal_close() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt64SizePlusOne(this->_internal_close());
+  }
+
+  // int64 volume = 5;
+  if (this->_internal_volume() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_volume());
+  }
+
+  // int64 value = 6;
+  if (this->_internal_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_value());
+  }
+
+  // uint32 price_scale = 7;
+  if (this->_internal_price_scale() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_price_scale());
+  }
+
+  // uint32 symbol_id = 9;
+  if (this->_internal_symbol_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_symbol_id());
+  }
+
+  // uint64 sequence = 10;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData StockRequest::_class_data_ = {
-    StockRequest::MergeImpl,
-    nullptr,  // OnDemandRegisterArenaDtor
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OHLCFixed::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OHLCFixed::MergeImpl
 };
-const ::google::protobuf::Message::ClassData* StockRequest::GetClassData() const {
-  return &_class_data_;
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OHLCFixed::GetClassData() const { return &_class_data_; }
 
-void StockRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<StockRequest*>(&to_msg);
-  auto& from = static_cast<const StockRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:ohlc.StockRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+
+void OHLCFixed::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OHLCFixed*>(&to_msg);
+  auto& from = static_cast<const OHLCFixed&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ohlc.OHLCFixed)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_stock_code().empty()) {
     _this->_internal_set_stock_code(from._internal_stock_code());
   }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_open() != 0) {
+    _this->_internal_set_open(from._internal_open());
+  }
+  if (from._internal_high() != 0) {
+    _this->_internal_set_high(from._internal_high());
+  }
+  if (from._internal_low() != 0) {
+    _this->_internal_set_low(from._internal_low());
+  }
+  if (from._internal_close() != 0) {
+    _this->_internal_set_close(from._internal_close());
+  }
+  if (from._internal_volume() != 0) {
+    _this->_internal_set_volume(from._internal_volume());
+  }
+  if (from._internal_value() != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_price_scale() != 0) {
+    _this->_internal_set_price_scale(from._internal_price_scale());
+  }
+  if (from._internal_symbol_id() != 0) {
+    _this->_internal_set_symbol_id(from._internal_symbol_id());
+  }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void StockRequest::CopyFrom(const StockRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ohlc.StockRequest)
+void OHLCFixed::CopyFrom(const OHLCFixed& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ohlc.OHLCFixed)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool StockRequest::IsInitialized() const {
+bool OHLCFixed::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* StockRequest::AccessCachedSize() const {
-  return &_impl_._cached_size_;
-}
-void StockRequest::InternalSwap(StockRequest* PROTOBUF_RESTRICT other) {
+void OHLCFixed::InternalSwap(OHLCFixed* other) {
   using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.stock_code_, &other->_impl_.stock_code_, arena);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.stock_code_, lhs_arena,
+      &other->_impl_.stock_code_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OHLCFixed, _impl_.sequence_)
+      + sizeof(OHLCFixed::_impl_.sequence_)
+      - PROTOBUF_FIELD_OFFSET(OHLCFixed, _impl_.open_)>(
+          reinterpret_cast<char*>(&_impl_.open_),
+          reinterpret_cast<char*>(&other->_impl_.open_));
 }
 
-::google::protobuf::Metadata StockRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata OHLCFixed::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_ohlc_2eproto_getter, &descriptor_table_ohlc_2eproto_once,
       file_level_metadata_ohlc_2eproto[1]);
 }
+
 // ===================================================================
 
-class SendOHLCResponse::_Internal {
+OHLCColumns_SymbolNamesEntry_DoNotUse::OHLCColumns_SymbolNamesEntry_DoNotUse() {}
+OHLCColumns_SymbolNamesEntry_DoNotUse::OHLCColumns_SymbolNamesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void OHLCColumns_SymbolNamesEntry_DoNotUse::MergeFrom(const OHLCColumns_SymbolNamesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata OHLCColumns_SymbolNamesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ohlc_2eproto_getter, &descriptor_table_ohlc_2eproto_once,
+      file_level_metadata_ohlc_2eproto[2]);
+}
+
+// ===================================================================
+
+class OHLCColumns::_Internal {
  public:
 };
 
-SendOHLCResponse::SendOHLCResponse(::google::protobuf::Arena* arena)
-    : ::google::protobuf::Message(arena) {
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:ohlc.SendOHLCResponse)
+OHLCColumns::OHLCColumns(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &OHLCColumns::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:ohlc.OHLCColumns)
 }
-inline PROTOBUF_NDEBUG_INLINE SendOHLCResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : message_(arena, from.message_),
-        _cached_size_{0} {}
-
-SendOHLCResponse::SendOHLCResponse(
-    ::google::protobuf::Arena* arena,
-    const SendOHLCResponse& from)
-    : ::google::protobuf::Message(arena) {
-  SendOHLCResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-
-  // @@protoc_insertion_point(copy_constructor:ohlc.SendOHLCResponse)
+OHLCColumns::OHLCColumns(const OHLCColumns& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OHLCColumns* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.symbol_names_)*/{}
+    , decltype(_impl_.symbol_ids_){from._impl_.symbol_ids_}
+    , /*decltype(_impl_._symbol_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.open_){from._impl_.open_}
+    , /*decltype(_impl_._open_cached_byte_size_)*/{0}
+    , decltype(_impl_.high_minus_open_){from._impl_.high_minus_open_}
+    , /*decltype(_impl_._high_minus_open_cached_byte_size_)*/{0}
+    , decltype(_impl_.low_minus_open_){from._impl_.low_minus_open_}
+    , /*decltype(_impl_._low_minus_open_cached_byte_size_)*/{0}
+    , decltype(_impl_.close_minus_open_){from._impl_.close_minus_open_}
+    , /*decltype(_impl_._close_minus_open_cached_byte_size_)*/{0}
+    , decltype(_impl_.volume_){from._impl_.volume_}
+    , /*decltype(_impl_._volume_cached_byte_size_)*/{0}
+    , decltype(_impl_.value_){from._impl_.value_}
+    , /*decltype(_impl_._value_cached_byte_size_)*/{0}
+    , decltype(_impl_.sequence_){from._impl_.sequence_}
+    , /*decltype(_impl_._sequence_cached_byte_size_)*/{0}
+    , decltype(_impl_.price_scale_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.symbol_names_.MergeFrom(from._impl_.symbol_names_);
+  _this->_impl_.price_scale_ = from._impl_.price_scale_;
+  // @@protoc_insertion_point(copy_constructor:ohlc.OHLCColumns)
 }
-inline PROTOBUF_NDEBUG_INLINE SendOHLCResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : message_(arena),
-        _cached_size_{0} {}
 
-inline void SendOHLCResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
+inline void OHLCColumns::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.symbol_names_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.symbol_ids_){arena}
+    , /*decltype(_impl_._symbol_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.open_){arena}
+    , /*decltype(_impl_._open_cached_byte_size_)*/{0}
+    , decltype(_impl_.high_minus_open_){arena}
+    , /*decltype(_impl_._high_minus_open_cached_byte_size_)*/{0}
+    , decltype(_impl_.low_minus_open_){arena}
+    , /*decltype(_impl_._low_minus_open_cached_byte_size_)*/{0}
+    , decltype(_impl_.close_minus_open_){arena}
+    , /*decltype(_impl_._close_minus_open_cached_byte_size_)*/{0}
+    , decltype(_impl_.volume_){arena}
+    , /*decltype(_impl_._volume_cached_byte_size_)*/{0}
+    , decltype(_impl_.value_){arena}
+    , /*decltype(_impl_._value_cached_byte_size_)*/{0}
+    , decltype(_impl_.sequence_){arena}
+    , /*decltype(_impl_._sequence_cached_byte_size_)*/{0}
+    , decltype(_impl_.price_scale_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
-SendOHLCResponse::~SendOHLCResponse() {
-  // @@protoc_insertion_point(destructor:ohlc.SendOHLCResponse)
-  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+
+OHLCColumns::~OHLCColumns() {
+  // @@protoc_insertion_point(destructor:ohlc.OHLCColumns)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
   SharedDtor();
 }
-inline void SendOHLCResponse::SharedDtor() {
-  ABSL_DCHECK(GetArena() == nullptr);
-  _impl_.message_.Destroy();
-  _impl_.~Impl_();
+
+inline void OHLCColumns::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.symbol_names_.Destruct();
+  _impl_.symbol_names_.~MapField();
+  _impl_.symbol_ids_.~RepeatedField();
+  _impl_.open_.~RepeatedField();
+  _impl_.high_minus_open_.~RepeatedField();
+  _impl_.low_minus_open_.~RepeatedField();
+  _impl_.close_minus_open_.~RepeatedField();
+  _impl_.volume_.~RepeatedField();
+  _impl_.value_.~RepeatedField();
+  _impl_.sequence_.~RepeatedField();
 }
 
-PROTOBUF_NOINLINE void SendOHLCResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:ohlc.SendOHLCResponse)
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ::uint32_t cached_has_bits = 0;
+void OHLCColumns::ArenaDtor(void* object) {
+  OHLCColumns* _this = reinterpret_cast< OHLCColumns* >(object);
+  _this->_impl_.symbol_names_.Destruct();
+}
+void OHLCColumns::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OHLCColumns::Clear() {
+// @@protoc_insertion_point(message_clear_start:ohlc.OHLCColumns)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.message_.ClearToEmpty();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+  _impl_.symbol_names_.Clear();
+  _impl_.symbol_ids_.Clear();
+  _impl_.open_.Clear();
+  _impl_.high_minus_open_.Clear();
+  _impl_.low_minus_open_.Clear();
+  _impl_.close_minus_open_.Clear();
+  _impl_.volume_.Clear();
+  _impl_.value_.Clear();
+  _impl_.sequence_.Clear();
+  _impl_.price_scale_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SendOHLCResponse::_InternalParse(
-    const char* ptr, ::_pbi::ParseContext* ctx) {
-  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+const char* OHLCColumns::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 price_scale = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.price_scale_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, string> symbol_names = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.symbol_names_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 symbol_ids = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_symbol_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_symbol_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint64 open = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(_internal_mutable_open(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_open(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint64 high_minus_open = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(_internal_mutable_high_minus_open(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_high_minus_open(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint64 low_minus_open = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(_internal_mutable_low_minus_open(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_low_minus_open(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint64 close_minus_open = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(_internal_mutable_close_minus_open(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_close_minus_open(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 volume = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_volume(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_volume(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 value = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_value(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 sequence = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_sequence(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 80) {
+          _internal_add_sequence(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
   return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
+uint8_t* OHLCColumns::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ohlc.OHLCColumns)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 price_scale = 1;
+  if (this->_internal_price_scale() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_price_scale(), target);
+  }
+
+  // map<uint32, string> symbol_names = 2;
+  if (!this->_internal_symbol_names().empty()) {
+    using MapType = ::_pb::Map<uint32_t, std::string>;
+    using WireHelper = OHLCColumns_SymbolNamesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_symbol_names();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "ohlc.OHLCColumns.SymbolNamesEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
 
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 37, 2> SendOHLCResponse::_table_ = {
+  // repeated uint32 symbol_ids = 3;
   {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_SendOHLCResponse_default_instance_._instance,
-    ::_pbi::TcParser::GenericFallback,  // fallback
-  }, {{
-    // string message = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(SendOHLCResponse, _impl_.message_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string message = 1;
-    {PROTOBUF_FIELD_OFFSET(SendOHLCResponse, _impl_.message_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\25\7\0\0\0\0\0\0"
-    "ohlc.SendOHLCResponse"
-    "message"
-  }},
-};
-
-::uint8_t* SendOHLCResponse::_InternalSerialize(
-    ::uint8_t* target,
-    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:ohlc.SendOHLCResponse)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
+    int byte_size = _impl_._symbol_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_symbol_ids(), byte_size, target);
+    }
+  }
 
-  // string message = 1;
-  if (!this->_internal_message().empty()) {
-    const std::string& _s = this->_internal_message();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "ohlc.SendOHLCResponse.message");
-    target = stream->WriteStringMaybeAliased(1, _s, target);
+  // repeated sint64 open = 4;
+  {
+    int byte_size = _impl_._open_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt64Packed(
+          4, _internal_open(), byte_size, target);
+    }
+  }
+
+  // repeated sint64 high_minus_open = 5;
+  {
+    int byte_size = _impl_._high_minus_open_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt64Packed(
+          5, _internal_high_minus_open(), byte_size, target);
+    }
+  }
+
+  // repeated sint64 low_minus_open = 6;
+  {
+    int byte_size = _impl_._low_minus_open_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt64Packed(
+          6, _internal_low_minus_open(), byte_size, target);
+    }
+  }
+
+  // repeated sint64 close_minus_open = 7;
+  {
+    int byte_size = _impl_._close_minus_open_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt64Packed(
+          7, _internal_close_minus_open(), byte_size, target);
+    }
+  }
+
+  // repeated int64 volume = 8;
+  {
+    int byte_size = _impl_._volume_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          8, _internal_volume(), byte_size, target);
+    }
+  }
+
+  // repeated int64 value = 9;
+  {
+    int byte_size = _impl_._value_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          9, _internal_value(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 sequence = 10;
+  {
+    int byte_size = _impl_._sequence_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          10, _internal_sequence(), byte_size, target);
+    }
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:ohlc.SendOHLCResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:ohlc.OHLCColumns)
   return target;
 }
 
-::size_t SendOHLCResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ohlc.SendOHLCResponse)
-  ::size_t total_size = 0;
+size_t OHLCColumns::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ohlc.OHLCColumns)
+  size_t total_size = 0;
 
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string message = 1;
-  if (!this->_internal_message().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_message());
+  // map<uint32, string> symbol_names = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_symbol_names_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, std::string >::const_iterator
+      it = this->_internal_symbol_names().begin();
+      it != this->_internal_symbol_names().end(); ++it) {
+    total_size += OHLCColumns_SymbolNamesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
+  // repeated uint32 symbol_ids = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.symbol_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._symbol_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-const ::google::protobuf::Message::ClassData SendOHLCResponse::_class_data_ = {
-    SendOHLCResponse::MergeImpl,
-    nullptr,  // OnDemandRegisterArenaDtor
-};
-const ::google::protobuf::Message::ClassData* SendOHLCResponse::GetClassData() const {
-  return &_class_data_;
-}
+  // repeated sint64 open = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt64Size(this->_impl_.open_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._open_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-void SendOHLCResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<SendOHLCResponse*>(&to_msg);
-  auto& from = static_cast<const SendOHLCResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:ohlc.SendOHLCResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
+  // repeated sint64 high_minus_open = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt64Size(this->_impl_.high_minus_open_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._high_minus_open_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-  if (!from._internal_message().empty()) {
-    _this->_internal_set_message(from._internal_message());
+  // repeated sint64 low_minus_open = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt64Size(this->_impl_.low_minus_open_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._low_minus_open_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
 
-void SendOHLCResponse::CopyFrom(const SendOHLCResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ohlc.SendOHLCResponse)
+  // repeated sint64 close_minus_open = 7;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt64Size(this->_impl_.close_minus_open_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._close_minus_open_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int64 volume = 8;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.volume_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._volume_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int64 value = 9;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.value_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._value_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 sequence = 10;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.sequence_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._sequence_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint32 price_scale = 1;
+  if (this->_internal_price_scale() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_price_scale());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OHLCColumns::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OHLCColumns::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OHLCColumns::GetClassData() const { return &_class_data_; }
+
+
+void OHLCColumns::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OHLCColumns*>(&to_msg);
+  auto& from = static_cast<const OHLCColumns&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ohlc.OHLCColumns)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.symbol_names_.MergeFrom(from._impl_.symbol_names_);
+  _this->_impl_.symbol_ids_.MergeFrom(from._impl_.symbol_ids_);
+  _this->_impl_.open_.MergeFrom(from._impl_.open_);
+  _this->_impl_.high_minus_open_.MergeFrom(from._impl_.high_minus_open_);
+  _this->_impl_.low_minus_open_.MergeFrom(from._impl_.low_minus_open_);
+  _this->_impl_.close_minus_open_.MergeFrom(from._impl_.close_minus_open_);
+  _this->_impl_.volume_.MergeFrom(from._impl_.volume_);
+  _this->_impl_.value_.MergeFrom(from._impl_.value_);
+  _this->_impl_.sequence_.MergeFrom(from._impl_.sequence_);
+  if (from._internal_price_scale() != 0) {
+    _this->_internal_set_price_scale(from._internal_price_scale());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OHLCColumns::CopyFrom(const OHLCColumns& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ohlc.OHLCColumns)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OHLCColumns::IsInitialized() const {
+  return true;
+}
+
+void OHLCColumns::InternalSwap(OHLCColumns* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.symbol_names_.InternalSwap(&other->_impl_.symbol_names_);
+  _impl_.symbol_ids_.InternalSwap(&other->_impl_.symbol_ids_);
+  _impl_.open_.InternalSwap(&other->_impl_.open_);
+  _impl_.high_minus_open_.InternalSwap(&other->_impl_.high_minus_open_);
+  _impl_.low_minus_open_.InternalSwap(&other->_impl_.low_minus_open_);
+  _impl_.close_minus_open_.InternalSwap(&other->_impl_.close_minus_open_);
+  _impl_.volume_.InternalSwap(&other->_impl_.volume_);
+  _impl_.value_.InternalSwap(&other->_impl_.value_);
+  _impl_.sequence_.InternalSwap(&other->_impl_.sequence_);
+  swap(_impl_.price_scale_, other->_impl_.price_scale_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OHLCColumns::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ohlc_2eproto_getter, &descriptor_table_ohlc_2eproto_once,
+      file_level_metadata_ohlc_2eproto[3]);
+}
+
+// ===================================================================
+
+class StockRequest::_Internal {
+ public:
+};
+
+StockRequest::StockRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ohlc.StockRequest)
+}
+StockRequest::StockRequest(const StockRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StockRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stock_code_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.stock_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stock_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_stock_code().empty()) {
+    _this->_impl_.stock_code_.Set(from._internal_stock_code(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:ohlc.StockRequest)
+}
+
+inline void StockRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stock_code_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.stock_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stock_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StockRequest::~StockRequest() {
+  // @@protoc_insertion_point(destructor:ohlc.StockRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StockRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stock_code_.Destroy();
+}
+
+void StockRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StockRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:ohlc.StockRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stock_code_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StockRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string stock_code = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_stock_code();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ohlc.StockRequest.stock_code"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StockRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ohlc.StockRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string stock_code = 1;
+  if (!this->_internal_stock_code().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_stock_code().data(), static_cast<int>(this->_internal_stock_code().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ohlc.StockRequest.stock_code");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_stock_code(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ohlc.StockRequest)
+  return target;
+}
+
+size_t StockRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ohlc.StockRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string stock_code = 1;
+  if (!this->_internal_stock_code().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_stock_code());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StockRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StockRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StockRequest::GetClassData() const { return &_class_data_; }
+
+
+void StockRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StockRequest*>(&to_msg);
+  auto& from = static_cast<const StockRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ohlc.StockRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_stock_code().empty()) {
+    _this->_internal_set_stock_code(from._internal_stock_code());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StockRequest::CopyFrom(const StockRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ohlc.StockRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StockRequest::IsInitialized() const {
+  return true;
+}
+
+void StockRequest::InternalSwap(StockRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.stock_code_, lhs_arena,
+      &other->_impl_.stock_code_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StockRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ohlc_2eproto_getter, &descriptor_table_ohlc_2eproto_once,
+      file_level_metadata_ohlc_2eproto[4]);
+}
+
+// ===================================================================
+
+class StockBatchRequest::_Internal {
+ public:
+};
+
+StockBatchRequest::StockBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ohlc.StockBatchRequest)
+}
+StockBatchRequest::StockBatchRequest(const StockBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StockBatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stock_codes_){from._impl_.stock_codes_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ohlc.StockBatchRequest)
+}
+
+inline void StockBatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stock_codes_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StockBatchRequest::~StockBatchRequest() {
+  // @@protoc_insertion_point(destructor:ohlc.StockBatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StockBatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stock_codes_.~RepeatedPtrField();
+}
+
+void StockBatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StockBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:ohlc.StockBatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stock_codes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StockBatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string stock_codes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_stock_codes();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "ohlc.StockBatchRequest.stock_codes"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StockBatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ohlc.StockBatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string stock_codes = 1;
+  for (int i = 0, n = this->_internal_stock_codes_size(); i < n; i++) {
+    const auto& s = this->_internal_stock_codes(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ohlc.StockBatchRequest.stock_codes");
+    target = stream->WriteString(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ohlc.StockBatchRequest)
+  return target;
+}
+
+size_t StockBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ohlc.StockBatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string stock_codes = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.stock_codes_.size());
+  for (int i = 0, n = _impl_.stock_codes_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.stock_codes_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StockBatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StockBatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StockBatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void StockBatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StockBatchRequest*>(&to_msg);
+  auto& from = static_cast<const StockBatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ohlc.StockBatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stock_codes_.MergeFrom(from._impl_.stock_codes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StockBatchRequest::CopyFrom(const StockBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ohlc.StockBatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StockBatchRequest::IsInitialized() const {
+  return true;
+}
+
+void StockBatchRequest::InternalSwap(StockBatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.stock_codes_.InternalSwap(&other->_impl_.stock_codes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StockBatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ohlc_2eproto_getter, &descriptor_table_ohlc_2eproto_once,
+      file_level_metadata_ohlc_2eproto[5]);
+}
+
+// ===================================================================
+
+class OHLCBatch::_Internal {
+ public:
+};
+
+OHLCBatch::OHLCBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ohlc.OHLCBatch)
+}
+OHLCBatch::OHLCBatch(const OHLCBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OHLCBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.candles_){from._impl_.candles_}
+    , decltype(_impl_.missing_codes_){from._impl_.missing_codes_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ohlc.OHLCBatch)
+}
+
+inline void OHLCBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.candles_){arena}
+    , decltype(_impl_.missing_codes_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+OHLCBatch::~OHLCBatch() {
+  // @@protoc_insertion_point(destructor:ohlc.OHLCBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OHLCBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.candles_.~RepeatedPtrField();
+  _impl_.missing_codes_.~RepeatedPtrField();
+}
+
+void OHLCBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OHLCBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:ohlc.OHLCBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.candles_.Clear();
+  _impl_.missing_codes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OHLCBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .ohlc.OHLC candles = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_candles(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string missing_codes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_missing_codes();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "ohlc.OHLCBatch.missing_codes"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OHLCBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ohlc.OHLCBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .ohlc.OHLC candles = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_candles_size()); i < n; i++) {
+    const auto& repfield = this->_internal_candles(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated string missing_codes = 2;
+  for (int i = 0, n = this->_internal_missing_codes_size(); i < n; i++) {
+    const auto& s = this->_internal_missing_codes(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ohlc.OHLCBatch.missing_codes");
+    target = stream->WriteString(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ohlc.OHLCBatch)
+  return target;
+}
+
+size_t OHLCBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ohlc.OHLCBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ohlc.OHLC candles = 1;
+  total_size += 1UL * this->_internal_candles_size();
+  for (const auto& msg : this->_impl_.candles_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated string missing_codes = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.missing_codes_.size());
+  for (int i = 0, n = _impl_.missing_codes_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.missing_codes_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OHLCBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OHLCBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OHLCBatch::GetClassData() const { return &_class_data_; }
+
+
+void OHLCBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OHLCBatch*>(&to_msg);
+  auto& from = static_cast<const OHLCBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ohlc.OHLCBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.candles_.MergeFrom(from._impl_.candles_);
+  _this->_impl_.missing_codes_.MergeFrom(from._impl_.missing_codes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OHLCBatch::CopyFrom(const OHLCBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ohlc.OHLCBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OHLCBatch::IsInitialized() const {
+  return true;
+}
+
+void OHLCBatch::InternalSwap(OHLCBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.candles_.InternalSwap(&other->_impl_.candles_);
+  _impl_.missing_codes_.InternalSwap(&other->_impl_.missing_codes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OHLCBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ohlc_2eproto_getter, &descriptor_table_ohlc_2eproto_once,
+      file_level_metadata_ohlc_2eproto[6]);
+}
+
+// ===================================================================
+
+class OHLCRangeRequest::_Internal {
+ public:
+};
+
+OHLCRangeRequest::OHLCRangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ohlc.OHLCRangeRequest)
+}
+OHLCRangeRequest::OHLCRangeRequest(const OHLCRangeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OHLCRangeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stock_code_){}
+    , decltype(_impl_.interval_){}
+    , decltype(_impl_.from_time_){}
+    , decltype(_impl_.to_time_){}
+    , decltype(_impl_.page_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.stock_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stock_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_stock_code().empty()) {
+    _this->_impl_.stock_code_.Set(from._internal_stock_code(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.interval_, &from._impl_.interval_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.page_size_) -
+    reinterpret_cast<char*>(&_impl_.interval_)) + sizeof(_impl_.page_size_));
+  // @@protoc_insertion_point(copy_constructor:ohlc.OHLCRangeRequest)
+}
+
+inline void OHLCRangeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stock_code_){}
+    , decltype(_impl_.interval_){uint64_t{0u}}
+    , decltype(_impl_.from_time_){uint64_t{0u}}
+    , decltype(_impl_.to_time_){uint64_t{0u}}
+    , decltype(_impl_.page_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.stock_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stock_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+OHLCRangeRequest::~OHLCRangeRequest() {
+  // @@protoc_insertion_point(destructor:ohlc.OHLCRangeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OHLCRangeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stock_code_.Destroy();
+}
+
+void OHLCRangeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OHLCRangeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:ohlc.OHLCRangeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stock_code_.ClearToEmpty();
+  ::memset(&_impl_.interval_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.page_size_) -
+      reinterpret_cast<char*>(&_impl_.interval_)) + sizeof(_impl_.page_size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OHLCRangeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string stock_code = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_stock_code();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ohlc.OHLCRangeRequest.stock_code"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 interval = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 from_time = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.from_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 to_time = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.to_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 page_size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.page_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OHLCRangeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ohlc.OHLCRangeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string stock_code = 1;
+  if (!this->_internal_stock_code().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_stock_code().data(), static_cast<int>(this->_internal_stock_code().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ohlc.OHLCRangeRequest.stock_code");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_stock_code(), target);
+  }
+
+  // uint64 interval = 2;
+  if (this->_internal_interval() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_interval(), target);
+  }
+
+  // uint64 from_time = 3;
+  if (this->_internal_from_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_from_time(), target);
+  }
+
+  // uint64 to_time = 4;
+  if (this->_internal_to_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_to_time(), target);
+  }
+
+  // uint32 page_size = 5;
+  if (this->_internal_page_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_page_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ohlc.OHLCRangeRequest)
+  return target;
+}
+
+size_t OHLCRangeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ohlc.OHLCRangeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string stock_code = 1;
+  if (!this->_internal_stock_code().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_stock_code());
+  }
+
+  // uint64 interval = 2;
+  if (this->_internal_interval() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_interval());
+  }
+
+  // uint64 from_time = 3;
+  if (this->_internal_from_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_from_time());
+  }
+
+  // uint64 to_time = 4;
+  if (this->_internal_to_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_to_time());
+  }
+
+  // uint32 page_size = 5;
+  if (this->_internal_page_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_page_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OHLCRangeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OHLCRangeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OHLCRangeRequest::GetClassData() const { return &_class_data_; }
+
+
+void OHLCRangeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OHLCRangeRequest*>(&to_msg);
+  auto& from = static_cast<const OHLCRangeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ohlc.OHLCRangeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_stock_code().empty()) {
+    _this->_internal_set_stock_code(from._internal_stock_code());
+  }
+  if (from._internal_interval() != 0) {
+    _this->_internal_set_interval(from._internal_interval());
+  }
+  if (from._internal_from_time() != 0) {
+    _this->_internal_set_from_time(from._internal_from_time());
+  }
+  if (from._internal_to_time() != 0) {
+    _this->_internal_set_to_time(from._internal_to_time());
+  }
+  if (from._internal_page_size() != 0) {
+    _this->_internal_set_page_size(from._internal_page_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OHLCRangeRequest::CopyFrom(const OHLCRangeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ohlc.OHLCRangeRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool SendOHLCResponse::IsInitialized() const {
+bool OHLCRangeRequest::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* SendOHLCResponse::AccessCachedSize() const {
-  return &_impl_._cached_size_;
+void OHLCRangeRequest::InternalSwap(OHLCRangeRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.stock_code_, lhs_arena,
+      &other->_impl_.stock_code_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OHLCRangeRequest, _impl_.page_size_)
+      + sizeof(OHLCRangeRequest::_impl_.page_size_)
+      - PROTOBUF_FIELD_OFFSET(OHLCRangeRequest, _impl_.interval_)>(
+          reinterpret_cast<char*>(&_impl_.interval_),
+          reinterpret_cast<char*>(&other->_impl_.interval_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OHLCRangeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ohlc_2eproto_getter, &descriptor_table_ohlc_2eproto_once,
+      file_level_metadata_ohlc_2eproto[7]);
+}
+
+// ===================================================================
+
+class OHLCPage::_Internal {
+ public:
+};
+
+OHLCPage::OHLCPage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ohlc.OHLCPage)
+}
+OHLCPage::OHLCPage(const OHLCPage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OHLCPage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.candles_){from._impl_.candles_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ohlc.OHLCPage)
+}
+
+inline void OHLCPage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.candles_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+OHLCPage::~OHLCPage() {
+  // @@protoc_insertion_point(destructor:ohlc.OHLCPage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OHLCPage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.candles_.~RepeatedPtrField();
+}
+
+void OHLCPage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OHLCPage::Clear() {
+// @@protoc_insertion_point(message_clear_start:ohlc.OHLCPage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.candles_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OHLCPage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .ohlc.OHLC candles = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_candles(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OHLCPage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ohlc.OHLCPage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .ohlc.OHLC candles = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_candles_size()); i < n; i++) {
+    const auto& repfield = this->_internal_candles(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ohlc.OHLCPage)
+  return target;
+}
+
+size_t OHLCPage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ohlc.OHLCPage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ohlc.OHLC candles = 1;
+  total_size += 1UL * this->_internal_candles_size();
+  for (const auto& msg : this->_impl_.candles_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OHLCPage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OHLCPage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OHLCPage::GetClassData() const { return &_class_data_; }
+
+
+void OHLCPage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OHLCPage*>(&to_msg);
+  auto& from = static_cast<const OHLCPage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ohlc.OHLCPage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.candles_.MergeFrom(from._impl_.candles_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OHLCPage::CopyFrom(const OHLCPage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ohlc.OHLCPage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OHLCPage::IsInitialized() const {
+  return true;
 }
-void SendOHLCResponse::InternalSwap(SendOHLCResponse* PROTOBUF_RESTRICT other) {
+
+void OHLCPage::InternalSwap(OHLCPage* other) {
   using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.message_, &other->_impl_.message_, arena);
+  _impl_.candles_.InternalSwap(&other->_impl_.candles_);
 }
 
-::google::protobuf::Metadata SendOHLCResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata OHLCPage::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_ohlc_2eproto_getter, &descriptor_table_ohlc_2eproto_once,
-      file_level_metadata_ohlc_2eproto[2]);
+      file_level_metadata_ohlc_2eproto[8]);
+}
+
+// ===================================================================
+
+class SubscribeRequest::_Internal {
+ public:
+};
+
+SubscribeRequest::SubscribeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ohlc.SubscribeRequest)
+}
+SubscribeRequest::SubscribeRequest(const SubscribeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SubscribeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stock_codes_){from._impl_.stock_codes_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ohlc.SubscribeRequest)
+}
+
+inline void SubscribeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stock_codes_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SubscribeRequest::~SubscribeRequest() {
+  // @@protoc_insertion_point(destructor:ohlc.SubscribeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubscribeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stock_codes_.~RepeatedPtrField();
+}
+
+void SubscribeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubscribeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:ohlc.SubscribeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stock_codes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SubscribeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string stock_codes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_stock_codes();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "ohlc.SubscribeRequest.stock_codes"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubscribeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ohlc.SubscribeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string stock_codes = 1;
+  for (int i = 0, n = this->_internal_stock_codes_size(); i < n; i++) {
+    const auto& s = this->_internal_stock_codes(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ohlc.SubscribeRequest.stock_codes");
+    target = stream->WriteString(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ohlc.SubscribeRequest)
+  return target;
+}
+
+size_t SubscribeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ohlc.SubscribeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string stock_codes = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.stock_codes_.size());
+  for (int i = 0, n = _impl_.stock_codes_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.stock_codes_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SubscribeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SubscribeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SubscribeRequest::GetClassData() const { return &_class_data_; }
+
+
+void SubscribeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SubscribeRequest*>(&to_msg);
+  auto& from = static_cast<const SubscribeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ohlc.SubscribeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stock_codes_.MergeFrom(from._impl_.stock_codes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SubscribeRequest::CopyFrom(const SubscribeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ohlc.SubscribeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubscribeRequest::IsInitialized() const {
+  return true;
+}
+
+void SubscribeRequest::InternalSwap(SubscribeRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.stock_codes_.InternalSwap(&other->_impl_.stock_codes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SubscribeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ohlc_2eproto_getter, &descriptor_table_ohlc_2eproto_once,
+      file_level_metadata_ohlc_2eproto[9]);
+}
+
+// ===================================================================
+
+class SendOHLCResponse::_Internal {
+ public:
+};
+
+SendOHLCResponse::SendOHLCResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ohlc.SendOHLCResponse)
+}
+SendOHLCResponse::SendOHLCResponse(const SendOHLCResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SendOHLCResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_message().empty()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:ohlc.SendOHLCResponse)
+}
+
+inline void SendOHLCResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SendOHLCResponse::~SendOHLCResponse() {
+  // @@protoc_insertion_point(destructor:ohlc.SendOHLCResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SendOHLCResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+}
+
+void SendOHLCResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SendOHLCResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:ohlc.SendOHLCResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.message_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SendOHLCResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string message = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ohlc.SendOHLCResponse.message"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SendOHLCResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ohlc.SendOHLCResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string message = 1;
+  if (!this->_internal_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ohlc.SendOHLCResponse.message");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ohlc.SendOHLCResponse)
+  return target;
+}
+
+size_t SendOHLCResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ohlc.SendOHLCResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string message = 1;
+  if (!this->_internal_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SendOHLCResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SendOHLCResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SendOHLCResponse::GetClassData() const { return &_class_data_; }
+
+
+void SendOHLCResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SendOHLCResponse*>(&to_msg);
+  auto& from = static_cast<const SendOHLCResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ohlc.SendOHLCResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_message().empty()) {
+    _this->_internal_set_message(from._internal_message());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SendOHLCResponse::CopyFrom(const SendOHLCResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ohlc.SendOHLCResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SendOHLCResponse::IsInitialized() const {
+  return true;
+}
+
+void SendOHLCResponse::InternalSwap(SendOHLCResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SendOHLCResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ohlc_2eproto_getter, &descriptor_table_ohlc_2eproto_once,
+      file_level_metadata_ohlc_2eproto[10]);
 }
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace ohlc
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ohlc::OHLC*
+Arena::CreateMaybeMessage< ::ohlc::OHLC >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ohlc::OHLC >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ohlc::OHLCFixed*
+Arena::CreateMaybeMessage< ::ohlc::OHLCFixed >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ohlc::OHLCFixed >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ohlc::OHLCColumns_SymbolNamesEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::ohlc::OHLCColumns_SymbolNamesEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ohlc::OHLCColumns_SymbolNamesEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ohlc::OHLCColumns*
+Arena::CreateMaybeMessage< ::ohlc::OHLCColumns >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ohlc::OHLCColumns >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ohlc::StockRequest*
+Arena::CreateMaybeMessage< ::ohlc::StockRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ohlc::StockRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ohlc::StockBatchRequest*
+Arena::CreateMaybeMessage< ::ohlc::StockBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ohlc::StockBatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ohlc::OHLCBatch*
+Arena::CreateMaybeMessage< ::ohlc::OHLCBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ohlc::OHLCBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ohlc::OHLCRangeRequest*
+Arena::CreateMaybeMessage< ::ohlc::OHLCRangeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ohlc::OHLCRangeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ohlc::OHLCPage*
+Arena::CreateMaybeMessage< ::ohlc::OHLCPage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ohlc::OHLCPage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ohlc::SubscribeRequest*
+Arena::CreateMaybeMessage< ::ohlc::SubscribeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ohlc::SubscribeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ohlc::SendOHLCResponse*
+Arena::CreateMaybeMessage< ::ohlc::SendOHLCResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ohlc::SendOHLCResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
-#include "google/protobuf/port_undef.inc"
+#include <google/protobuf/port_undef.inc>
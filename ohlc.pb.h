@@ -1,107 +1,126 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: ohlc.proto
-// Protobuf C++ Version: 4.25.1
 
-#ifndef GOOGLE_PROTOBUF_INCLUDED_ohlc_2eproto_2epb_2eh
-#define GOOGLE_PROTOBUF_INCLUDED_ohlc_2eproto_2epb_2eh
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ohlc_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ohlc_2eproto
 
 #include <limits>
 #include <string>
-#include <type_traits>
-#include <utility>
-
-#include "google/protobuf/port_def.inc"
-#if PROTOBUF_VERSION < 4025000
-#error "This file was generated by a newer version of protoc which is"
-#error "incompatible with your Protocol Buffer headers. Please update"
-#error "your headers."
-#endif  // PROTOBUF_VERSION
-
-#if 4025001 < PROTOBUF_MIN_PROTOC_VERSION
-#error "This file was generated by an older version of protoc which is"
-#error "incompatible with your Protocol Buffer headers. Please"
-#error "regenerate this file with a newer version of protoc."
-#endif  // PROTOBUF_MIN_PROTOC_VERSION
-#include "google/protobuf/port_undef.inc"
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/arena.h"
-#include "google/protobuf/arenastring.h"
-#include "google/protobuf/generated_message_tctable_decl.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/metadata_lite.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/message.h"
-#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
-#include "google/protobuf/extension_set.h"  // IWYU pragma: export
-#include "google/protobuf/unknown_field_set.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
 
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_ohlc_2eproto
-
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 namespace internal {
 class AnyMetadata;
 }  // namespace internal
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_ohlc_2eproto {
-  static const ::uint32_t offsets[];
+  static const uint32_t offsets[];
 };
-extern const ::google::protobuf::internal::DescriptorTable
-    descriptor_table_ohlc_2eproto;
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ohlc_2eproto;
 namespace ohlc {
 class OHLC;
 struct OHLCDefaultTypeInternal;
 extern OHLCDefaultTypeInternal _OHLC_default_instance_;
+class OHLCBatch;
+struct OHLCBatchDefaultTypeInternal;
+extern OHLCBatchDefaultTypeInternal _OHLCBatch_default_instance_;
+class OHLCColumns;
+struct OHLCColumnsDefaultTypeInternal;
+extern OHLCColumnsDefaultTypeInternal _OHLCColumns_default_instance_;
+class OHLCColumns_SymbolNamesEntry_DoNotUse;
+struct OHLCColumns_SymbolNamesEntry_DoNotUseDefaultTypeInternal;
+extern OHLCColumns_SymbolNamesEntry_DoNotUseDefaultTypeInternal _OHLCColumns_SymbolNamesEntry_DoNotUse_default_instance_;
+class OHLCFixed;
+struct OHLCFixedDefaultTypeInternal;
+extern OHLCFixedDefaultTypeInternal _OHLCFixed_default_instance_;
+class OHLCPage;
+struct OHLCPageDefaultTypeInternal;
+extern OHLCPageDefaultTypeInternal _OHLCPage_default_instance_;
+class OHLCRangeRequest;
+struct OHLCRangeRequestDefaultTypeInternal;
+extern OHLCRangeRequestDefaultTypeInternal _OHLCRangeRequest_default_instance_;
 class SendOHLCResponse;
 struct SendOHLCResponseDefaultTypeInternal;
 extern SendOHLCResponseDefaultTypeInternal _SendOHLCResponse_default_instance_;
+class StockBatchRequest;
+struct StockBatchRequestDefaultTypeInternal;
+extern StockBatchRequestDefaultTypeInternal _StockBatchRequest_default_instance_;
 class StockRequest;
 struct StockRequestDefaultTypeInternal;
 extern StockRequestDefaultTypeInternal _StockRequest_default_instance_;
+class SubscribeRequest;
+struct SubscribeRequestDefaultTypeInternal;
+extern SubscribeRequestDefaultTypeInternal _SubscribeRequest_default_instance_;
 }  // namespace ohlc
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ohlc::OHLC* Arena::CreateMaybeMessage<::ohlc::OHLC>(Arena*);
+template<> ::ohlc::OHLCBatch* Arena::CreateMaybeMessage<::ohlc::OHLCBatch>(Arena*);
+template<> ::ohlc::OHLCColumns* Arena::CreateMaybeMessage<::ohlc::OHLCColumns>(Arena*);
+template<> ::ohlc::OHLCColumns_SymbolNamesEntry_DoNotUse* Arena::CreateMaybeMessage<::ohlc::OHLCColumns_SymbolNamesEntry_DoNotUse>(Arena*);
+template<> ::ohlc::OHLCFixed* Arena::CreateMaybeMessage<::ohlc::OHLCFixed>(Arena*);
+template<> ::ohlc::OHLCPage* Arena::CreateMaybeMessage<::ohlc::OHLCPage>(Arena*);
+template<> ::ohlc::OHLCRangeRequest* Arena::CreateMaybeMessage<::ohlc::OHLCRangeRequest>(Arena*);
+template<> ::ohlc::SendOHLCResponse* Arena::CreateMaybeMessage<::ohlc::SendOHLCResponse>(Arena*);
+template<> ::ohlc::StockBatchRequest* Arena::CreateMaybeMessage<::ohlc::StockBatchRequest>(Arena*);
+template<> ::ohlc::StockRequest* Arena::CreateMaybeMessage<::ohlc::StockRequest>(Arena*);
+template<> ::ohlc::SubscribeRequest* Arena::CreateMaybeMessage<::ohlc::SubscribeRequest>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace ohlc {
 
 // ===================================================================
 
-
-// -------------------------------------------------------------------
-
-class StockRequest final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ohlc.StockRequest) */ {
+class OHLC final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ohlc.OHLC) */ {
  public:
-  inline StockRequest() : StockRequest(nullptr) {}
-  ~StockRequest() override;
-  template<typename = void>
-  explicit PROTOBUF_CONSTEXPR StockRequest(::google::protobuf::internal::ConstantInitialized);
+  inline OHLC() : OHLC(nullptr) {}
+  ~OHLC() override;
+  explicit PROTOBUF_CONSTEXPR OHLC(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  inline StockRequest(const StockRequest& from)
-      : StockRequest(nullptr, from) {}
-  StockRequest(StockRequest&& from) noexcept
-    : StockRequest() {
+  OHLC(const OHLC& from);
+  OHLC(OHLC&& from) noexcept
+    : OHLC() {
     *this = ::std::move(from);
   }
 
-  inline StockRequest& operator=(const StockRequest& from) {
+  inline OHLC& operator=(const OHLC& from) {
     CopyFrom(from);
     return *this;
   }
-  inline StockRequest& operator=(StockRequest&& from) noexcept {
+  inline OHLC& operator=(OHLC&& from) noexcept {
     if (this == &from) return *this;
-    if (GetArena() == from.GetArena()
+    if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetArena() != nullptr
+        && GetOwningArena() != nullptr
   #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
     ) {
       InternalSwap(&from);
@@ -111,178 +130,249 @@ class StockRequest final :
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const StockRequest& default_instance() {
+  static const OHLC& default_instance() {
     return *internal_default_instance();
   }
-  static inline const StockRequest* internal_default_instance() {
-    return reinterpret_cast<const StockRequest*>(
-               &_StockRequest_default_instance_);
+  static inline const OHLC* internal_default_instance() {
+    return reinterpret_cast<const OHLC*>(
+               &_OHLC_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    0;
 
-  friend void swap(StockRequest& a, StockRequest& b) {
+  friend void swap(OHLC& a, OHLC& b) {
     a.Swap(&b);
   }
-  inline void Swap(StockRequest* other) {
+  inline void Swap(OHLC* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() != nullptr &&
-        GetArena() == other->GetArena()) {
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
    #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() == other->GetArena()) {
+    if (GetOwningArena() == other->GetOwningArena()) {
   #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(StockRequest* other) {
+  void UnsafeArenaSwap(OHLC* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  StockRequest* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<StockRequest>(arena);
+  OHLC* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OHLC>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const StockRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom( const StockRequest& from) {
-    StockRequest::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OHLC& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OHLC& from) {
+    OHLC::MergeImpl(*this, from);
   }
   private:
-  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
-  ::size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
-  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void InternalSwap(StockRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OHLC* other);
 
   private:
-  friend class ::google::protobuf::internal::AnyMetadata;
-  static ::absl::string_view FullMessageName() {
-    return "ohlc.StockRequest";
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ohlc.OHLC";
   }
   protected:
-  explicit StockRequest(::google::protobuf::Arena* arena);
-  StockRequest(::google::protobuf::Arena* arena, const StockRequest& from);
+  explicit OHLC(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
   static const ClassData _class_data_;
-  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kStockCodeFieldNumber = 1,
+    kStockCodeFieldNumber = 7,
+    kOpenFieldNumber = 1,
+    kHighFieldNumber = 2,
+    kLowFieldNumber = 3,
+    kCloseFieldNumber = 4,
+    kVolumeFieldNumber = 5,
+    kValueFieldNumber = 6,
+    kSequenceFieldNumber = 8,
+    kStartTimeFieldNumber = 9,
+    kIntervalFieldNumber = 10,
   };
-  // string stock_code = 1;
-  void clear_stock_code() ;
+  // string stock_code = 7;
+  void clear_stock_code();
   const std::string& stock_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_stock_code(Arg_&& arg, Args_... args);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_stock_code(ArgT0&& arg0, ArgT... args);
   std::string* mutable_stock_code();
   PROTOBUF_NODISCARD std::string* release_stock_code();
-  void set_allocated_stock_code(std::string* value);
-
+  void set_allocated_stock_code(std::string* stock_code);
   private:
   const std::string& _internal_stock_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(
-      const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(const std::string& value);
   std::string* _internal_mutable_stock_code();
+  public:
 
+  // double open = 1;
+  void clear_open();
+  double open() const;
+  void set_open(double value);
+  private:
+  double _internal_open() const;
+  void _internal_set_open(double value);
   public:
-  // @@protoc_insertion_point(class_scope:ohlc.StockRequest)
+
+  // double high = 2;
+  void clear_high();
+  double high() const;
+  void set_high(double value);
+  private:
+  double _internal_high() const;
+  void _internal_set_high(double value);
+  public:
+
+  // double low = 3;
+  void clear_low();
+  double low() const;
+  void set_low(double value);
+  private:
+  double _internal_low() const;
+  void _internal_set_low(double value);
+  public:
+
+  // double close = 4;
+  void clear_close();
+  double close() const;
+  void set_close(double value);
+  private:
+  double _internal_close() const;
+  void _internal_set_close(double value);
+  public:
+
+  // double volume = 5;
+  void clear_volume();
+  double volume() const;
+  void set_volume(double value);
+  private:
+  double _internal_volume() const;
+  void _internal_set_volume(double value);
+  public:
+
+  // double value = 6;
+  void clear_value();
+  double value() const;
+  void set_value(double value);
+  private:
+  double _internal_value() const;
+  void _internal_set_value(double value);
+  public:
+
+  // uint64 sequence = 8;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // uint64 start_time = 9;
+  void clear_start_time();
+  uint64_t start_time() const;
+  void set_start_time(uint64_t value);
+  private:
+  uint64_t _internal_start_time() const;
+  void _internal_set_start_time(uint64_t value);
+  public:
+
+  // uint64 interval = 10;
+  void clear_interval();
+  uint64_t interval() const;
+  void set_interval(uint64_t value);
+  private:
+  uint64_t _internal_interval() const;
+  void _internal_set_interval(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ohlc.OHLC)
  private:
   class _Internal;
 
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 0,
-      36, 2>
-      _table_;
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-
-        inline explicit constexpr Impl_(
-            ::google::protobuf::internal::ConstantInitialized) noexcept;
-        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                              ::google::protobuf::Arena* arena);
-        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                              ::google::protobuf::Arena* arena, const Impl_& from);
-    ::google::protobuf::internal::ArenaStringPtr stock_code_;
-    mutable ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stock_code_;
+    double open_;
+    double high_;
+    double low_;
+    double close_;
+    double volume_;
+    double value_;
+    uint64_t sequence_;
+    uint64_t start_time_;
+    uint64_t interval_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_ohlc_2eproto;
-};// -------------------------------------------------------------------
+};
+// -------------------------------------------------------------------
 
-class SendOHLCResponse final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ohlc.SendOHLCResponse) */ {
+class OHLCFixed final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ohlc.OHLCFixed) */ {
  public:
-  inline SendOHLCResponse() : SendOHLCResponse(nullptr) {}
-  ~SendOHLCResponse() override;
-  template<typename = void>
-  explicit PROTOBUF_CONSTEXPR SendOHLCResponse(::google::protobuf::internal::ConstantInitialized);
+  inline OHLCFixed() : OHLCFixed(nullptr) {}
+  ~OHLCFixed() override;
+  explicit PROTOBUF_CONSTEXPR OHLCFixed(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  inline SendOHLCResponse(const SendOHLCResponse& from)
-      : SendOHLCResponse(nullptr, from) {}
-  SendOHLCResponse(SendOHLCResponse&& from) noexcept
-    : SendOHLCResponse() {
+  OHLCFixed(const OHLCFixed& from);
+  OHLCFixed(OHLCFixed&& from) noexcept
+    : OHLCFixed() {
     *this = ::std::move(from);
   }
 
-  inline SendOHLCResponse& operator=(const SendOHLCResponse& from) {
+  inline OHLCFixed& operator=(const OHLCFixed& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SendOHLCResponse& operator=(SendOHLCResponse&& from) noexcept {
+  inline OHLCFixed& operator=(OHLCFixed&& from) noexcept {
     if (this == &from) return *this;
-    if (GetArena() == from.GetArena()
+    if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetArena() != nullptr
+        && GetOwningArena() != nullptr
   #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
     ) {
       InternalSwap(&from);
@@ -292,178 +382,275 @@ class SendOHLCResponse final :
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SendOHLCResponse& default_instance() {
+  static const OHLCFixed& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SendOHLCResponse* internal_default_instance() {
-    return reinterpret_cast<const SendOHLCResponse*>(
-               &_SendOHLCResponse_default_instance_);
+  static inline const OHLCFixed* internal_default_instance() {
+    return reinterpret_cast<const OHLCFixed*>(
+               &_OHLCFixed_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    1;
 
-  friend void swap(SendOHLCResponse& a, SendOHLCResponse& b) {
+  friend void swap(OHLCFixed& a, OHLCFixed& b) {
     a.Swap(&b);
   }
-  inline void Swap(SendOHLCResponse* other) {
+  inline void Swap(OHLCFixed* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() != nullptr &&
-        GetArena() == other->GetArena()) {
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
    #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() == other->GetArena()) {
+    if (GetOwningArena() == other->GetOwningArena()) {
   #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SendOHLCResponse* other) {
+  void UnsafeArenaSwap(OHLCFixed* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  SendOHLCResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SendOHLCResponse>(arena);
+  OHLCFixed* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OHLCFixed>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const SendOHLCResponse& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom( const SendOHLCResponse& from) {
-    SendOHLCResponse::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OHLCFixed& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OHLCFixed& from) {
+    OHLCFixed::MergeImpl(*this, from);
   }
   private:
-  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
-  ::size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
-  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void InternalSwap(SendOHLCResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OHLCFixed* other);
 
   private:
-  friend class ::google::protobuf::internal::AnyMetadata;
-  static ::absl::string_view FullMessageName() {
-    return "ohlc.SendOHLCResponse";
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ohlc.OHLCFixed";
   }
   protected:
-  explicit SendOHLCResponse(::google::protobuf::Arena* arena);
-  SendOHLCResponse(::google::protobuf::Arena* arena, const SendOHLCResponse& from);
+  explicit OHLCFixed(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
   static const ClassData _class_data_;
-  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMessageFieldNumber = 1,
+    kStockCodeFieldNumber = 8,
+    kOpenFieldNumber = 1,
+    kHighFieldNumber = 2,
+    kLowFieldNumber = 3,
+    kCloseFieldNumber = 4,
+    kVolumeFieldNumber = 5,
+    kValueFieldNumber = 6,
+    kPriceScaleFieldNumber = 7,
+    kSymbolIdFieldNumber = 9,
+    kSequenceFieldNumber = 10,
   };
-  // string message = 1;
-  void clear_message() ;
-  const std::string& message() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_message(Arg_&& arg, Args_... args);
-  std::string* mutable_message();
-  PROTOBUF_NODISCARD std::string* release_message();
-  void set_allocated_message(std::string* value);
+  // string stock_code = 8;
+  void clear_stock_code();
+  const std::string& stock_code() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_stock_code(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_stock_code();
+  PROTOBUF_NODISCARD std::string* release_stock_code();
+  void set_allocated_stock_code(std::string* stock_code);
+  private:
+  const std::string& _internal_stock_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(const std::string& value);
+  std::string* _internal_mutable_stock_code();
+  public:
 
+  // sint64 open = 1;
+  void clear_open();
+  int64_t open() const;
+  void set_open(int64_t value);
   private:
-  const std::string& _internal_message() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(
-      const std::string& value);
-  std::string* _internal_mutable_message();
+  int64_t _internal_open() const;
+  void _internal_set_open(int64_t value);
+  public:
 
+  // sint64 high = 2;
+  void clear_high();
+  int64_t high() const;
+  void set_high(int64_t value);
+  private:
+  int64_t _internal_high() const;
+  void _internal_set_high(int64_t value);
   public:
-  // @@protoc_insertion_point(class_scope:ohlc.SendOHLCResponse)
+
+  // sint64 low = 3;
+  void clear_low();
+  int64_t low() const;
+  void set_low(int64_t value);
+  private:
+  int64_t _internal_low() const;
+  void _internal_set_low(int64_t value);
+  public:
+
+  // sint64 close = 4;
+  void clear_close();
+  int64_t close() const;
+  void set_close(int64_t value);
+  private:
+  int64_t _internal_close() const;
+  void _internal_set_close(int64_t value);
+  public:
+
+  // int64 volume = 5;
+  void clear_volume();
+  int64_t volume() const;
+  void set_volume(int64_t value);
+  private:
+  int64_t _internal_volume() const;
+  void _internal_set_volume(int64_t value);
+  public:
+
+  // int64 value = 6;
+  void clear_value();
+  int64_t value() const;
+  void set_value(int64_t value);
+  private:
+  int64_t _internal_value() const;
+  void _internal_set_value(int64_t value);
+  public:
+
+  // uint32 price_scale = 7;
+  void clear_price_scale();
+  uint32_t price_scale() const;
+  void set_price_scale(uint32_t value);
+  private:
+  uint32_t _internal_price_scale() const;
+  void _internal_set_price_scale(uint32_t value);
+  public:
+
+  // uint32 symbol_id = 9;
+  void clear_symbol_id();
+  uint32_t symbol_id() const;
+  void set_symbol_id(uint32_t value);
+  private:
+  uint32_t _internal_symbol_id() const;
+  void _internal_set_symbol_id(uint32_t value);
+  public:
+
+  // uint64 sequence = 10;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ohlc.OHLCFixed)
  private:
   class _Internal;
 
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 0,
-      37, 2>
-      _table_;
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-
-        inline explicit constexpr Impl_(
-            ::google::protobuf::internal::ConstantInitialized) noexcept;
-        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                              ::google::protobuf::Arena* arena);
-        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                              ::google::protobuf::Arena* arena, const Impl_& from);
-    ::google::protobuf::internal::ArenaStringPtr message_;
-    mutable ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stock_code_;
+    int64_t open_;
+    int64_t high_;
+    int64_t low_;
+    int64_t close_;
+    int64_t volume_;
+    int64_t value_;
+    uint32_t price_scale_;
+    uint32_t symbol_id_;
+    uint64_t sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_ohlc_2eproto;
-};// -------------------------------------------------------------------
+};
+// -------------------------------------------------------------------
+
+class OHLCColumns_SymbolNamesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<OHLCColumns_SymbolNamesEntry_DoNotUse, 
+    uint32_t, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<OHLCColumns_SymbolNamesEntry_DoNotUse, 
+    uint32_t, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  OHLCColumns_SymbolNamesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR OHLCColumns_SymbolNamesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit OHLCColumns_SymbolNamesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const OHLCColumns_SymbolNamesEntry_DoNotUse& other);
+  static const OHLCColumns_SymbolNamesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const OHLCColumns_SymbolNamesEntry_DoNotUse*>(&_OHLCColumns_SymbolNamesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "ohlc.OHLCColumns.SymbolNamesEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_ohlc_2eproto;
+};
 
-class OHLC final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ohlc.OHLC) */ {
+// -------------------------------------------------------------------
+
+class OHLCColumns final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ohlc.OHLCColumns) */ {
  public:
-  inline OHLC() : OHLC(nullptr) {}
-  ~OHLC() override;
-  template<typename = void>
-  explicit PROTOBUF_CONSTEXPR OHLC(::google::protobuf::internal::ConstantInitialized);
+  inline OHLCColumns() : OHLCColumns(nullptr) {}
+  ~OHLCColumns() override;
+  explicit PROTOBUF_CONSTEXPR OHLCColumns(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  inline OHLC(const OHLC& from)
-      : OHLC(nullptr, from) {}
-  OHLC(OHLC&& from) noexcept
-    : OHLC() {
+  OHLCColumns(const OHLCColumns& from);
+  OHLCColumns(OHLCColumns&& from) noexcept
+    : OHLCColumns() {
     *this = ::std::move(from);
   }
 
-  inline OHLC& operator=(const OHLC& from) {
+  inline OHLCColumns& operator=(const OHLCColumns& from) {
     CopyFrom(from);
     return *this;
   }
-  inline OHLC& operator=(OHLC&& from) noexcept {
+  inline OHLCColumns& operator=(OHLCColumns&& from) noexcept {
     if (this == &from) return *this;
-    if (GetArena() == from.GetArena()
+    if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetArena() != nullptr
+        && GetOwningArena() != nullptr
   #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
     ) {
       InternalSwap(&from);
@@ -473,488 +660,2929 @@ class OHLC final :
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const OHLC& default_instance() {
+  static const OHLCColumns& default_instance() {
     return *internal_default_instance();
   }
-  static inline const OHLC* internal_default_instance() {
-    return reinterpret_cast<const OHLC*>(
-               &_OHLC_default_instance_);
+  static inline const OHLCColumns* internal_default_instance() {
+    return reinterpret_cast<const OHLCColumns*>(
+               &_OHLCColumns_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    0;
+    3;
 
-  friend void swap(OHLC& a, OHLC& b) {
+  friend void swap(OHLCColumns& a, OHLCColumns& b) {
     a.Swap(&b);
   }
-  inline void Swap(OHLC* other) {
+  inline void Swap(OHLCColumns* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() != nullptr &&
-        GetArena() == other->GetArena()) {
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
    #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetArena() == other->GetArena()) {
+    if (GetOwningArena() == other->GetOwningArena()) {
   #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(OHLC* other) {
+  void UnsafeArenaSwap(OHLCColumns* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  OHLC* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<OHLC>(arena);
+  OHLCColumns* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OHLCColumns>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const OHLC& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom( const OHLC& from) {
-    OHLC::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OHLCColumns& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OHLCColumns& from) {
+    OHLCColumns::MergeImpl(*this, from);
   }
   private:
-  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
-  ::size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
-  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void InternalSwap(OHLC* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OHLCColumns* other);
 
   private:
-  friend class ::google::protobuf::internal::AnyMetadata;
-  static ::absl::string_view FullMessageName() {
-    return "ohlc.OHLC";
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ohlc.OHLCColumns";
   }
   protected:
-  explicit OHLC(::google::protobuf::Arena* arena);
-  OHLC(::google::protobuf::Arena* arena, const OHLC& from);
+  explicit OHLCColumns(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
-  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kStockCodeFieldNumber = 7,
-    kOpenFieldNumber = 1,
-    kHighFieldNumber = 2,
-    kLowFieldNumber = 3,
-    kCloseFieldNumber = 4,
-    kVolumeFieldNumber = 5,
-    kValueFieldNumber = 6,
+    kSymbolNamesFieldNumber = 2,
+    kSymbolIdsFieldNumber = 3,
+    kOpenFieldNumber = 4,
+    kHighMinusOpenFieldNumber = 5,
+    kLowMinusOpenFieldNumber = 6,
+    kCloseMinusOpenFieldNumber = 7,
+    kVolumeFieldNumber = 8,
+    kValueFieldNumber = 9,
+    kSequenceFieldNumber = 10,
+    kPriceScaleFieldNumber = 1,
   };
-  // string stock_code = 7;
-  void clear_stock_code() ;
-  const std::string& stock_code() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_stock_code(Arg_&& arg, Args_... args);
-  std::string* mutable_stock_code();
-  PROTOBUF_NODISCARD std::string* release_stock_code();
-  void set_allocated_stock_code(std::string* value);
-
+  // map<uint32, string> symbol_names = 2;
+  int symbol_names_size() const;
   private:
-  const std::string& _internal_stock_code() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(
-      const std::string& value);
-  std::string* _internal_mutable_stock_code();
-
+  int _internal_symbol_names_size() const;
   public:
-  // double open = 1;
-  void clear_open() ;
-  double open() const;
-  void set_open(double value);
+  void clear_symbol_names();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, std::string >&
+      _internal_symbol_names() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, std::string >*
+      _internal_mutable_symbol_names();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, std::string >&
+      symbol_names() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, std::string >*
+      mutable_symbol_names();
 
+  // repeated uint32 symbol_ids = 3;
+  int symbol_ids_size() const;
   private:
-  double _internal_open() const;
-  void _internal_set_open(double value);
-
+  int _internal_symbol_ids_size() const;
   public:
-  // double high = 2;
-  void clear_high() ;
-  double high() const;
-  void set_high(double value);
-
+  void clear_symbol_ids();
   private:
-  double _internal_high() const;
-  void _internal_set_high(double value);
+  uint32_t _internal_symbol_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_symbol_ids() const;
+  void _internal_add_symbol_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_symbol_ids();
+  public:
+  uint32_t symbol_ids(int index) const;
+  void set_symbol_ids(int index, uint32_t value);
+  void add_symbol_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      symbol_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_symbol_ids();
+
+  // repeated sint64 open = 4;
+  int open_size() const;
+  private:
+  int _internal_open_size() const;
+  public:
+  void clear_open();
+  private:
+  int64_t _internal_open(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_open() const;
+  void _internal_add_open(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_open();
+  public:
+  int64_t open(int index) const;
+  void set_open(int index, int64_t value);
+  void add_open(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      open() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_open();
+
+  // repeated sint64 high_minus_open = 5;
+  int high_minus_open_size() const;
+  private:
+  int _internal_high_minus_open_size() const;
+  public:
+  void clear_high_minus_open();
+  private:
+  int64_t _internal_high_minus_open(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_high_minus_open() const;
+  void _internal_add_high_minus_open(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_high_minus_open();
+  public:
+  int64_t high_minus_open(int index) const;
+  void set_high_minus_open(int index, int64_t value);
+  void add_high_minus_open(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      high_minus_open() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_high_minus_open();
+
+  // repeated sint64 low_minus_open = 6;
+  int low_minus_open_size() const;
+  private:
+  int _internal_low_minus_open_size() const;
+  public:
+  void clear_low_minus_open();
+  private:
+  int64_t _internal_low_minus_open(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_low_minus_open() const;
+  void _internal_add_low_minus_open(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_low_minus_open();
+  public:
+  int64_t low_minus_open(int index) const;
+  void set_low_minus_open(int index, int64_t value);
+  void add_low_minus_open(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      low_minus_open() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_low_minus_open();
+
+  // repeated sint64 close_minus_open = 7;
+  int close_minus_open_size() const;
+  private:
+  int _internal_close_minus_open_size() const;
+  public:
+  void clear_close_minus_open();
+  private:
+  int64_t _internal_close_minus_open(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_close_minus_open() const;
+  void _internal_add_close_minus_open(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_close_minus_open();
+  public:
+  int64_t close_minus_open(int index) const;
+  void set_close_minus_open(int index, int64_t value);
+  void add_close_minus_open(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      close_minus_open() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_close_minus_open();
+
+  // repeated int64 volume = 8;
+  int volume_size() const;
+  private:
+  int _internal_volume_size() const;
+  public:
+  void clear_volume();
+  private:
+  int64_t _internal_volume(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_volume() const;
+  void _internal_add_volume(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_volume();
+  public:
+  int64_t volume(int index) const;
+  void set_volume(int index, int64_t value);
+  void add_volume(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      volume() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_volume();
+
+  // repeated int64 value = 9;
+  int value_size() const;
+  private:
+  int _internal_value_size() const;
+  public:
+  void clear_value();
+  private:
+  int64_t _internal_value(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_value() const;
+  void _internal_add_value(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_value();
+  public:
+  int64_t value(int index) const;
+  void set_value(int index, int64_t value);
+  void add_value(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      value() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_value();
+
+  // repeated uint64 sequence = 10;
+  int sequence_size() const;
+  private:
+  int _internal_sequence_size() const;
+  public:
+  void clear_sequence();
+  private:
+  uint64_t _internal_sequence(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_sequence() const;
+  void _internal_add_sequence(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_sequence();
+  public:
+  uint64_t sequence(int index) const;
+  void set_sequence(int index, uint64_t value);
+  void add_sequence(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      sequence() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_sequence();
+
+  // uint32 price_scale = 1;
+  void clear_price_scale();
+  uint32_t price_scale() const;
+  void set_price_scale(uint32_t value);
+  private:
+  uint32_t _internal_price_scale() const;
+  void _internal_set_price_scale(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ohlc.OHLCColumns)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        OHLCColumns_SymbolNamesEntry_DoNotUse,
+        uint32_t, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> symbol_names_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > symbol_ids_;
+    mutable std::atomic<int> _symbol_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > open_;
+    mutable std::atomic<int> _open_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > high_minus_open_;
+    mutable std::atomic<int> _high_minus_open_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > low_minus_open_;
+    mutable std::atomic<int> _low_minus_open_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > close_minus_open_;
+    mutable std::atomic<int> _close_minus_open_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > volume_;
+    mutable std::atomic<int> _volume_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > value_;
+    mutable std::atomic<int> _value_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > sequence_;
+    mutable std::atomic<int> _sequence_cached_byte_size_;
+    uint32_t price_scale_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ohlc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StockRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ohlc.StockRequest) */ {
+ public:
+  inline StockRequest() : StockRequest(nullptr) {}
+  ~StockRequest() override;
+  explicit PROTOBUF_CONSTEXPR StockRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StockRequest(const StockRequest& from);
+  StockRequest(StockRequest&& from) noexcept
+    : StockRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StockRequest& operator=(const StockRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StockRequest& operator=(StockRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StockRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StockRequest* internal_default_instance() {
+    return reinterpret_cast<const StockRequest*>(
+               &_StockRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(StockRequest& a, StockRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StockRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StockRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
 
+  StockRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StockRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StockRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StockRequest& from) {
+    StockRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  // double low = 3;
-  void clear_low() ;
-  double low() const;
-  void set_low(double value);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  double _internal_low() const;
-  void _internal_set_low(double value);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StockRequest* other);
 
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ohlc.StockRequest";
+  }
+  protected:
+  explicit StockRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  // double close = 4;
-  void clear_close() ;
-  double close() const;
-  void set_close(double value);
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStockCodeFieldNumber = 1,
+  };
+  // string stock_code = 1;
+  void clear_stock_code();
+  const std::string& stock_code() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_stock_code(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_stock_code();
+  PROTOBUF_NODISCARD std::string* release_stock_code();
+  void set_allocated_stock_code(std::string* stock_code);
   private:
-  double _internal_close() const;
-  void _internal_set_close(double value);
+  const std::string& _internal_stock_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(const std::string& value);
+  std::string* _internal_mutable_stock_code();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ohlc.StockRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stock_code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ohlc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StockBatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ohlc.StockBatchRequest) */ {
+ public:
+  inline StockBatchRequest() : StockBatchRequest(nullptr) {}
+  ~StockBatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR StockBatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StockBatchRequest(const StockBatchRequest& from);
+  StockBatchRequest(StockBatchRequest&& from) noexcept
+    : StockBatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StockBatchRequest& operator=(const StockBatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StockBatchRequest& operator=(StockBatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StockBatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StockBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const StockBatchRequest*>(
+               &_StockBatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(StockBatchRequest& a, StockBatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StockBatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StockBatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
 
+  StockBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StockBatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StockBatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StockBatchRequest& from) {
+    StockBatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  // double volume = 5;
-  void clear_volume() ;
-  double volume() const;
-  void set_volume(double value);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  double _internal_volume() const;
-  void _internal_set_volume(double value);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StockBatchRequest* other);
 
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ohlc.StockBatchRequest";
+  }
+  protected:
+  explicit StockBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  // double value = 6;
-  void clear_value() ;
-  double value() const;
-  void set_value(double value);
 
-  private:
-  double _internal_value() const;
-  void _internal_set_value(double value);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStockCodesFieldNumber = 1,
+  };
+  // repeated string stock_codes = 1;
+  int stock_codes_size() const;
+  private:
+  int _internal_stock_codes_size() const;
   public:
-  // @@protoc_insertion_point(class_scope:ohlc.OHLC)
+  void clear_stock_codes();
+  const std::string& stock_codes(int index) const;
+  std::string* mutable_stock_codes(int index);
+  void set_stock_codes(int index, const std::string& value);
+  void set_stock_codes(int index, std::string&& value);
+  void set_stock_codes(int index, const char* value);
+  void set_stock_codes(int index, const char* value, size_t size);
+  std::string* add_stock_codes();
+  void add_stock_codes(const std::string& value);
+  void add_stock_codes(std::string&& value);
+  void add_stock_codes(const char* value);
+  void add_stock_codes(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& stock_codes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_stock_codes();
+  private:
+  const std::string& _internal_stock_codes(int index) const;
+  std::string* _internal_add_stock_codes();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ohlc.StockBatchRequest)
  private:
   class _Internal;
 
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 7, 0,
-      28, 2>
-      _table_;
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-
-        inline explicit constexpr Impl_(
-            ::google::protobuf::internal::ConstantInitialized) noexcept;
-        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                              ::google::protobuf::Arena* arena);
-        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
-                              ::google::protobuf::Arena* arena, const Impl_& from);
-    ::google::protobuf::internal::ArenaStringPtr stock_code_;
-    double open_;
-    double high_;
-    double low_;
-    double close_;
-    double volume_;
-    double value_;
-    mutable ::google::protobuf::internal::CachedSize _cached_size_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> stock_codes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_ohlc_2eproto;
 };
+// -------------------------------------------------------------------
 
-// ===================================================================
+class OHLCBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ohlc.OHLCBatch) */ {
+ public:
+  inline OHLCBatch() : OHLCBatch(nullptr) {}
+  ~OHLCBatch() override;
+  explicit PROTOBUF_CONSTEXPR OHLCBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OHLCBatch(const OHLCBatch& from);
+  OHLCBatch(OHLCBatch&& from) noexcept
+    : OHLCBatch() {
+    *this = ::std::move(from);
+  }
 
+  inline OHLCBatch& operator=(const OHLCBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OHLCBatch& operator=(OHLCBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OHLCBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OHLCBatch* internal_default_instance() {
+    return reinterpret_cast<const OHLCBatch*>(
+               &_OHLCBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(OHLCBatch& a, OHLCBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OHLCBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OHLCBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OHLCBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OHLCBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OHLCBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OHLCBatch& from) {
+    OHLCBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OHLCBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ohlc.OHLCBatch";
+  }
+  protected:
+  explicit OHLCBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCandlesFieldNumber = 1,
+    kMissingCodesFieldNumber = 2,
+  };
+  // repeated .ohlc.OHLC candles = 1;
+  int candles_size() const;
+  private:
+  int _internal_candles_size() const;
+  public:
+  void clear_candles();
+  ::ohlc::OHLC* mutable_candles(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ohlc::OHLC >*
+      mutable_candles();
+  private:
+  const ::ohlc::OHLC& _internal_candles(int index) const;
+  ::ohlc::OHLC* _internal_add_candles();
+  public:
+  const ::ohlc::OHLC& candles(int index) const;
+  ::ohlc::OHLC* add_candles();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ohlc::OHLC >&
+      candles() const;
+
+  // repeated string missing_codes = 2;
+  int missing_codes_size() const;
+  private:
+  int _internal_missing_codes_size() const;
+  public:
+  void clear_missing_codes();
+  const std::string& missing_codes(int index) const;
+  std::string* mutable_missing_codes(int index);
+  void set_missing_codes(int index, const std::string& value);
+  void set_missing_codes(int index, std::string&& value);
+  void set_missing_codes(int index, const char* value);
+  void set_missing_codes(int index, const char* value, size_t size);
+  std::string* add_missing_codes();
+  void add_missing_codes(const std::string& value);
+  void add_missing_codes(std::string&& value);
+  void add_missing_codes(const char* value);
+  void add_missing_codes(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& missing_codes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_missing_codes();
+  private:
+  const std::string& _internal_missing_codes(int index) const;
+  std::string* _internal_add_missing_codes();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ohlc.OHLCBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ohlc::OHLC > candles_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> missing_codes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ohlc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OHLCRangeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ohlc.OHLCRangeRequest) */ {
+ public:
+  inline OHLCRangeRequest() : OHLCRangeRequest(nullptr) {}
+  ~OHLCRangeRequest() override;
+  explicit PROTOBUF_CONSTEXPR OHLCRangeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OHLCRangeRequest(const OHLCRangeRequest& from);
+  OHLCRangeRequest(OHLCRangeRequest&& from) noexcept
+    : OHLCRangeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline OHLCRangeRequest& operator=(const OHLCRangeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OHLCRangeRequest& operator=(OHLCRangeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OHLCRangeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OHLCRangeRequest* internal_default_instance() {
+    return reinterpret_cast<const OHLCRangeRequest*>(
+               &_OHLCRangeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(OHLCRangeRequest& a, OHLCRangeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OHLCRangeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OHLCRangeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OHLCRangeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OHLCRangeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OHLCRangeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OHLCRangeRequest& from) {
+    OHLCRangeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OHLCRangeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ohlc.OHLCRangeRequest";
+  }
+  protected:
+  explicit OHLCRangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStockCodeFieldNumber = 1,
+    kIntervalFieldNumber = 2,
+    kFromTimeFieldNumber = 3,
+    kToTimeFieldNumber = 4,
+    kPageSizeFieldNumber = 5,
+  };
+  // string stock_code = 1;
+  void clear_stock_code();
+  const std::string& stock_code() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_stock_code(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_stock_code();
+  PROTOBUF_NODISCARD std::string* release_stock_code();
+  void set_allocated_stock_code(std::string* stock_code);
+  private:
+  const std::string& _internal_stock_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stock_code(const std::string& value);
+  std::string* _internal_mutable_stock_code();
+  public:
+
+  // uint64 interval = 2;
+  void clear_interval();
+  uint64_t interval() const;
+  void set_interval(uint64_t value);
+  private:
+  uint64_t _internal_interval() const;
+  void _internal_set_interval(uint64_t value);
+  public:
+
+  // uint64 from_time = 3;
+  void clear_from_time();
+  uint64_t from_time() const;
+  void set_from_time(uint64_t value);
+  private:
+  uint64_t _internal_from_time() const;
+  void _internal_set_from_time(uint64_t value);
+  public:
+
+  // uint64 to_time = 4;
+  void clear_to_time();
+  uint64_t to_time() const;
+  void set_to_time(uint64_t value);
+  private:
+  uint64_t _internal_to_time() const;
+  void _internal_set_to_time(uint64_t value);
+  public:
+
+  // uint32 page_size = 5;
+  void clear_page_size();
+  uint32_t page_size() const;
+  void set_page_size(uint32_t value);
+  private:
+  uint32_t _internal_page_size() const;
+  void _internal_set_page_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ohlc.OHLCRangeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stock_code_;
+    uint64_t interval_;
+    uint64_t from_time_;
+    uint64_t to_time_;
+    uint32_t page_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ohlc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OHLCPage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ohlc.OHLCPage) */ {
+ public:
+  inline OHLCPage() : OHLCPage(nullptr) {}
+  ~OHLCPage() override;
+  explicit PROTOBUF_CONSTEXPR OHLCPage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OHLCPage(const OHLCPage& from);
+  OHLCPage(OHLCPage&& from) noexcept
+    : OHLCPage() {
+    *this = ::std::move(from);
+  }
+
+  inline OHLCPage& operator=(const OHLCPage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OHLCPage& operator=(OHLCPage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OHLCPage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OHLCPage* internal_default_instance() {
+    return reinterpret_cast<const OHLCPage*>(
+               &_OHLCPage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(OHLCPage& a, OHLCPage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OHLCPage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OHLCPage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OHLCPage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OHLCPage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OHLCPage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OHLCPage& from) {
+    OHLCPage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OHLCPage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ohlc.OHLCPage";
+  }
+  protected:
+  explicit OHLCPage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCandlesFieldNumber = 1,
+  };
+  // repeated .ohlc.OHLC candles = 1;
+  int candles_size() const;
+  private:
+  int _internal_candles_size() const;
+  public:
+  void clear_candles();
+  ::ohlc::OHLC* mutable_candles(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ohlc::OHLC >*
+      mutable_candles();
+  private:
+  const ::ohlc::OHLC& _internal_candles(int index) const;
+  ::ohlc::OHLC* _internal_add_candles();
+  public:
+  const ::ohlc::OHLC& candles(int index) const;
+  ::ohlc::OHLC* add_candles();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ohlc::OHLC >&
+      candles() const;
+
+  // @@protoc_insertion_point(class_scope:ohlc.OHLCPage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ohlc::OHLC > candles_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ohlc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubscribeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ohlc.SubscribeRequest) */ {
+ public:
+  inline SubscribeRequest() : SubscribeRequest(nullptr) {}
+  ~SubscribeRequest() override;
+  explicit PROTOBUF_CONSTEXPR SubscribeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubscribeRequest(const SubscribeRequest& from);
+  SubscribeRequest(SubscribeRequest&& from) noexcept
+    : SubscribeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SubscribeRequest& operator=(const SubscribeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubscribeRequest& operator=(SubscribeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubscribeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubscribeRequest* internal_default_instance() {
+    return reinterpret_cast<const SubscribeRequest*>(
+               &_SubscribeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(SubscribeRequest& a, SubscribeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubscribeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubscribeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubscribeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubscribeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SubscribeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubscribeRequest& from) {
+    SubscribeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SubscribeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ohlc.SubscribeRequest";
+  }
+  protected:
+  explicit SubscribeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStockCodesFieldNumber = 1,
+  };
+  // repeated string stock_codes = 1;
+  int stock_codes_size() const;
+  private:
+  int _internal_stock_codes_size() const;
+  public:
+  void clear_stock_codes();
+  const std::string& stock_codes(int index) const;
+  std::string* mutable_stock_codes(int index);
+  void set_stock_codes(int index, const std::string& value);
+  void set_stock_codes(int index, std::string&& value);
+  void set_stock_codes(int index, const char* value);
+  void set_stock_codes(int index, const char* value, size_t size);
+  std::string* add_stock_codes();
+  void add_stock_codes(const std::string& value);
+  void add_stock_codes(std::string&& value);
+  void add_stock_codes(const char* value);
+  void add_stock_codes(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& stock_codes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_stock_codes();
+  private:
+  const std::string& _internal_stock_codes(int index) const;
+  std::string* _internal_add_stock_codes();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ohlc.SubscribeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> stock_codes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ohlc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SendOHLCResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ohlc.SendOHLCResponse) */ {
+ public:
+  inline SendOHLCResponse() : SendOHLCResponse(nullptr) {}
+  ~SendOHLCResponse() override;
+  explicit PROTOBUF_CONSTEXPR SendOHLCResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SendOHLCResponse(const SendOHLCResponse& from);
+  SendOHLCResponse(SendOHLCResponse&& from) noexcept
+    : SendOHLCResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SendOHLCResponse& operator=(const SendOHLCResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SendOHLCResponse& operator=(SendOHLCResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SendOHLCResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SendOHLCResponse* internal_default_instance() {
+    return reinterpret_cast<const SendOHLCResponse*>(
+               &_SendOHLCResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(SendOHLCResponse& a, SendOHLCResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SendOHLCResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SendOHLCResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SendOHLCResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SendOHLCResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SendOHLCResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SendOHLCResponse& from) {
+    SendOHLCResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SendOHLCResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ohlc.SendOHLCResponse";
+  }
+  protected:
+  explicit SendOHLCResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+  };
+  // string message = 1;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ohlc.SendOHLCResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ohlc_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// OHLC
+
+// double open = 1;
+inline void OHLC::clear_open() {
+  _impl_.open_ = 0;
+}
+inline double OHLC::_internal_open() const {
+  return _impl_.open_;
+}
+inline double OHLC::open() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLC.open)
+  return _internal_open();
+}
+inline void OHLC::_internal_set_open(double value) {
+  
+  _impl_.open_ = value;
+}
+inline void OHLC::set_open(double value) {
+  _internal_set_open(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLC.open)
+}
+
+// double high = 2;
+inline void OHLC::clear_high() {
+  _impl_.high_ = 0;
+}
+inline double OHLC::_internal_high() const {
+  return _impl_.high_;
+}
+inline double OHLC::high() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLC.high)
+  return _internal_high();
+}
+inline void OHLC::_internal_set_high(double value) {
+  
+  _impl_.high_ = value;
+}
+inline void OHLC::set_high(double value) {
+  _internal_set_high(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLC.high)
+}
+
+// double low = 3;
+inline void OHLC::clear_low() {
+  _impl_.low_ = 0;
+}
+inline double OHLC::_internal_low() const {
+  return _impl_.low_;
+}
+inline double OHLC::low() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLC.low)
+  return _internal_low();
+}
+inline void OHLC::_internal_set_low(double value) {
+  
+  _impl_.low_ = value;
+}
+inline void OHLC::set_low(double value) {
+  _internal_set_low(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLC.low)
+}
+
+// double close = 4;
+inline void OHLC::clear_close() {
+  _impl_.close_ = 0;
+}
+inline double OHLC::_internal_close() const {
+  return _impl_.close_;
+}
+inline double OHLC::close() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLC.close)
+  return _internal_close();
+}
+inline void OHLC::_internal_set_close(double value) {
+  
+  _impl_.close_ = value;
+}
+inline void OHLC::set_close(double value) {
+  _internal_set_close(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLC.close)
+}
+
+// double volume = 5;
+inline void OHLC::clear_volume() {
+  _impl_.volume_ = 0;
+}
+inline double OHLC::_internal_volume() const {
+  return _impl_.volume_;
+}
+inline double OHLC::volume() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLC.volume)
+  return _internal_volume();
+}
+inline void OHLC::_internal_set_volume(double value) {
+  
+  _impl_.volume_ = value;
+}
+inline void OHLC::set_volume(double value) {
+  _internal_set_volume(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLC.volume)
+}
+
+// double value = 6;
+inline void OHLC::clear_value() {
+  _impl_.value_ = 0;
+}
+inline double OHLC::_internal_value() const {
+  return _impl_.value_;
+}
+inline double OHLC::value() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLC.value)
+  return _internal_value();
+}
+inline void OHLC::_internal_set_value(double value) {
+  
+  _impl_.value_ = value;
+}
+inline void OHLC::set_value(double value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLC.value)
+}
+
+// string stock_code = 7;
+inline void OHLC::clear_stock_code() {
+  _impl_.stock_code_.ClearToEmpty();
+}
+inline const std::string& OHLC::stock_code() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLC.stock_code)
+  return _internal_stock_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OHLC::set_stock_code(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.stock_code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ohlc.OHLC.stock_code)
+}
+inline std::string* OHLC::mutable_stock_code() {
+  std::string* _s = _internal_mutable_stock_code();
+  // @@protoc_insertion_point(field_mutable:ohlc.OHLC.stock_code)
+  return _s;
+}
+inline const std::string& OHLC::_internal_stock_code() const {
+  return _impl_.stock_code_.Get();
+}
+inline void OHLC::_internal_set_stock_code(const std::string& value) {
+  
+  _impl_.stock_code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OHLC::_internal_mutable_stock_code() {
+  
+  return _impl_.stock_code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OHLC::release_stock_code() {
+  // @@protoc_insertion_point(field_release:ohlc.OHLC.stock_code)
+  return _impl_.stock_code_.Release();
+}
+inline void OHLC::set_allocated_stock_code(std::string* stock_code) {
+  if (stock_code != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.stock_code_.SetAllocated(stock_code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.stock_code_.IsDefault()) {
+    _impl_.stock_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ohlc.OHLC.stock_code)
+}
+
+// uint64 sequence = 8;
+inline void OHLC::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t OHLC::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t OHLC::sequence() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLC.sequence)
+  return _internal_sequence();
+}
+inline void OHLC::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void OHLC::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLC.sequence)
+}
+
+// uint64 start_time = 9;
+inline void OHLC::clear_start_time() {
+  _impl_.start_time_ = uint64_t{0u};
+}
+inline uint64_t OHLC::_internal_start_time() const {
+  return _impl_.start_time_;
+}
+inline uint64_t OHLC::start_time() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLC.start_time)
+  return _internal_start_time();
+}
+inline void OHLC::_internal_set_start_time(uint64_t value) {
+  
+  _impl_.start_time_ = value;
+}
+inline void OHLC::set_start_time(uint64_t value) {
+  _internal_set_start_time(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLC.start_time)
+}
+
+// uint64 interval = 10;
+inline void OHLC::clear_interval() {
+  _impl_.interval_ = uint64_t{0u};
+}
+inline uint64_t OHLC::_internal_interval() const {
+  return _impl_.interval_;
+}
+inline uint64_t OHLC::interval() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLC.interval)
+  return _internal_interval();
+}
+inline void OHLC::_internal_set_interval(uint64_t value) {
+  
+  _impl_.interval_ = value;
+}
+inline void OHLC::set_interval(uint64_t value) {
+  _internal_set_interval(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLC.interval)
+}
+
+// -------------------------------------------------------------------
+
+// OHLCFixed
+
+// sint64 open = 1;
+inline void OHLCFixed::clear_open() {
+  _impl_.open_ = int64_t{0};
+}
+inline int64_t OHLCFixed::_internal_open() const {
+  return _impl_.open_;
+}
+inline int64_t OHLCFixed::open() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCFixed.open)
+  return _internal_open();
+}
+inline void OHLCFixed::_internal_set_open(int64_t value) {
+  
+  _impl_.open_ = value;
+}
+inline void OHLCFixed::set_open(int64_t value) {
+  _internal_set_open(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCFixed.open)
+}
+
+// sint64 high = 2;
+inline void OHLCFixed::clear_high() {
+  _impl_.high_ = int64_t{0};
+}
+inline int64_t OHLCFixed::_internal_high() const {
+  return _impl_.high_;
+}
+inline int64_t OHLCFixed::high() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCFixed.high)
+  return _internal_high();
+}
+inline void OHLCFixed::_internal_set_high(int64_t value) {
+  
+  _impl_.high_ = value;
+}
+inline void OHLCFixed::set_high(int64_t value) {
+  _internal_set_high(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCFixed.high)
+}
+
+// sint64 low = 3;
+inline void OHLCFixed::clear_low() {
+  _impl_.low_ = int64_t{0};
+}
+inline int64_t OHLCFixed::_internal_low() const {
+  return _impl_.low_;
+}
+inline int64_t OHLCFixed::low() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCFixed.low)
+  return _internal_low();
+}
+inline void OHLCFixed::_internal_set_low(int64_t value) {
+  
+  _impl_.low_ = value;
+}
+inline void OHLCFixed::set_low(int64_t value) {
+  _internal_set_low(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCFixed.low)
+}
+
+// sint64 close = 4;
+inline void OHLCFixed::clear_close() {
+  _impl_.close_ = int64_t{0};
+}
+inline int64_t OHLCFixed::_internal_close() const {
+  return _impl_.close_;
+}
+inline int64_t OHLCFixed::close() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCFixed.close)
+  return _internal_close();
+}
+inline void OHLCFixed::_internal_set_close(int64_t value) {
+  
+  _impl_.close_ = value;
+}
+inline void OHLCFixed::set_close(int64_t value) {
+  _internal_set_close(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCFixed.close)
+}
+
+// int64 volume = 5;
+inline void OHLCFixed::clear_volume() {
+  _impl_.volume_ = int64_t{0};
+}
+inline int64_t OHLCFixed::_internal_volume() const {
+  return _impl_.volume_;
+}
+inline int64_t OHLCFixed::volume() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCFixed.volume)
+  return _internal_volume();
+}
+inline void OHLCFixed::_internal_set_volume(int64_t value) {
+  
+  _impl_.volume_ = value;
+}
+inline void OHLCFixed::set_volume(int64_t value) {
+  _internal_set_volume(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCFixed.volume)
+}
+
+// int64 value = 6;
+inline void OHLCFixed::clear_value() {
+  _impl_.value_ = int64_t{0};
+}
+inline int64_t OHLCFixed::_internal_value() const {
+  return _impl_.value_;
+}
+inline int64_t OHLCFixed::value() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCFixed.value)
+  return _internal_value();
+}
+inline void OHLCFixed::_internal_set_value(int64_t value) {
+  
+  _impl_.value_ = value;
+}
+inline void OHLCFixed::set_value(int64_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCFixed.value)
+}
+
+// uint32 price_scale = 7;
+inline void OHLCFixed::clear_price_scale() {
+  _impl_.price_scale_ = 0u;
+}
+inline uint32_t OHLCFixed::_internal_price_scale() const {
+  return _impl_.price_scale_;
+}
+inline uint32_t OHLCFixed::price_scale() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCFixed.price_scale)
+  return _internal_price_scale();
+}
+inline void OHLCFixed::_internal_set_price_scale(uint32_t value) {
+  
+  _impl_.price_scale_ = value;
+}
+inline void OHLCFixed::set_price_scale(uint32_t value) {
+  _internal_set_price_scale(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCFixed.price_scale)
+}
+
+// string stock_code = 8;
+inline void OHLCFixed::clear_stock_code() {
+  _impl_.stock_code_.ClearToEmpty();
+}
+inline const std::string& OHLCFixed::stock_code() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCFixed.stock_code)
+  return _internal_stock_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OHLCFixed::set_stock_code(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.stock_code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ohlc.OHLCFixed.stock_code)
+}
+inline std::string* OHLCFixed::mutable_stock_code() {
+  std::string* _s = _internal_mutable_stock_code();
+  // @@protoc_insertion_point(field_mutable:ohlc.OHLCFixed.stock_code)
+  return _s;
+}
+inline const std::string& OHLCFixed::_internal_stock_code() const {
+  return _impl_.stock_code_.Get();
+}
+inline void OHLCFixed::_internal_set_stock_code(const std::string& value) {
+  
+  _impl_.stock_code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OHLCFixed::_internal_mutable_stock_code() {
+  
+  return _impl_.stock_code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OHLCFixed::release_stock_code() {
+  // @@protoc_insertion_point(field_release:ohlc.OHLCFixed.stock_code)
+  return _impl_.stock_code_.Release();
+}
+inline void OHLCFixed::set_allocated_stock_code(std::string* stock_code) {
+  if (stock_code != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.stock_code_.SetAllocated(stock_code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.stock_code_.IsDefault()) {
+    _impl_.stock_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ohlc.OHLCFixed.stock_code)
+}
+
+// uint32 symbol_id = 9;
+inline void OHLCFixed::clear_symbol_id() {
+  _impl_.symbol_id_ = 0u;
+}
+inline uint32_t OHLCFixed::_internal_symbol_id() const {
+  return _impl_.symbol_id_;
+}
+inline uint32_t OHLCFixed::symbol_id() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCFixed.symbol_id)
+  return _internal_symbol_id();
+}
+inline void OHLCFixed::_internal_set_symbol_id(uint32_t value) {
+  
+  _impl_.symbol_id_ = value;
+}
+inline void OHLCFixed::set_symbol_id(uint32_t value) {
+  _internal_set_symbol_id(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCFixed.symbol_id)
+}
+
+// uint64 sequence = 10;
+inline void OHLCFixed::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t OHLCFixed::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t OHLCFixed::sequence() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCFixed.sequence)
+  return _internal_sequence();
+}
+inline void OHLCFixed::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void OHLCFixed::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCFixed.sequence)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// OHLCColumns
+
+// uint32 price_scale = 1;
+inline void OHLCColumns::clear_price_scale() {
+  _impl_.price_scale_ = 0u;
+}
+inline uint32_t OHLCColumns::_internal_price_scale() const {
+  return _impl_.price_scale_;
+}
+inline uint32_t OHLCColumns::price_scale() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCColumns.price_scale)
+  return _internal_price_scale();
+}
+inline void OHLCColumns::_internal_set_price_scale(uint32_t value) {
+  
+  _impl_.price_scale_ = value;
+}
+inline void OHLCColumns::set_price_scale(uint32_t value) {
+  _internal_set_price_scale(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCColumns.price_scale)
+}
+
+// map<uint32, string> symbol_names = 2;
+inline int OHLCColumns::_internal_symbol_names_size() const {
+  return _impl_.symbol_names_.size();
+}
+inline int OHLCColumns::symbol_names_size() const {
+  return _internal_symbol_names_size();
+}
+inline void OHLCColumns::clear_symbol_names() {
+  _impl_.symbol_names_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, std::string >&
+OHLCColumns::_internal_symbol_names() const {
+  return _impl_.symbol_names_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, std::string >&
+OHLCColumns::symbol_names() const {
+  // @@protoc_insertion_point(field_map:ohlc.OHLCColumns.symbol_names)
+  return _internal_symbol_names();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, std::string >*
+OHLCColumns::_internal_mutable_symbol_names() {
+  return _impl_.symbol_names_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, std::string >*
+OHLCColumns::mutable_symbol_names() {
+  // @@protoc_insertion_point(field_mutable_map:ohlc.OHLCColumns.symbol_names)
+  return _internal_mutable_symbol_names();
+}
+
+// repeated uint32 symbol_ids = 3;
+inline int OHLCColumns::_internal_symbol_ids_size() const {
+  return _impl_.symbol_ids_.size();
+}
+inline int OHLCColumns::symbol_ids_size() const {
+  return _internal_symbol_ids_size();
+}
+inline void OHLCColumns::clear_symbol_ids() {
+  _impl_.symbol_ids_.Clear();
+}
+inline uint32_t OHLCColumns::_internal_symbol_ids(int index) const {
+  return _impl_.symbol_ids_.Get(index);
+}
+inline uint32_t OHLCColumns::symbol_ids(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCColumns.symbol_ids)
+  return _internal_symbol_ids(index);
+}
+inline void OHLCColumns::set_symbol_ids(int index, uint32_t value) {
+  _impl_.symbol_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCColumns.symbol_ids)
+}
+inline void OHLCColumns::_internal_add_symbol_ids(uint32_t value) {
+  _impl_.symbol_ids_.Add(value);
+}
+inline void OHLCColumns::add_symbol_ids(uint32_t value) {
+  _internal_add_symbol_ids(value);
+  // @@protoc_insertion_point(field_add:ohlc.OHLCColumns.symbol_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+OHLCColumns::_internal_symbol_ids() const {
+  return _impl_.symbol_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+OHLCColumns::symbol_ids() const {
+  // @@protoc_insertion_point(field_list:ohlc.OHLCColumns.symbol_ids)
+  return _internal_symbol_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+OHLCColumns::_internal_mutable_symbol_ids() {
+  return &_impl_.symbol_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+OHLCColumns::mutable_symbol_ids() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.OHLCColumns.symbol_ids)
+  return _internal_mutable_symbol_ids();
+}
+
+// repeated sint64 open = 4;
+inline int OHLCColumns::_internal_open_size() const {
+  return _impl_.open_.size();
+}
+inline int OHLCColumns::open_size() const {
+  return _internal_open_size();
+}
+inline void OHLCColumns::clear_open() {
+  _impl_.open_.Clear();
+}
+inline int64_t OHLCColumns::_internal_open(int index) const {
+  return _impl_.open_.Get(index);
+}
+inline int64_t OHLCColumns::open(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCColumns.open)
+  return _internal_open(index);
+}
+inline void OHLCColumns::set_open(int index, int64_t value) {
+  _impl_.open_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCColumns.open)
+}
+inline void OHLCColumns::_internal_add_open(int64_t value) {
+  _impl_.open_.Add(value);
+}
+inline void OHLCColumns::add_open(int64_t value) {
+  _internal_add_open(value);
+  // @@protoc_insertion_point(field_add:ohlc.OHLCColumns.open)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+OHLCColumns::_internal_open() const {
+  return _impl_.open_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+OHLCColumns::open() const {
+  // @@protoc_insertion_point(field_list:ohlc.OHLCColumns.open)
+  return _internal_open();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+OHLCColumns::_internal_mutable_open() {
+  return &_impl_.open_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+OHLCColumns::mutable_open() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.OHLCColumns.open)
+  return _internal_mutable_open();
+}
+
+// repeated sint64 high_minus_open = 5;
+inline int OHLCColumns::_internal_high_minus_open_size() const {
+  return _impl_.high_minus_open_.size();
+}
+inline int OHLCColumns::high_minus_open_size() const {
+  return _internal_high_minus_open_size();
+}
+inline void OHLCColumns::clear_high_minus_open() {
+  _impl_.high_minus_open_.Clear();
+}
+inline int64_t OHLCColumns::_internal_high_minus_open(int index) const {
+  return _impl_.high_minus_open_.Get(index);
+}
+inline int64_t OHLCColumns::high_minus_open(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCColumns.high_minus_open)
+  return _internal_high_minus_open(index);
+}
+inline void OHLCColumns::set_high_minus_open(int index, int64_t value) {
+  _impl_.high_minus_open_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCColumns.high_minus_open)
+}
+inline void OHLCColumns::_internal_add_high_minus_open(int64_t value) {
+  _impl_.high_minus_open_.Add(value);
+}
+inline void OHLCColumns::add_high_minus_open(int64_t value) {
+  _internal_add_high_minus_open(value);
+  // @@protoc_insertion_point(field_add:ohlc.OHLCColumns.high_minus_open)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+OHLCColumns::_internal_high_minus_open() const {
+  return _impl_.high_minus_open_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+OHLCColumns::high_minus_open() const {
+  // @@protoc_insertion_point(field_list:ohlc.OHLCColumns.high_minus_open)
+  return _internal_high_minus_open();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+OHLCColumns::_internal_mutable_high_minus_open() {
+  return &_impl_.high_minus_open_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+OHLCColumns::mutable_high_minus_open() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.OHLCColumns.high_minus_open)
+  return _internal_mutable_high_minus_open();
+}
+
+// repeated sint64 low_minus_open = 6;
+inline int OHLCColumns::_internal_low_minus_open_size() const {
+  return _impl_.low_minus_open_.size();
+}
+inline int OHLCColumns::low_minus_open_size() const {
+  return _internal_low_minus_open_size();
+}
+inline void OHLCColumns::clear_low_minus_open() {
+  _impl_.low_minus_open_.Clear();
+}
+inline int64_t OHLCColumns::_internal_low_minus_open(int index) const {
+  return _impl_.low_minus_open_.Get(index);
+}
+inline int64_t OHLCColumns::low_minus_open(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCColumns.low_minus_open)
+  return _internal_low_minus_open(index);
+}
+inline void OHLCColumns::set_low_minus_open(int index, int64_t value) {
+  _impl_.low_minus_open_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCColumns.low_minus_open)
+}
+inline void OHLCColumns::_internal_add_low_minus_open(int64_t value) {
+  _impl_.low_minus_open_.Add(value);
+}
+inline void OHLCColumns::add_low_minus_open(int64_t value) {
+  _internal_add_low_minus_open(value);
+  // @@protoc_insertion_point(field_add:ohlc.OHLCColumns.low_minus_open)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+OHLCColumns::_internal_low_minus_open() const {
+  return _impl_.low_minus_open_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+OHLCColumns::low_minus_open() const {
+  // @@protoc_insertion_point(field_list:ohlc.OHLCColumns.low_minus_open)
+  return _internal_low_minus_open();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+OHLCColumns::_internal_mutable_low_minus_open() {
+  return &_impl_.low_minus_open_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+OHLCColumns::mutable_low_minus_open() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.OHLCColumns.low_minus_open)
+  return _internal_mutable_low_minus_open();
+}
+
+// repeated sint64 close_minus_open = 7;
+inline int OHLCColumns::_internal_close_minus_open_size() const {
+  return _impl_.close_minus_open_.size();
+}
+inline int OHLCColumns::close_minus_open_size() const {
+  return _internal_close_minus_open_size();
+}
+inline void OHLCColumns::clear_close_minus_open() {
+  _impl_.close_minus_open_.Clear();
+}
+inline int64_t OHLCColumns::_internal_close_minus_open(int index) const {
+  return _impl_.close_minus_open_.Get(index);
+}
+inline int64_t OHLCColumns::close_minus_open(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCColumns.close_minus_open)
+  return _internal_close_minus_open(index);
+}
+inline void OHLCColumns::set_close_minus_open(int index, int64_t value) {
+  _impl_.close_minus_open_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCColumns.close_minus_open)
+}
+inline void OHLCColumns::_internal_add_close_minus_open(int64_t value) {
+  _impl_.close_minus_open_.Add(value);
+}
+inline void OHLCColumns::add_close_minus_open(int64_t value) {
+  _internal_add_close_minus_open(value);
+  // @@protoc_insertion_point(field_add:ohlc.OHLCColumns.close_minus_open)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+OHLCColumns::_internal_close_minus_open() const {
+  return _impl_.close_minus_open_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+OHLCColumns::close_minus_open() const {
+  // @@protoc_insertion_point(field_list:ohlc.OHLCColumns.close_minus_open)
+  return _internal_close_minus_open();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+OHLCColumns::_internal_mutable_close_minus_open() {
+  return &_impl_.close_minus_open_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+OHLCColumns::mutable_close_minus_open() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.OHLCColumns.close_minus_open)
+  return _internal_mutable_close_minus_open();
+}
+
+// repeated int64 volume = 8;
+inline int OHLCColumns::_internal_volume_size() const {
+  return _impl_.volume_.size();
+}
+inline int OHLCColumns::volume_size() const {
+  return _internal_volume_size();
+}
+inline void OHLCColumns::clear_volume() {
+  _impl_.volume_.Clear();
+}
+inline int64_t OHLCColumns::_internal_volume(int index) const {
+  return _impl_.volume_.Get(index);
+}
+inline int64_t OHLCColumns::volume(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCColumns.volume)
+  return _internal_volume(index);
+}
+inline void OHLCColumns::set_volume(int index, int64_t value) {
+  _impl_.volume_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCColumns.volume)
+}
+inline void OHLCColumns::_internal_add_volume(int64_t value) {
+  _impl_.volume_.Add(value);
+}
+inline void OHLCColumns::add_volume(int64_t value) {
+  _internal_add_volume(value);
+  // @@protoc_insertion_point(field_add:ohlc.OHLCColumns.volume)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+OHLCColumns::_internal_volume() const {
+  return _impl_.volume_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+OHLCColumns::volume() const {
+  // @@protoc_insertion_point(field_list:ohlc.OHLCColumns.volume)
+  return _internal_volume();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+OHLCColumns::_internal_mutable_volume() {
+  return &_impl_.volume_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+OHLCColumns::mutable_volume() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.OHLCColumns.volume)
+  return _internal_mutable_volume();
+}
+
+// repeated int64 value = 9;
+inline int OHLCColumns::_internal_value_size() const {
+  return _impl_.value_.size();
+}
+inline int OHLCColumns::value_size() const {
+  return _internal_value_size();
+}
+inline void OHLCColumns::clear_value() {
+  _impl_.value_.Clear();
+}
+inline int64_t OHLCColumns::_internal_value(int index) const {
+  return _impl_.value_.Get(index);
+}
+inline int64_t OHLCColumns::value(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCColumns.value)
+  return _internal_value(index);
+}
+inline void OHLCColumns::set_value(int index, int64_t value) {
+  _impl_.value_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCColumns.value)
+}
+inline void OHLCColumns::_internal_add_value(int64_t value) {
+  _impl_.value_.Add(value);
+}
+inline void OHLCColumns::add_value(int64_t value) {
+  _internal_add_value(value);
+  // @@protoc_insertion_point(field_add:ohlc.OHLCColumns.value)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+OHLCColumns::_internal_value() const {
+  return _impl_.value_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+OHLCColumns::value() const {
+  // @@protoc_insertion_point(field_list:ohlc.OHLCColumns.value)
+  return _internal_value();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+OHLCColumns::_internal_mutable_value() {
+  return &_impl_.value_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+OHLCColumns::mutable_value() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.OHLCColumns.value)
+  return _internal_mutable_value();
+}
 
+// repeated uint64 sequence = 10;
+inline int OHLCColumns::_internal_sequence_size() const {
+  return _impl_.sequence_.size();
+}
+inline int OHLCColumns::sequence_size() const {
+  return _internal_sequence_size();
+}
+inline void OHLCColumns::clear_sequence() {
+  _impl_.sequence_.Clear();
+}
+inline uint64_t OHLCColumns::_internal_sequence(int index) const {
+  return _impl_.sequence_.Get(index);
+}
+inline uint64_t OHLCColumns::sequence(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCColumns.sequence)
+  return _internal_sequence(index);
+}
+inline void OHLCColumns::set_sequence(int index, uint64_t value) {
+  _impl_.sequence_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCColumns.sequence)
+}
+inline void OHLCColumns::_internal_add_sequence(uint64_t value) {
+  _impl_.sequence_.Add(value);
+}
+inline void OHLCColumns::add_sequence(uint64_t value) {
+  _internal_add_sequence(value);
+  // @@protoc_insertion_point(field_add:ohlc.OHLCColumns.sequence)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+OHLCColumns::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+OHLCColumns::sequence() const {
+  // @@protoc_insertion_point(field_list:ohlc.OHLCColumns.sequence)
+  return _internal_sequence();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+OHLCColumns::_internal_mutable_sequence() {
+  return &_impl_.sequence_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+OHLCColumns::mutable_sequence() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.OHLCColumns.sequence)
+  return _internal_mutable_sequence();
+}
 
+// -------------------------------------------------------------------
 
-// ===================================================================
+// StockRequest
 
+// string stock_code = 1;
+inline void StockRequest::clear_stock_code() {
+  _impl_.stock_code_.ClearToEmpty();
+}
+inline const std::string& StockRequest::stock_code() const {
+  // @@protoc_insertion_point(field_get:ohlc.StockRequest.stock_code)
+  return _internal_stock_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StockRequest::set_stock_code(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.stock_code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ohlc.StockRequest.stock_code)
+}
+inline std::string* StockRequest::mutable_stock_code() {
+  std::string* _s = _internal_mutable_stock_code();
+  // @@protoc_insertion_point(field_mutable:ohlc.StockRequest.stock_code)
+  return _s;
+}
+inline const std::string& StockRequest::_internal_stock_code() const {
+  return _impl_.stock_code_.Get();
+}
+inline void StockRequest::_internal_set_stock_code(const std::string& value) {
+  
+  _impl_.stock_code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StockRequest::_internal_mutable_stock_code() {
+  
+  return _impl_.stock_code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StockRequest::release_stock_code() {
+  // @@protoc_insertion_point(field_release:ohlc.StockRequest.stock_code)
+  return _impl_.stock_code_.Release();
+}
+inline void StockRequest::set_allocated_stock_code(std::string* stock_code) {
+  if (stock_code != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.stock_code_.SetAllocated(stock_code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.stock_code_.IsDefault()) {
+    _impl_.stock_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ohlc.StockRequest.stock_code)
+}
 
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
 // -------------------------------------------------------------------
 
-// OHLC
+// StockBatchRequest
 
-// double open = 1;
-inline void OHLC::clear_open() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.open_ = 0;
+// repeated string stock_codes = 1;
+inline int StockBatchRequest::_internal_stock_codes_size() const {
+  return _impl_.stock_codes_.size();
 }
-inline double OHLC::open() const {
-  // @@protoc_insertion_point(field_get:ohlc.OHLC.open)
-  return _internal_open();
+inline int StockBatchRequest::stock_codes_size() const {
+  return _internal_stock_codes_size();
 }
-inline void OHLC::set_open(double value) {
-  _internal_set_open(value);
-  // @@protoc_insertion_point(field_set:ohlc.OHLC.open)
+inline void StockBatchRequest::clear_stock_codes() {
+  _impl_.stock_codes_.Clear();
 }
-inline double OHLC::_internal_open() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return _impl_.open_;
+inline std::string* StockBatchRequest::add_stock_codes() {
+  std::string* _s = _internal_add_stock_codes();
+  // @@protoc_insertion_point(field_add_mutable:ohlc.StockBatchRequest.stock_codes)
+  return _s;
 }
-inline void OHLC::_internal_set_open(double value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  _impl_.open_ = value;
+inline const std::string& StockBatchRequest::_internal_stock_codes(int index) const {
+  return _impl_.stock_codes_.Get(index);
 }
-
-// double high = 2;
-inline void OHLC::clear_high() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.high_ = 0;
+inline const std::string& StockBatchRequest::stock_codes(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.StockBatchRequest.stock_codes)
+  return _internal_stock_codes(index);
 }
-inline double OHLC::high() const {
-  // @@protoc_insertion_point(field_get:ohlc.OHLC.high)
-  return _internal_high();
+inline std::string* StockBatchRequest::mutable_stock_codes(int index) {
+  // @@protoc_insertion_point(field_mutable:ohlc.StockBatchRequest.stock_codes)
+  return _impl_.stock_codes_.Mutable(index);
 }
-inline void OHLC::set_high(double value) {
-  _internal_set_high(value);
-  // @@protoc_insertion_point(field_set:ohlc.OHLC.high)
+inline void StockBatchRequest::set_stock_codes(int index, const std::string& value) {
+  _impl_.stock_codes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ohlc.StockBatchRequest.stock_codes)
 }
-inline double OHLC::_internal_high() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return _impl_.high_;
+inline void StockBatchRequest::set_stock_codes(int index, std::string&& value) {
+  _impl_.stock_codes_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ohlc.StockBatchRequest.stock_codes)
 }
-inline void OHLC::_internal_set_high(double value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  _impl_.high_ = value;
+inline void StockBatchRequest::set_stock_codes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.stock_codes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ohlc.StockBatchRequest.stock_codes)
 }
-
-// double low = 3;
-inline void OHLC::clear_low() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.low_ = 0;
+inline void StockBatchRequest::set_stock_codes(int index, const char* value, size_t size) {
+  _impl_.stock_codes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ohlc.StockBatchRequest.stock_codes)
 }
-inline double OHLC::low() const {
-  // @@protoc_insertion_point(field_get:ohlc.OHLC.low)
-  return _internal_low();
+inline std::string* StockBatchRequest::_internal_add_stock_codes() {
+  return _impl_.stock_codes_.Add();
 }
-inline void OHLC::set_low(double value) {
-  _internal_set_low(value);
-  // @@protoc_insertion_point(field_set:ohlc.OHLC.low)
+inline void StockBatchRequest::add_stock_codes(const std::string& value) {
+  _impl_.stock_codes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ohlc.StockBatchRequest.stock_codes)
 }
-inline double OHLC::_internal_low() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return _impl_.low_;
+inline void StockBatchRequest::add_stock_codes(std::string&& value) {
+  _impl_.stock_codes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ohlc.StockBatchRequest.stock_codes)
 }
-inline void OHLC::_internal_set_low(double value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  _impl_.low_ = value;
+inline void StockBatchRequest::add_stock_codes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.stock_codes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ohlc.StockBatchRequest.stock_codes)
+}
+inline void StockBatchRequest::add_stock_codes(const char* value, size_t size) {
+  _impl_.stock_codes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ohlc.StockBatchRequest.stock_codes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+StockBatchRequest::stock_codes() const {
+  // @@protoc_insertion_point(field_list:ohlc.StockBatchRequest.stock_codes)
+  return _impl_.stock_codes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+StockBatchRequest::mutable_stock_codes() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.StockBatchRequest.stock_codes)
+  return &_impl_.stock_codes_;
 }
 
-// double close = 4;
-inline void OHLC::clear_close() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.close_ = 0;
+// -------------------------------------------------------------------
+
+// OHLCBatch
+
+// repeated .ohlc.OHLC candles = 1;
+inline int OHLCBatch::_internal_candles_size() const {
+  return _impl_.candles_.size();
 }
-inline double OHLC::close() const {
-  // @@protoc_insertion_point(field_get:ohlc.OHLC.close)
-  return _internal_close();
+inline int OHLCBatch::candles_size() const {
+  return _internal_candles_size();
 }
-inline void OHLC::set_close(double value) {
-  _internal_set_close(value);
-  // @@protoc_insertion_point(field_set:ohlc.OHLC.close)
+inline void OHLCBatch::clear_candles() {
+  _impl_.candles_.Clear();
 }
-inline double OHLC::_internal_close() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return _impl_.close_;
+inline ::ohlc::OHLC* OHLCBatch::mutable_candles(int index) {
+  // @@protoc_insertion_point(field_mutable:ohlc.OHLCBatch.candles)
+  return _impl_.candles_.Mutable(index);
 }
-inline void OHLC::_internal_set_close(double value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  _impl_.close_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ohlc::OHLC >*
+OHLCBatch::mutable_candles() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.OHLCBatch.candles)
+  return &_impl_.candles_;
 }
-
-// double volume = 5;
-inline void OHLC::clear_volume() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.volume_ = 0;
+inline const ::ohlc::OHLC& OHLCBatch::_internal_candles(int index) const {
+  return _impl_.candles_.Get(index);
 }
-inline double OHLC::volume() const {
-  // @@protoc_insertion_point(field_get:ohlc.OHLC.volume)
-  return _internal_volume();
+inline const ::ohlc::OHLC& OHLCBatch::candles(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCBatch.candles)
+  return _internal_candles(index);
 }
-inline void OHLC::set_volume(double value) {
-  _internal_set_volume(value);
-  // @@protoc_insertion_point(field_set:ohlc.OHLC.volume)
+inline ::ohlc::OHLC* OHLCBatch::_internal_add_candles() {
+  return _impl_.candles_.Add();
 }
-inline double OHLC::_internal_volume() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return _impl_.volume_;
+inline ::ohlc::OHLC* OHLCBatch::add_candles() {
+  ::ohlc::OHLC* _add = _internal_add_candles();
+  // @@protoc_insertion_point(field_add:ohlc.OHLCBatch.candles)
+  return _add;
 }
-inline void OHLC::_internal_set_volume(double value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  _impl_.volume_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ohlc::OHLC >&
+OHLCBatch::candles() const {
+  // @@protoc_insertion_point(field_list:ohlc.OHLCBatch.candles)
+  return _impl_.candles_;
 }
 
-// double value = 6;
-inline void OHLC::clear_value() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.value_ = 0;
+// repeated string missing_codes = 2;
+inline int OHLCBatch::_internal_missing_codes_size() const {
+  return _impl_.missing_codes_.size();
 }
-inline double OHLC::value() const {
-  // @@protoc_insertion_point(field_get:ohlc.OHLC.value)
-  return _internal_value();
+inline int OHLCBatch::missing_codes_size() const {
+  return _internal_missing_codes_size();
 }
-inline void OHLC::set_value(double value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:ohlc.OHLC.value)
+inline void OHLCBatch::clear_missing_codes() {
+  _impl_.missing_codes_.Clear();
 }
-inline double OHLC::_internal_value() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return _impl_.value_;
+inline std::string* OHLCBatch::add_missing_codes() {
+  std::string* _s = _internal_add_missing_codes();
+  // @@protoc_insertion_point(field_add_mutable:ohlc.OHLCBatch.missing_codes)
+  return _s;
 }
-inline void OHLC::_internal_set_value(double value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  _impl_.value_ = value;
+inline const std::string& OHLCBatch::_internal_missing_codes(int index) const {
+  return _impl_.missing_codes_.Get(index);
+}
+inline const std::string& OHLCBatch::missing_codes(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCBatch.missing_codes)
+  return _internal_missing_codes(index);
+}
+inline std::string* OHLCBatch::mutable_missing_codes(int index) {
+  // @@protoc_insertion_point(field_mutable:ohlc.OHLCBatch.missing_codes)
+  return _impl_.missing_codes_.Mutable(index);
+}
+inline void OHLCBatch::set_missing_codes(int index, const std::string& value) {
+  _impl_.missing_codes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCBatch.missing_codes)
+}
+inline void OHLCBatch::set_missing_codes(int index, std::string&& value) {
+  _impl_.missing_codes_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ohlc.OHLCBatch.missing_codes)
+}
+inline void OHLCBatch::set_missing_codes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.missing_codes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ohlc.OHLCBatch.missing_codes)
+}
+inline void OHLCBatch::set_missing_codes(int index, const char* value, size_t size) {
+  _impl_.missing_codes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ohlc.OHLCBatch.missing_codes)
+}
+inline std::string* OHLCBatch::_internal_add_missing_codes() {
+  return _impl_.missing_codes_.Add();
+}
+inline void OHLCBatch::add_missing_codes(const std::string& value) {
+  _impl_.missing_codes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ohlc.OHLCBatch.missing_codes)
+}
+inline void OHLCBatch::add_missing_codes(std::string&& value) {
+  _impl_.missing_codes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ohlc.OHLCBatch.missing_codes)
+}
+inline void OHLCBatch::add_missing_codes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.missing_codes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ohlc.OHLCBatch.missing_codes)
+}
+inline void OHLCBatch::add_missing_codes(const char* value, size_t size) {
+  _impl_.missing_codes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ohlc.OHLCBatch.missing_codes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+OHLCBatch::missing_codes() const {
+  // @@protoc_insertion_point(field_list:ohlc.OHLCBatch.missing_codes)
+  return _impl_.missing_codes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+OHLCBatch::mutable_missing_codes() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.OHLCBatch.missing_codes)
+  return &_impl_.missing_codes_;
 }
 
-// string stock_code = 7;
-inline void OHLC::clear_stock_code() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+// -------------------------------------------------------------------
+
+// OHLCRangeRequest
+
+// string stock_code = 1;
+inline void OHLCRangeRequest::clear_stock_code() {
   _impl_.stock_code_.ClearToEmpty();
 }
-inline const std::string& OHLC::stock_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:ohlc.OHLC.stock_code)
+inline const std::string& OHLCRangeRequest::stock_code() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCRangeRequest.stock_code)
   return _internal_stock_code();
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void OHLC::set_stock_code(Arg_&& arg,
-                                                     Args_... args) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  _impl_.stock_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:ohlc.OHLC.stock_code)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OHLCRangeRequest::set_stock_code(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.stock_code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ohlc.OHLCRangeRequest.stock_code)
 }
-inline std::string* OHLC::mutable_stock_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* OHLCRangeRequest::mutable_stock_code() {
   std::string* _s = _internal_mutable_stock_code();
-  // @@protoc_insertion_point(field_mutable:ohlc.OHLC.stock_code)
+  // @@protoc_insertion_point(field_mutable:ohlc.OHLCRangeRequest.stock_code)
   return _s;
 }
-inline const std::string& OHLC::_internal_stock_code() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+inline const std::string& OHLCRangeRequest::_internal_stock_code() const {
   return _impl_.stock_code_.Get();
 }
-inline void OHLC::_internal_set_stock_code(const std::string& value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  _impl_.stock_code_.Set(value, GetArena());
+inline void OHLCRangeRequest::_internal_set_stock_code(const std::string& value) {
+  
+  _impl_.stock_code_.Set(value, GetArenaForAllocation());
 }
-inline std::string* OHLC::_internal_mutable_stock_code() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  return _impl_.stock_code_.Mutable( GetArena());
+inline std::string* OHLCRangeRequest::_internal_mutable_stock_code() {
+  
+  return _impl_.stock_code_.Mutable(GetArenaForAllocation());
 }
-inline std::string* OHLC::release_stock_code() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  // @@protoc_insertion_point(field_release:ohlc.OHLC.stock_code)
+inline std::string* OHLCRangeRequest::release_stock_code() {
+  // @@protoc_insertion_point(field_release:ohlc.OHLCRangeRequest.stock_code)
   return _impl_.stock_code_.Release();
 }
-inline void OHLC::set_allocated_stock_code(std::string* value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.stock_code_.SetAllocated(value, GetArena());
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        if (_impl_.stock_code_.IsDefault()) {
-          _impl_.stock_code_.Set("", GetArena());
-        }
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:ohlc.OHLC.stock_code)
+inline void OHLCRangeRequest::set_allocated_stock_code(std::string* stock_code) {
+  if (stock_code != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.stock_code_.SetAllocated(stock_code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.stock_code_.IsDefault()) {
+    _impl_.stock_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ohlc.OHLCRangeRequest.stock_code)
+}
+
+// uint64 interval = 2;
+inline void OHLCRangeRequest::clear_interval() {
+  _impl_.interval_ = uint64_t{0u};
+}
+inline uint64_t OHLCRangeRequest::_internal_interval() const {
+  return _impl_.interval_;
+}
+inline uint64_t OHLCRangeRequest::interval() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCRangeRequest.interval)
+  return _internal_interval();
+}
+inline void OHLCRangeRequest::_internal_set_interval(uint64_t value) {
+  
+  _impl_.interval_ = value;
+}
+inline void OHLCRangeRequest::set_interval(uint64_t value) {
+  _internal_set_interval(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCRangeRequest.interval)
+}
+
+// uint64 from_time = 3;
+inline void OHLCRangeRequest::clear_from_time() {
+  _impl_.from_time_ = uint64_t{0u};
+}
+inline uint64_t OHLCRangeRequest::_internal_from_time() const {
+  return _impl_.from_time_;
+}
+inline uint64_t OHLCRangeRequest::from_time() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCRangeRequest.from_time)
+  return _internal_from_time();
+}
+inline void OHLCRangeRequest::_internal_set_from_time(uint64_t value) {
+  
+  _impl_.from_time_ = value;
+}
+inline void OHLCRangeRequest::set_from_time(uint64_t value) {
+  _internal_set_from_time(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCRangeRequest.from_time)
+}
+
+// uint64 to_time = 4;
+inline void OHLCRangeRequest::clear_to_time() {
+  _impl_.to_time_ = uint64_t{0u};
+}
+inline uint64_t OHLCRangeRequest::_internal_to_time() const {
+  return _impl_.to_time_;
+}
+inline uint64_t OHLCRangeRequest::to_time() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCRangeRequest.to_time)
+  return _internal_to_time();
+}
+inline void OHLCRangeRequest::_internal_set_to_time(uint64_t value) {
+  
+  _impl_.to_time_ = value;
+}
+inline void OHLCRangeRequest::set_to_time(uint64_t value) {
+  _internal_set_to_time(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCRangeRequest.to_time)
+}
+
+// uint32 page_size = 5;
+inline void OHLCRangeRequest::clear_page_size() {
+  _impl_.page_size_ = 0u;
+}
+inline uint32_t OHLCRangeRequest::_internal_page_size() const {
+  return _impl_.page_size_;
+}
+inline uint32_t OHLCRangeRequest::page_size() const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCRangeRequest.page_size)
+  return _internal_page_size();
+}
+inline void OHLCRangeRequest::_internal_set_page_size(uint32_t value) {
+  
+  _impl_.page_size_ = value;
+}
+inline void OHLCRangeRequest::set_page_size(uint32_t value) {
+  _internal_set_page_size(value);
+  // @@protoc_insertion_point(field_set:ohlc.OHLCRangeRequest.page_size)
 }
 
 // -------------------------------------------------------------------
 
-// StockRequest
+// OHLCPage
 
-// string stock_code = 1;
-inline void StockRequest::clear_stock_code() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.stock_code_.ClearToEmpty();
+// repeated .ohlc.OHLC candles = 1;
+inline int OHLCPage::_internal_candles_size() const {
+  return _impl_.candles_.size();
 }
-inline const std::string& StockRequest::stock_code() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:ohlc.StockRequest.stock_code)
-  return _internal_stock_code();
+inline int OHLCPage::candles_size() const {
+  return _internal_candles_size();
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void StockRequest::set_stock_code(Arg_&& arg,
-                                                     Args_... args) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  _impl_.stock_code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:ohlc.StockRequest.stock_code)
+inline void OHLCPage::clear_candles() {
+  _impl_.candles_.Clear();
 }
-inline std::string* StockRequest::mutable_stock_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_stock_code();
-  // @@protoc_insertion_point(field_mutable:ohlc.StockRequest.stock_code)
+inline ::ohlc::OHLC* OHLCPage::mutable_candles(int index) {
+  // @@protoc_insertion_point(field_mutable:ohlc.OHLCPage.candles)
+  return _impl_.candles_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ohlc::OHLC >*
+OHLCPage::mutable_candles() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.OHLCPage.candles)
+  return &_impl_.candles_;
+}
+inline const ::ohlc::OHLC& OHLCPage::_internal_candles(int index) const {
+  return _impl_.candles_.Get(index);
+}
+inline const ::ohlc::OHLC& OHLCPage::candles(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.OHLCPage.candles)
+  return _internal_candles(index);
+}
+inline ::ohlc::OHLC* OHLCPage::_internal_add_candles() {
+  return _impl_.candles_.Add();
+}
+inline ::ohlc::OHLC* OHLCPage::add_candles() {
+  ::ohlc::OHLC* _add = _internal_add_candles();
+  // @@protoc_insertion_point(field_add:ohlc.OHLCPage.candles)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ohlc::OHLC >&
+OHLCPage::candles() const {
+  // @@protoc_insertion_point(field_list:ohlc.OHLCPage.candles)
+  return _impl_.candles_;
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeRequest
+
+// repeated string stock_codes = 1;
+inline int SubscribeRequest::_internal_stock_codes_size() const {
+  return _impl_.stock_codes_.size();
+}
+inline int SubscribeRequest::stock_codes_size() const {
+  return _internal_stock_codes_size();
+}
+inline void SubscribeRequest::clear_stock_codes() {
+  _impl_.stock_codes_.Clear();
+}
+inline std::string* SubscribeRequest::add_stock_codes() {
+  std::string* _s = _internal_add_stock_codes();
+  // @@protoc_insertion_point(field_add_mutable:ohlc.SubscribeRequest.stock_codes)
   return _s;
 }
-inline const std::string& StockRequest::_internal_stock_code() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
-  return _impl_.stock_code_.Get();
+inline const std::string& SubscribeRequest::_internal_stock_codes(int index) const {
+  return _impl_.stock_codes_.Get(index);
 }
-inline void StockRequest::_internal_set_stock_code(const std::string& value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  _impl_.stock_code_.Set(value, GetArena());
+inline const std::string& SubscribeRequest::stock_codes(int index) const {
+  // @@protoc_insertion_point(field_get:ohlc.SubscribeRequest.stock_codes)
+  return _internal_stock_codes(index);
 }
-inline std::string* StockRequest::_internal_mutable_stock_code() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  return _impl_.stock_code_.Mutable( GetArena());
+inline std::string* SubscribeRequest::mutable_stock_codes(int index) {
+  // @@protoc_insertion_point(field_mutable:ohlc.SubscribeRequest.stock_codes)
+  return _impl_.stock_codes_.Mutable(index);
 }
-inline std::string* StockRequest::release_stock_code() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  // @@protoc_insertion_point(field_release:ohlc.StockRequest.stock_code)
-  return _impl_.stock_code_.Release();
+inline void SubscribeRequest::set_stock_codes(int index, const std::string& value) {
+  _impl_.stock_codes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ohlc.SubscribeRequest.stock_codes)
 }
-inline void StockRequest::set_allocated_stock_code(std::string* value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.stock_code_.SetAllocated(value, GetArena());
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        if (_impl_.stock_code_.IsDefault()) {
-          _impl_.stock_code_.Set("", GetArena());
-        }
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:ohlc.StockRequest.stock_code)
+inline void SubscribeRequest::set_stock_codes(int index, std::string&& value) {
+  _impl_.stock_codes_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ohlc.SubscribeRequest.stock_codes)
+}
+inline void SubscribeRequest::set_stock_codes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.stock_codes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ohlc.SubscribeRequest.stock_codes)
+}
+inline void SubscribeRequest::set_stock_codes(int index, const char* value, size_t size) {
+  _impl_.stock_codes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ohlc.SubscribeRequest.stock_codes)
+}
+inline std::string* SubscribeRequest::_internal_add_stock_codes() {
+  return _impl_.stock_codes_.Add();
+}
+inline void SubscribeRequest::add_stock_codes(const std::string& value) {
+  _impl_.stock_codes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ohlc.SubscribeRequest.stock_codes)
+}
+inline void SubscribeRequest::add_stock_codes(std::string&& value) {
+  _impl_.stock_codes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ohlc.SubscribeRequest.stock_codes)
+}
+inline void SubscribeRequest::add_stock_codes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.stock_codes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ohlc.SubscribeRequest.stock_codes)
+}
+inline void SubscribeRequest::add_stock_codes(const char* value, size_t size) {
+  _impl_.stock_codes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ohlc.SubscribeRequest.stock_codes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SubscribeRequest::stock_codes() const {
+  // @@protoc_insertion_point(field_list:ohlc.SubscribeRequest.stock_codes)
+  return _impl_.stock_codes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SubscribeRequest::mutable_stock_codes() {
+  // @@protoc_insertion_point(field_mutable_list:ohlc.SubscribeRequest.stock_codes)
+  return &_impl_.stock_codes_;
 }
 
 // -------------------------------------------------------------------
@@ -963,67 +3591,83 @@ inline void StockRequest::set_allocated_stock_code(std::string* value) {
 
 // string message = 1;
 inline void SendOHLCResponse::clear_message() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_.message_.ClearToEmpty();
 }
-inline const std::string& SendOHLCResponse::message() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const std::string& SendOHLCResponse::message() const {
   // @@protoc_insertion_point(field_get:ohlc.SendOHLCResponse.message)
   return _internal_message();
 }
-template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void SendOHLCResponse::set_message(Arg_&& arg,
-                                                     Args_... args) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  _impl_.message_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendOHLCResponse::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ohlc.SendOHLCResponse.message)
 }
-inline std::string* SendOHLCResponse::mutable_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* SendOHLCResponse::mutable_message() {
   std::string* _s = _internal_mutable_message();
   // @@protoc_insertion_point(field_mutable:ohlc.SendOHLCResponse.message)
   return _s;
 }
 inline const std::string& SendOHLCResponse::_internal_message() const {
-  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
   return _impl_.message_.Get();
 }
 inline void SendOHLCResponse::_internal_set_message(const std::string& value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  _impl_.message_.Set(value, GetArena());
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* SendOHLCResponse::_internal_mutable_message() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  ;
-  return _impl_.message_.Mutable( GetArena());
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* SendOHLCResponse::release_message() {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   // @@protoc_insertion_point(field_release:ohlc.SendOHLCResponse.message)
   return _impl_.message_.Release();
 }
-inline void SendOHLCResponse::set_allocated_message(std::string* value) {
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  _impl_.message_.SetAllocated(value, GetArena());
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-        if (_impl_.message_.IsDefault()) {
-          _impl_.message_.Set("", GetArena());
-        }
-  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void SendOHLCResponse::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ohlc.SendOHLCResponse.message)
 }
 
 #ifdef __GNUC__
-#pragma GCC diagnostic pop
+  #pragma GCC diagnostic pop
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
-}  // namespace ohlc
 
+}  // namespace ohlc
 
 // @@protoc_insertion_point(global_scope)
 
-#include "google/protobuf/port_undef.inc"
-
-#endif  // GOOGLE_PROTOBUF_INCLUDED_ohlc_2eproto_2epb_2eh
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ohlc_2eproto
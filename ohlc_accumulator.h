@@ -0,0 +1,50 @@
+#ifndef OHLC_ACCUMULATOR_H
+#define OHLC_ACCUMULATOR_H
+
+#include <algorithm>
+#include <cstdint>
+
+// Running candle over a sequence of ticks: O(1) time per tick and a fixed
+// size, no matter how many ticks a symbol sees.
+struct OHLCAccumulator {
+    double open = 0.0;
+    double high = 0.0;
+    double low = 0.0;
+    double close = 0.0;
+    int64_t volume = 0;
+    double value = 0.0;
+    uint64_t ticks = 0;
+
+    void add(double price, int quantity) {
+        if (ticks == 0) {
+            open = high = low = price;
+        } else {
+            high = std::max(high, price);
+            low = std::min(low, price);
+        }
+        close = price;
+        volume += quantity;
+        value += quantity * price;
+        ++ticks;
+    }
+
+    // Folds in a candle built from ticks that came after this one's: open
+    // stays the earliest price, close becomes the latest.
+    void merge(const OHLCAccumulator& later) {
+        if (later.ticks == 0) {
+            return;
+        }
+        if (ticks == 0) {
+            *this = later;
+            return;
+        }
+        high = std::max(high, later.high);
+        low = std::min(low, later.low);
+        close = later.close;
+        volume += later.volume;
+        value += later.value;
+        ticks += later.ticks;
+    }
+};
+
+#endif // OHLC_ACCUMULATOR_H
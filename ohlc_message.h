@@ -0,0 +1,154 @@
+#ifndef OHLC_MESSAGE_H
+#define OHLC_MESSAGE_H
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include "ohlc.pb.h"
+#include "ohlc_accumulator.h"
+#include "shm_ring.h"
+
+// Copies a running candle into the message sent to the consumer.
+inline void fillOHLCProtobuf(const OHLCAccumulator& ohlc, const std::string& stockCode, ohlc::OHLC& request) {
+    request.set_stock_code(stockCode);
+    request.set_open(ohlc.open);
+    request.set_high(ohlc.high);
+    request.set_low(ohlc.low);
+    request.set_close(ohlc.close);
+    request.set_volume(ohlc.volume);
+    request.set_value(ohlc.value);
+}
+
+// Largest price_scale either side accepts. 10^18 itself fits an int64, but a
+// price only does while price * 10^price_scale stays below 2^63: a traded
+// value in the trillions is out of range from price_scale 7 on, so the
+// senders check every candle with toFixedPoint rather than trust the scale.
+constexpr uint32_t maxPriceScale = 18;
+
+inline double priceScaleFactor(uint32_t priceScale) {
+    return std::pow(10.0, static_cast<double>(priceScale));
+}
+
+// price * factor rounded into fixed. False, leaving fixed alone, when that is
+// not finite or does not fit an int64.
+inline bool toFixedPoint(double price, double factor, int64_t& fixed) {
+    const double scaled = std::round(price * factor);
+    if (!(std::fabs(scaled) < 9223372036854775808.0)) {
+        return false;
+    }
+    fixed = static_cast<int64_t>(scaled);
+    return true;
+}
+
+// Version 2 of fillOHLCProtobuf. symbolId is left 0 and only set by senders
+// that keep a symbol table for the call. False, leaving request alone, when
+// a price does not fit priceScale.
+inline bool fillOHLCFixed(const OHLCAccumulator& ohlc, const std::string& stockCode, uint32_t priceScale, ohlc::OHLCFixed& request) {
+    const double factor = priceScaleFactor(priceScale);
+    int64_t open, high, low, close, value;
+    if (!toFixedPoint(ohlc.open, factor, open) || !toFixedPoint(ohlc.high, factor, high) || !toFixedPoint(ohlc.low, factor, low) ||
+        !toFixedPoint(ohlc.close, factor, close) || !toFixedPoint(ohlc.value, factor, value)) {
+        return false;
+    }
+    request.set_stock_code(stockCode);
+    request.set_open(open);
+    request.set_high(high);
+    request.set_low(low);
+    request.set_close(close);
+    request.set_volume(ohlc.volume);
+    request.set_value(value);
+    request.set_price_scale(priceScale);
+    return true;
+}
+
+// Appends one candle as a row of batch, whose price_scale the caller set.
+// False, leaving batch alone, when a price or its difference from open does
+// not fit that scale.
+inline bool appendOHLCColumns(const OHLCAccumulator& ohlc, uint32_t symbolId, ohlc::OHLCColumns& batch) {
+    const double factor = priceScaleFactor(batch.price_scale());
+    int64_t open, high, low, close, value;
+    if (!toFixedPoint(ohlc.open, factor, open) || !toFixedPoint(ohlc.high, factor, high) || !toFixedPoint(ohlc.low, factor, low) ||
+        !toFixedPoint(ohlc.close, factor, close) || !toFixedPoint(ohlc.value, factor, value)) {
+        return false;
+    }
+    int64_t highMinusOpen, lowMinusOpen, closeMinusOpen;
+    if (__builtin_sub_overflow(high, open, &highMinusOpen) || __builtin_sub_overflow(low, open, &lowMinusOpen) ||
+        __builtin_sub_overflow(close, open, &closeMinusOpen)) {
+        return false;
+    }
+    batch.add_symbol_ids(symbolId);
+    batch.add_open(open);
+    batch.add_high_minus_open(highMinusOpen);
+    batch.add_low_minus_open(lowMinusOpen);
+    batch.add_close_minus_open(closeMinusOpen);
+    batch.add_volume(ohlc.volume);
+    batch.add_value(value);
+    return true;
+}
+
+// The version 1 candle a version 2 one stands for, which is what the server
+// stores and serves.
+inline void readOHLCFixed(const ohlc::OHLCFixed& candle, const std::string& stockCode, ohlc::OHLC& ohlcData) {
+    const double factor = priceScaleFactor(candle.price_scale());
+    ohlcData.set_stock_code(stockCode);
+    ohlcData.set_open(candle.open() / factor);
+    ohlcData.set_high(candle.high() / factor);
+    ohlcData.set_low(candle.low() / factor);
+    ohlcData.set_close(candle.close() / factor);
+    ohlcData.set_volume(static_cast<double>(candle.volume()));
+    ohlcData.set_value(candle.value() / factor);
+    ohlcData.set_sequence(candle.sequence());
+}
+
+// Row row of batch as a version 1 candle. The caller checks that every
+// column has the same length.
+inline void readOHLCColumns(const ohlc::OHLCColumns& batch, int row, const std::string& stockCode, ohlc::OHLC& ohlcData) {
+    const double factor = priceScaleFactor(batch.price_scale());
+    const int64_t open = batch.open(row);
+    ohlcData.set_stock_code(stockCode);
+    ohlcData.set_open(open / factor);
+    ohlcData.set_high((open + batch.high_minus_open(row)) / factor);
+    ohlcData.set_low((open + batch.low_minus_open(row)) / factor);
+    ohlcData.set_close((open + batch.close_minus_open(row)) / factor);
+    ohlcData.set_volume(static_cast<double>(batch.volume(row)));
+    ohlcData.set_value(batch.value(row) / factor);
+    ohlcData.set_sequence(batch.sequence_size() != 0 ? batch.sequence(row) : 0);
+}
+
+// Copies a running candle into a shared memory ring slot. False when the
+// stock code does not fit the slot.
+inline bool fillShmCandle(const OHLCAccumulator& ohlc, const std::string& stockCode, uint64_t sequence, ShmCandle& candle) {
+    if (stockCode.size() > ShmCandle::maxStockCode) {
+        return false;
+    }
+    std::memset(candle.stockCode, 0, sizeof(candle.stockCode));
+    std::memcpy(candle.stockCode, stockCode.data(), stockCode.size());
+    candle.open = ohlc.open;
+    candle.high = ohlc.high;
+    candle.low = ohlc.low;
+    candle.close = ohlc.close;
+    candle.volume = ohlc.volume;
+    candle.value = ohlc.value;
+    candle.sequence = sequence;
+    return true;
+}
+
+inline void readShmCandle(const ShmCandle& candle, ohlc::OHLC& ohlcData) {
+    ohlcData.set_stock_code(std::string(candle.code()));
+    ohlcData.set_open(candle.open);
+    ohlcData.set_high(candle.high);
+    ohlcData.set_low(candle.low);
+    ohlcData.set_close(candle.close);
+    ohlcData.set_volume(static_cast<double>(candle.volume));
+    ohlcData.set_value(candle.value);
+    ohlcData.set_sequence(candle.sequence);
+}
+
+inline bool hasEqualColumns(const ohlc::OHLCColumns& batch) {
+    const int rows = batch.symbol_ids_size();
+    return batch.open_size() == rows && batch.high_minus_open_size() == rows && batch.low_minus_open_size() == rows &&
+           batch.close_minus_open_size() == rows && batch.volume_size() == rows && batch.value_size() == rows &&
+           (batch.sequence_size() == 0 || batch.sequence_size() == rows);
+}
+
+#endif // OHLC_MESSAGE_H
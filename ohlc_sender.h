@@ -0,0 +1,292 @@
+#ifndef OHLC_SENDER_H
+#define OHLC_SENDER_H
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <grpc++/grpc++.h>
+#include "ohlc.grpc.pb.h"
+#include "candle_buckets.h"
+#include "ohlc_accumulator.h"
+#include "ohlc_message.h"
+#include "shm_ring.h"
+#include "symbol_table.h"
+
+enum class SendMode {
+    Unary,
+    Stream,
+    Async,
+    Shm
+};
+
+// Message layout of a stream upload: version 1 OHLC doubles, or version 2
+// fixed-point OHLCColumns batches.
+enum class WireSchema {
+    V1,
+    V2
+};
+
+// How the async sender treats a failed call. Only statuses a retry can fix
+// are retried, after backoff, 2 * backoff, 4 * backoff, ... up to
+// maxBackoffDoublings doublings. Every attempt gets its own deadline so a
+// stuck call cannot hold a window slot forever.
+struct RetryPolicy {
+    static constexpr unsigned maxBackoffDoublings = 16;
+
+    unsigned attempts = 3;
+    std::chrono::milliseconds backoff{50};
+    std::chrono::milliseconds deadline{5000};
+};
+
+inline bool isTransient(const grpc::Status& status) {
+    switch (status.error_code()) {
+        case grpc::StatusCode::UNAVAILABLE:
+        case grpc::StatusCode::DEADLINE_EXCEEDED:
+        case grpc::StatusCode::RESOURCE_EXHAUSTED:
+        case grpc::StatusCode::ABORTED:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Sequence number of id's candle in the senders below: sequences is indexed
+// by SymbolId and may be empty, which sends every candle unnumbered (0).
+inline uint64_t sequenceOf(const std::vector<uint64_t>& sequences, SymbolId id) {
+    return id < sequences.size() ? sequences[id] : 0;
+}
+
+// One blocking SendOHLC per candle, each with its own context. onAck is
+// called with every candle's status.
+template <typename OnAck>
+void sendCandlesUnary(ohlc::OHLCConsumerService::StubInterface& stub, const SymbolMap<OHLCAccumulator>& candles,
+                      const std::vector<SymbolId>& ids, const std::vector<uint64_t>& sequences, OnAck onAck) {
+    for (SymbolId id : ids) {
+        ohlc::OHLC request;
+        fillOHLCProtobuf(candles[id], candles.name(id), request);
+        request.set_sequence(sequenceOf(sequences, id));
+
+        grpc::ClientContext context;
+        ohlc::SendOHLCResponse response;
+        onAck(candles.name(id), stub.SendOHLC(&context, request, &response));
+    }
+}
+
+// All candles on one SendOHLCStream call. Writes are buffered and handed to
+// the transport batchSize at a time, so a batch goes out in as few frames as
+// fit. The returned status and the summary left in response cover every
+// candle on the stream.
+inline grpc::Status sendCandlesStream(ohlc::OHLCConsumerService::StubInterface& stub, const SymbolMap<OHLCAccumulator>& candles,
+                                      const std::vector<SymbolId>& ids, const std::vector<uint64_t>& sequences, size_t batchSize,
+                                      ohlc::SendOHLCResponse& response) {
+    grpc::ClientContext context;
+    std::unique_ptr<grpc::ClientWriterInterface<ohlc::OHLC>> writer = stub.SendOHLCStream(&context, &response);
+
+    ohlc::OHLC request;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        fillOHLCProtobuf(candles[ids[i]], candles.name(ids[i]), request);
+        request.set_sequence(sequenceOf(sequences, ids[i]));
+        grpc::WriteOptions options;
+        if ((i + 1) % batchSize != 0 && i + 1 != ids.size()) {
+            options.set_buffer_hint();
+        }
+        if (!writer->Write(request, options)) {
+            break;
+        }
+    }
+    writer->WritesDone();
+    return writer->Finish();
+}
+
+// Closed interval candles on one SendOHLCStream call, each with its bucket's
+// start_time and interval, for the server's history. names gives the stock
+// code of each candle's symbol.
+inline grpc::Status sendSealedCandlesStream(ohlc::OHLCConsumerService::StubInterface& stub, const SymbolMap<OHLCAccumulator>& names,
+                                            const std::vector<SealedCandle>& sealed, size_t batchSize, ohlc::SendOHLCResponse& response) {
+    grpc::ClientContext context;
+    std::unique_ptr<grpc::ClientWriterInterface<ohlc::OHLC>> writer = stub.SendOHLCStream(&context, &response);
+
+    ohlc::OHLC request;
+    for (size_t i = 0; i < sealed.size(); ++i) {
+        fillOHLCProtobuf(sealed[i].ohlc, names.name(sealed[i].symbol), request);
+        request.set_start_time(sealed[i].start);
+        request.set_interval(sealed[i].interval);
+        grpc::WriteOptions options;
+        if ((i + 1) % batchSize != 0 && i + 1 != sealed.size()) {
+            options.set_buffer_hint();
+        }
+        if (!writer->Write(request, options)) {
+            break;
+        }
+    }
+    writer->WritesDone();
+    return writer->Finish();
+}
+
+// Version 2 of sendCandlesStream: batchSize candles per OHLCColumns
+// message on one SendOHLCColumns call, identified by the producer's symbol
+// ids. Each id is named once, in the first batch that uses it. A candle whose
+// prices do not fit priceScale is never written: it cancels the call and
+// fails it with OUT_OF_RANGE, though batches written before it may already
+// be stored.
+inline grpc::Status sendCandlesColumns(ohlc::OHLCConsumerService::StubInterface& stub, const SymbolMap<OHLCAccumulator>& candles,
+                                       const std::vector<SymbolId>& ids, const std::vector<uint64_t>& sequences, size_t batchSize, uint32_t priceScale,
+                                       ohlc::SendOHLCResponse& response) {
+    grpc::ClientContext context;
+    std::unique_ptr<grpc::ClientWriterInterface<ohlc::OHLCColumns>> writer = stub.SendOHLCColumns(&context, &response);
+
+    std::vector<bool> named;
+    ohlc::OHLCColumns batch;
+    for (size_t start = 0; start < ids.size(); start += batchSize) {
+        batch.Clear();
+        batch.set_price_scale(priceScale);
+        for (size_t i = start; i < std::min(start + batchSize, ids.size()); ++i) {
+            SymbolId id = ids[i];
+            if (id >= named.size()) {
+                named.resize(id + 1, false);
+            }
+            if (!named[id]) {
+                (*batch.mutable_symbol_names())[id] = candles.name(id);
+                named[id] = true;
+            }
+            if (!appendOHLCColumns(candles[id], id, batch)) {
+                context.TryCancel();
+                writer->Finish();
+                return grpc::Status(grpc::StatusCode::OUT_OF_RANGE,
+                                    "Candle of " + candles.name(id) + " does not fit price_scale " + std::to_string(priceScale));
+            }
+            if (!sequences.empty()) {
+                batch.add_sequence(sequenceOf(sequences, id));
+            }
+        }
+        if (!writer->Write(batch)) {
+            break;
+        }
+    }
+    writer->WritesDone();
+    return writer->Finish();
+}
+
+// Writes every candle into a server's shared memory ring, waiting while the
+// ring is full. There is no reply per candle: onAck gets OK once a candle is
+// in the ring, INVALID_ARGUMENT for a stock code too long for a slot, and
+// UNAVAILABLE for it and every later candle once the ring has stayed full
+// for timeout, which means the server stopped reading.
+template <typename OnAck>
+void sendCandlesShm(ShmRing& ring, const SymbolMap<OHLCAccumulator>& candles, const std::vector<SymbolId>& ids,
+                    const std::vector<uint64_t>& sequences, std::chrono::milliseconds timeout, OnAck onAck) {
+    ShmCandle candle;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        SymbolId id = ids[i];
+        if (!fillShmCandle(candles[id], candles.name(id), sequenceOf(sequences, id), candle)) {
+            onAck(candles.name(id), grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "Stock code too long for the shared memory ring"));
+            continue;
+        }
+
+        ShmBackoff backoff;
+        auto start = std::chrono::steady_clock::now();
+        candle.sendTime = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count());
+        while (!ring.tryWrite(candle)) {
+            if (std::chrono::steady_clock::now() - start >= timeout) {
+                for (; i < ids.size(); ++i) {
+                    onAck(candles.name(ids[i]), grpc::Status(grpc::StatusCode::UNAVAILABLE, "Shared memory ring is full"));
+                }
+                return;
+            }
+            backoff.wait();
+        }
+        onAck(candles.name(id), grpc::Status::OK);
+    }
+}
+
+// SendOHLC per candle on a completion queue with up to window calls in
+// flight. A new call starts only when one completes, so a slow server holds
+// the caller back instead of piling up requests. Transient failures are
+// retried per policy with the same sequence number, so a retry of a call
+// the server did save is recognised as a repeat. onAck is called once per
+// candle with its final status, in completion order.
+template <typename OnAck>
+void sendCandlesAsync(ohlc::OHLCConsumerService::StubInterface& stub, const SymbolMap<OHLCAccumulator>& candles,
+                      const std::vector<SymbolId>& ids, const std::vector<uint64_t>& sequences, size_t window,
+                      const RetryPolicy& policy, OnAck onAck) {
+    struct Call {
+        SymbolId id;
+        unsigned attempt;
+        ohlc::OHLC request;
+        grpc::ClientContext context;
+        ohlc::SendOHLCResponse response;
+        grpc::Status status;
+        std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<ohlc::SendOHLCResponse>> reader;
+    };
+    using Clock = std::chrono::system_clock;
+
+    grpc::CompletionQueue queue;
+    std::multimap<Clock::time_point, std::unique_ptr<Call>> retries;
+    size_t next = 0;
+    size_t inFlight = 0;
+
+    auto start = [&](std::unique_ptr<Call> call) {
+        call->context.set_deadline(Clock::now() + policy.deadline);
+        call->reader = stub.PrepareAsyncSendOHLC(&call->context, call->request, &queue);
+        call->reader->StartCall();
+        Call* tag = call.release();
+        tag->reader->Finish(&tag->response, &tag->status, tag);
+        ++inFlight;
+    };
+
+    while (next < ids.size() || inFlight > 0 || !retries.empty()) {
+        Clock::time_point now = Clock::now();
+        while (inFlight < window && !retries.empty() && retries.begin()->first <= now) {
+            start(std::move(retries.begin()->second));
+            retries.erase(retries.begin());
+        }
+        while (inFlight < window && next < ids.size()) {
+            auto call = std::make_unique<Call>();
+            call->id = ids[next++];
+            call->attempt = 1;
+            fillOHLCProtobuf(candles[call->id], candles.name(call->id), call->request);
+            call->request.set_sequence(sequenceOf(sequences, call->id));
+            start(std::move(call));
+        }
+        if (inFlight == 0) {
+            std::this_thread::sleep_until(retries.begin()->first);
+            continue;
+        }
+
+        void* tag = nullptr;
+        bool ok = false;
+        Clock::time_point wakeUp = retries.empty() ? now + policy.deadline : retries.begin()->first;
+        grpc::CompletionQueue::NextStatus result = queue.AsyncNext(&tag, &ok, wakeUp);
+        if (result == grpc::CompletionQueue::TIMEOUT) {
+            continue;
+        }
+        if (result == grpc::CompletionQueue::SHUTDOWN) {
+            break;
+        }
+        std::unique_ptr<Call> call(static_cast<Call*>(tag));
+        --inFlight;
+
+        if (!call->status.ok() && isTransient(call->status) && call->attempt < policy.attempts) {
+            auto retry = std::make_unique<Call>();
+            retry->id = call->id;
+            retry->attempt = call->attempt + 1;
+            retry->request = std::move(call->request);
+            const unsigned doublings = std::min(call->attempt - 1, RetryPolicy::maxBackoffDoublings);
+            retries.emplace(Clock::now() + policy.backoff * (1u << doublings), std::move(retry));
+            continue;
+        }
+        onAck(candles.name(call->id), call->status);
+    }
+    queue.Shutdown();
+    void* tag = nullptr;
+    bool ok = false;
+    while (queue.Next(&tag, &ok)) {
+        delete static_cast<Call*>(tag);
+    }
+}
+
+#endif // OHLC_SENDER_H
@@ -10,8 +10,25 @@
 #include "ohlc.pb.h"
 #include "ohlc.grpc.pb.h"
 #include <filesystem>
-#include <limits>
 #include <stdexcept>
+#include <string_view>
+#include <chrono>
+#include <charconv>
+#include <thread>
+#include <exception>
+#include <algorithm>
+#include <csignal>
+#include <poll.h>
+#include <sys/inotify.h>
+#include "mapped_file.h"
+#include "tick_parser.h"
+#include "ohlc_accumulator.h"
+#include "ohlc_message.h"
+#include "ohlc_sender.h"
+#include "symbol_table.h"
+#include "candle_buckets.h"
+#include "checkpoint.h"
+#include "delta_set.h"
 
 namespace fs = std::filesystem;
 
@@ -30,18 +47,21 @@ public:
             throw ExceptionType(errorMessage);
         }
     }
-};
 
-template <typename ExceptionType>
-struct MyOHLC {
-    double open;
-    double high;
-    double low;
-    double close;
-    int volume;
-    double value;
-    std::vector<double> historicalHighs{std::numeric_limits<double>::lowest()};
-    double lowestPrice;
+    // Same as Handle, but the message is only built if func throws, so
+    // callers on a per-file path do not pay for the string.
+    template <typename Func, typename MessageFunc>
+    static void HandleLazily(Func func, MessageFunc errorMessage) {
+        try {
+            func();
+        } catch (const std::exception& e) {
+            std::cerr << "Exception: " << e.what() << std::endl;
+            throw ExceptionType(errorMessage());
+        } catch (...) {
+            std::cerr << "Unknown exception occurred." << std::endl;
+            throw ExceptionType(errorMessage());
+        }
+    }
 };
 
 class CustomException : public std::exception {
@@ -56,126 +76,769 @@ private:
     std::string message;
 };
 
-using MyOHLCWithException = MyOHLC<CustomException>;
+enum class ReaderMode {
+    Mmap,
+    Getline
+};
+
+struct ProducerOptions {
+    std::string folderPath = "./data";
+    ReaderMode readerMode = ReaderMode::Mmap;
+    unsigned threads = 1;
+    std::vector<uint64_t> intervals;
+    size_t openBuckets = 2;
+    bool throughput = false;
+    bool tail = false;
+    std::string checkpointPath;
+    unsigned checkpointSeconds = 10;
+    SendMode sendMode = SendMode::Stream;
+    size_t sendBatch = 256;
+    WireSchema schema = WireSchema::V1;
+    uint32_t priceScale = 0;
+    size_t sendWindow = 64;
+    RetryPolicy retry;
+    FlushPolicy flush;
+    std::string shmName = defaultShmName;
+};
+
+// Lines of filePath that start in [begin, end). timestamp is the nanosecond
+// time in the file name, used as event time for ticks without their own.
+struct FileRange {
+    std::string filePath;
+    uint64_t timestamp;
+    size_t begin;
+    size_t end;
+};
+
+using OHLCMap = SymbolMap<OHLCAccumulator>;
+
+// What one ingestion thread builds from its run of files.
+struct Shard {
+    explicit Shard(const ProducerOptions& options) : buckets(options.intervals, options.openBuckets) {}
+
+    OHLCMap ohlcMap;
+    CandleBuckets buckets;
+    std::vector<SealedCandle> candles;
+    size_t lines = 0;
+    ParseErrorCounts errors;
+    std::exception_ptr error;
+};
+
+// Write-to-ack latencies of tail mode batches, in microseconds.
+class LatencyStats {
+public:
+    void record(double micros) {
+        samples.push_back(micros);
+    }
+
+    void print(const std::string& label) {
+        if (samples.empty()) {
+            return;
+        }
+        std::sort(samples.begin(), samples.end());
+        auto percentile = [&](double p) {
+            return samples[std::min(samples.size() - 1, static_cast<size_t>(p * samples.size()))];
+        };
+        std::cout << std::fixed << std::setprecision(1) << label << ": " << samples.size() << " batches, p50 "
+                  << percentile(0.50) << " us, p99 " << percentile(0.99) << " us, max " << samples.back() << " us"
+                  << std::defaultfloat << std::endl;
+        samples.clear();
+    }
+
+private:
+    std::vector<double> samples;
+};
+
+volatile std::sig_atomic_t stopRequested = 0;
 
 class OHLCProducer {
 public:
+    explicit OHLCProducer(const ProducerOptions& options)
+        : options(options), readerMode(options.readerMode), threads(std::max(options.threads, 1u)),
+          sendMode(options.sendMode), schema(options.schema) {}
+
+    // Files are ordered by the nanosecond timestamp in their names and split
+    // into one contiguous run of byte ranges per thread. Each thread builds
+    // its own shard and the shards are merged in order, which gives the same
+    // candles as a single serial pass as long as the ticks arrive in time
+    // order. Each shard starts with empty buckets, so when "timestamp" fields
+    // run backwards, which ticks are dropped as late depends on where the
+    // files are split.
+    //
+    // With a checkpoint the folder is read by the single-threaded streaming
+    // path instead, which tracks a byte offset per file and can resume.
     void processFilesInFolder(const std::string& folderPath) {
+        if (!options.checkpointPath.empty()) {
+            streamFolder(folderPath, false);
+            return;
+        }
         ExceptionHandler<CustomException>::Handle([&]() {
-            for (const auto& entry : fs::directory_iterator(folderPath)) {
-                processFile(entry.path().string());
+            auto start = std::chrono::steady_clock::now();
+            std::vector<std::vector<FileRange>> groups = partitionRanges(planRanges(listDataFiles(folderPath)));
+
+            std::vector<Shard> shards(groups.size(), Shard(options));
+            std::vector<std::thread> workers;
+
+            for (size_t i = 1; i < groups.size(); ++i) {
+                workers.emplace_back([&, i]() {
+                    processShard(groups[i], shards[i]);
+                });
+            }
+            if (!groups.empty()) {
+                processShard(groups[0], shards[0]);
+            }
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+            for (const Shard& shard : shards) {
+                if (shard.error) {
+                    std::rethrow_exception(shard.error);
+                }
             }
+
+            size_t lines = 0;
+            size_t lateTicks = 0;
+            ParseErrorCounts errors;
+            for (const Shard& shard : shards) {
+                mergeShard(shard);
+                lines += shard.lines;
+                lateTicks += shard.buckets.lateTicks();
+                errors.merge(shard.errors);
+            }
+            mergeBoundaryCandles();
+
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "Processed " << lines << " lines in " << seconds << " s with "
+                      << groups.size() << " thread(s)" << std::endl;
+            printCandleSummary(lateTicks);
+            printErrorSummary(errors);
         }, "Error processing folder.");
     }
 
-private:
-    void processFile(const std::string& filePath) {
+    const std::vector<SealedCandle>& sealedCandles() const {
+        return candles;
+    }
+
+    // Reads every file with the configured reader without parsing and prints
+    // MB/s and lines/s per file, so the mmap and getline paths can be compared.
+    void measureThroughput(const std::string& folderPath) {
         ExceptionHandler<CustomException>::Handle([&]() {
-            std::ifstream file(filePath);
-            if (!file.is_open()) {
-                throw std::runtime_error("Failed to open file: " + filePath);
+            size_t totalBytes = 0;
+            size_t totalLines = 0;
+            double totalSeconds = 0.0;
+
+            std::cout << std::fixed << std::setprecision(1);
+            for (const auto& entry : listDataFiles(folderPath)) {
+                const std::string filePath = entry.path().string();
+
+                auto start = std::chrono::steady_clock::now();
+                size_t lines = readLines(filePath, [](std::string_view) {});
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+                size_t bytes = entry.file_size();
+                printThroughput(filePath, bytes, lines, seconds);
+                totalBytes += bytes;
+                totalLines += lines;
+                totalSeconds += seconds;
+            }
+            printThroughput("total", totalBytes, totalLines, totalSeconds);
+        }, "Error measuring read throughput.");
+    }
+
+    // Live mode: reads what is already in the folder, sends every candle,
+    // then follows the folder with inotify. Each batch of events reads only
+    // the bytes appended since the last offset of each file; the candles of
+    // the symbols those lines touched are sent as numbered deltas when
+    // --flush-ticks or --flush-interval is reached, or after every batch.
+    //
+    // Latency is measured from the write to the ack of the batch's last
+    // SendOHLC. The write time is the newest "timestamp" field in the batch
+    // when records carry one, otherwise the file's mtime, which the kernel
+    // keeps with a coarse (jiffy) clock.
+    void tailFolder(const std::string& folderPath) {
+        streamFolder(folderPath, true);
+    }
+
+private:
+    static uint64_t fileTimestamp(const fs::path& path) {
+        std::string stem = path.stem().string();
+        size_t dash = stem.rfind('-');
+        std::string_view digits = std::string_view(stem).substr(dash == std::string::npos ? 0 : dash + 1);
+
+        uint64_t timestamp = 0;
+        auto [ptr, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), timestamp);
+        return (ec == std::errc() && ptr == digits.data() + digits.size()) ? timestamp : 0;
+    }
+
+    std::vector<fs::directory_entry> listDataFiles(const std::string& folderPath) {
+        std::vector<fs::directory_entry> files;
+        for (const auto& entry : fs::directory_iterator(folderPath)) {
+            if (entry.is_regular_file()) {
+                files.push_back(entry);
             }
+        }
+
+        std::sort(files.begin(), files.end(), [](const fs::directory_entry& a, const fs::directory_entry& b) {
+            uint64_t timestampA = fileTimestamp(a.path());
+            uint64_t timestampB = fileTimestamp(b.path());
+            return timestampA != timestampB ? timestampA < timestampB : a.path() < b.path();
+        });
+        return files;
+    }
+
+    // Large files are cut into byte ranges so the per-thread runs can be
+    // balanced; getline can only read whole files.
+    std::vector<FileRange> planRanges(const std::vector<fs::directory_entry>& files) {
+        size_t totalBytes = 0;
+        for (const auto& entry : files) {
+            totalBytes += entry.file_size();
+        }
+
+        size_t maxRangeBytes = std::string::npos;
+        if (readerMode == ReaderMode::Mmap && threads > 1) {
+            maxRangeBytes = std::max<size_t>(totalBytes / (threads * 4), 1 << 20);
+        }
 
-            std::string line;
-            while (std::getline(file, line)) {
-                processJSONData(line);
+        std::vector<FileRange> ranges;
+        for (const auto& entry : files) {
+            size_t size = entry.file_size();
+            size_t begin = 0;
+            do {
+                size_t end = size - begin > maxRangeBytes ? begin + maxRangeBytes : size;
+                ranges.push_back({entry.path().string(), fileTimestamp(entry.path()), begin, end});
+                begin = end;
+            } while (begin < size);
+        }
+        return ranges;
+    }
+
+    std::vector<std::vector<FileRange>> partitionRanges(const std::vector<FileRange>& ranges) {
+        size_t totalBytes = 0;
+        for (const FileRange& range : ranges) {
+            totalBytes += range.end - range.begin;
+        }
+
+        std::vector<std::vector<FileRange>> groups(1);
+        size_t assignedBytes = 0;
+        for (const FileRange& range : ranges) {
+            if (groups.size() < threads && !groups.back().empty() &&
+                assignedBytes >= totalBytes * groups.size() / threads) {
+                groups.emplace_back();
             }
-        }, "Error processing file: " + filePath);
+            groups.back().push_back(range);
+            assignedBytes += range.end - range.begin;
+        }
+        return groups;
     }
 
-    void processJSONData(const std::string& jsonDataStr) {
+    // Symbols changed since the last send with their sequence numbers, and
+    // the newest write time seen since then.
+    struct TailBatch {
+        DeltaSet changes;
+        uint64_t writeTime = 0;
+    };
+
+    // Reads the folder from the checkpointed offsets (or from the start) on
+    // a single thread. Without follow it stops once every file is read;
+    // with follow it keeps reading appended lines until stopRequested.
+    // Checkpoints are written every checkpointSeconds between files and
+    // batches, and once more at the end before the open buckets are flushed,
+    // so a resumed run can keep filling them.
+    void streamFolder(const std::string& folderPath, bool follow) {
         ExceptionHandler<CustomException>::Handle([&]() {
-            Json::CharReaderBuilder reader;
-            Json::Value jsonData;
-            std::istringstream iss(jsonDataStr);
+            int inotifyFd = -1;
+            if (follow) {
+                inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+                if (inotifyFd < 0 || inotify_add_watch(inotifyFd, folderPath.c_str(),
+                                                      IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO) < 0) {
+                    throw std::runtime_error("Failed to watch folder: " + folderPath);
+                }
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            Shard live(options);
+            loadCheckpoint(live);
+            size_t resumedLines = live.lines;
+            auto lastCheckpoint = std::chrono::steady_clock::now();
 
-            parseJSON(reader, iss, jsonData);
+            TailBatch batch;
+            for (const auto& entry : listDataFiles(folderPath)) {
+                readAppended(entry.path().string(), live, batch);
+                checkpointIfDue(live, lastCheckpoint);
+            }
 
-            char type = jsonData["type"].asString()[0];
-            int quantity = 0;
-            double price = 0.0;
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "Processed " << live.lines - resumedLines << " lines in " << seconds << " s with 1 thread(s)" << std::endl;
 
-            if (type == 'A') {
-                quantity = std::stoi(jsonData["quantity"].asString());
-                price = std::stod(jsonData["price"].asString());
-            } else if (type == 'E') {
-                quantity = std::stoi(jsonData["executed_quantity"].asString());
-                price = std::stod(jsonData["execution_price"].asString());
+            if (follow) {
+                for (SymbolId id = 0; id < live.ohlcMap.size(); ++id) {
+                    batch.changes.markDirty(id);
+                }
+                std::vector<SymbolId> ids = batch.changes.flush();
+                batch.writeTime = 0;
+                sendCandles(live.ohlcMap, ids, batch.changes.sequences());
+                followFolder(folderPath, inotifyFd, live, batch, lastCheckpoint);
+                ::close(inotifyFd);
             }
 
-            std::string stockCode = jsonData["stock_code"].asString();
+            if (!options.checkpointPath.empty()) {
+                saveCheckpoint(live);
+            }
+            live.buckets.flush([&live](const SealedCandle& candle) {
+                live.candles.push_back(candle);
+            });
+            mergeShard(live);
+            printCandleSummary(live.buckets.lateTicks());
+            printErrorSummary(live.errors);
+        }, follow ? "Error tailing folder." : "Error processing folder.");
+    }
 
-            if (auto it = ohlcMap.find(stockCode); it == ohlcMap.end()) {
-                ohlcMap[stockCode] = createOHLC(price, quantity);
+    // Changed symbols are sent once the flush policy says so, each as one
+    // delta however many ticks it took, together with the interval candles
+    // sealed since the last flush; the policy is checked after every batch
+    // of inotify events and at least every 100 ms.
+    void followFolder(const std::string& folderPath, int inotifyFd, Shard& live, TailBatch& batch,
+                      std::chrono::steady_clock::time_point& lastCheckpoint) {
+        LatencyStats latency;
+        auto lastReport = std::chrono::steady_clock::now();
+        auto lastFlush = std::chrono::steady_clock::now();
+        size_t flushedTicks = 0;
+        size_t flushedCandles = 0;
+        size_t flushedSealed = 0;
+        alignas(struct inotify_event) char events[64 * 1024];
+        pollfd pollFd{inotifyFd, POLLIN, 0};
+        const int pollTimeout = options.flush.maxDelay.count() != 0
+            ? static_cast<int>(std::min<int64_t>(options.flush.maxDelay.count(), 100)) : 100;
+
+        while (!stopRequested) {
+            if (::poll(&pollFd, 1, pollTimeout) > 0) {
+                ssize_t length;
+                while ((length = ::read(inotifyFd, events, sizeof(events))) > 0) {
+                    for (char* cursor = events; cursor < events + length;) {
+                        auto* event = reinterpret_cast<struct inotify_event*>(cursor);
+                        if (event->len > 0 && !(event->mask & IN_ISDIR)) {
+                            readAppended((fs::path(folderPath) / event->name).string(), live, batch);
+                        }
+                        cursor += sizeof(struct inotify_event) + event->len;
+                    }
+                }
+            }
+
+            if (!batch.changes.empty() &&
+                options.flush.due(batch.changes.ticks(), std::chrono::steady_clock::now() - lastFlush)) {
+                flushedTicks += batch.changes.ticks();
+                std::vector<SymbolId> ids = batch.changes.flush();
+                flushedCandles += ids.size();
+                sendCandles(live.ohlcMap, ids, batch.changes.sequences());
+                flushedSealed += sendLiveSealedCandles(live);
+                auto ackTime = std::chrono::system_clock::now().time_since_epoch();
+                latency.record(std::chrono::duration<double, std::micro>(
+                    ackTime - std::chrono::nanoseconds(batch.writeTime)).count());
+                batch.writeTime = 0;
+                lastFlush = std::chrono::steady_clock::now();
+                checkpointIfDue(live, lastCheckpoint);
+            }
+
+            if (std::chrono::steady_clock::now() - lastReport >= std::chrono::seconds(10)) {
+                printFlushSummary(flushedTicks, flushedCandles, flushedSealed);
+                latency.print("Write to ack latency");
+                lastReport = std::chrono::steady_clock::now();
+            }
+        }
+        printFlushSummary(flushedTicks, flushedCandles, flushedSealed);
+        latency.print("Write to ack latency");
+    }
+
+    void printFlushSummary(size_t& ticks, size_t& candles, size_t& sealed) {
+        if (ticks > 0) {
+            std::cout << "Sent " << candles << " candle deltas for " << ticks << " ticks" << std::endl;
+        }
+        if (sealed > 0) {
+            std::cout << "Streamed " << sealed << " interval candles" << std::endl;
+        }
+        ticks = 0;
+        candles = 0;
+        sealed = 0;
+    }
+
+    // Streams the interval candles live has sealed since the last call and
+    // lets go of them, so a live session's history reaches the server as
+    // its buckets close instead of piling up until the producer stops. If
+    // the stream fails they are kept and go out with the next flush.
+    size_t sendLiveSealedCandles(Shard& live) {
+        if (live.candles.empty()) {
+            return 0;
+        }
+        ohlc::SendOHLCResponse response;
+        grpc::Status status = sendSealedCandlesStream(consumerStub(), live.ohlcMap, live.candles, options.sendBatch, response);
+        if (!status.ok()) {
+            std::cerr << "Failed to send interval candles. Error: " << status.error_message() << std::endl;
+            return 0;
+        }
+        size_t sent = live.candles.size();
+        live.candles.clear();
+        return sent;
+    }
+
+    void saveCheckpoint(const Shard& live) {
+        saveProducerCheckpoint(options.checkpointPath, live.lines, live.errors, tailedFiles, live.ohlcMap, live.buckets, live.candles);
+    }
+
+    // A missing checkpoint starts from the beginning; an unreadable one, or
+    // one taken with other intervals, is reported and ignored.
+    void loadCheckpoint(Shard& live) {
+        if (options.checkpointPath.empty() || !fs::exists(options.checkpointPath)) {
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        Shard restored(options);
+        std::map<std::string, FilePosition> files;
+        size_t checkpointBytes = 0;
+        try {
+            uint64_t lines = 0;
+            checkpointBytes = loadProducerCheckpoint(options.checkpointPath, lines, restored.errors, files, restored.ohlcMap,
+                                                     restored.buckets, restored.candles);
+            restored.lines = lines;
+        } catch (const std::exception& e) {
+            std::cerr << "Ignoring checkpoint " << options.checkpointPath << ": " << e.what() << std::endl;
+            return;
+        }
+
+        live = std::move(restored);
+        tailedFiles = std::move(files);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Resumed from checkpoint at " << live.lines << " lines, " << tailedFiles.size() << " files ("
+                  << checkpointBytes << " bytes) in " << seconds << " s" << std::endl;
+    }
+
+    void checkpointIfDue(const Shard& live, std::chrono::steady_clock::time_point& lastCheckpoint) {
+        if (options.checkpointPath.empty() || options.checkpointSeconds == 0 ||
+            std::chrono::steady_clock::now() - lastCheckpoint < std::chrono::seconds(options.checkpointSeconds)) {
+            return;
+        }
+        saveCheckpoint(live);
+        lastCheckpoint = std::chrono::steady_clock::now();
+    }
+
+    // Processes the complete lines appended to filePath since the last call.
+    // A trailing line without '\n' is taken once it ends with '}', since the
+    // flat records have no other closing brace; otherwise it waits for the
+    // rest of the write.
+    void readAppended(const std::string& filePath, Shard& live, TailBatch& batch) {
+        ExceptionHandler<CustomException>::HandleLazily([&]() {
+            int fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                return;
+            }
+
+            struct stat st;
+            if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+                ::close(fd);
+                return;
+            }
+
+            auto [it, inserted] = tailedFiles.try_emplace(filePath);
+            FilePosition& file = it->second;
+            if (inserted) {
+                file.timestamp = fileTimestamp(filePath);
+            }
+            size_t size = static_cast<size_t>(st.st_size);
+            if (size < file.offset) {
+                file.offset = 0;
+            }
+
+            tailBuffer.resize(size - file.offset);
+            size_t bytesRead = 0;
+            while (bytesRead < tailBuffer.size()) {
+                ssize_t n = ::pread(fd, tailBuffer.data() + bytesRead, tailBuffer.size() - bytesRead, file.offset + bytesRead);
+                if (n <= 0) {
+                    break;
+                }
+                bytesRead += static_cast<size_t>(n);
+            }
+            ::close(fd);
+
+            std::string_view appended(tailBuffer.data(), bytesRead);
+            size_t lastNewline = appended.rfind('\n');
+            size_t consumed = lastNewline == std::string_view::npos ? 0 : lastNewline + 1;
+            if (!appended.empty() && appended.back() == '}') {
+                consumed = appended.size();
+            }
+            if (consumed == 0) {
+                return;
+            }
+
+            auto sink = [&live](const SealedCandle& candle) {
+                live.candles.push_back(candle);
+            };
+            if (live.buckets.enabled()) {
+                live.buckets.advanceTo(file.timestamp, sink);
+            }
+
+            uint64_t writeTime = static_cast<uint64_t>(st.st_mtim.tv_sec) * 1000000000ULL + st.st_mtim.tv_nsec;
+            live.lines += MappedFile::forEachLine(appended.substr(0, consumed), [&](std::string_view line) {
+                uint64_t eventTime = 0;
+                SymbolId id = processJSONData(tailParser, live, file.timestamp, line, sink, &eventTime);
+                if (id != SymbolTable::npos) {
+                    batch.changes.touch(id);
+                }
+                writeTime = eventTime != 0 ? std::max(writeTime, eventTime) : writeTime;
+            });
+            batch.writeTime = std::max(batch.writeTime, writeTime);
+            file.offset += consumed;
+        }, [&]() { return "Error processing file: " + filePath; });
+    }
+
+    void processShard(const std::vector<FileRange>& ranges, Shard& shard) {
+        try {
+            TickParser parser;
+            auto sink = [&shard](const SealedCandle& candle) {
+                shard.candles.push_back(candle);
+            };
+
+            for (const FileRange& range : ranges) {
+                ExceptionHandler<CustomException>::HandleLazily([&]() {
+                    if (shard.buckets.enabled()) {
+                        shard.buckets.advanceTo(range.timestamp, sink);
+                    }
+                    shard.lines += readRange(range, [&](std::string_view line) {
+                        processJSONData(parser, shard, range.timestamp, line, sink);
+                    });
+                }, [&]() { return "Error processing file: " + range.filePath; });
+            }
+            shard.buckets.flush(sink);
+        } catch (...) {
+            shard.error = std::current_exception();
+        }
+    }
+
+    void mergeShard(const Shard& shard) {
+        std::vector<SymbolId> globalIds(shard.ohlcMap.size());
+        for (SymbolId id = 0; id < shard.ohlcMap.size(); ++id) {
+            globalIds[id] = ohlcMap.intern(shard.ohlcMap.name(id));
+            ohlcMap[globalIds[id]].merge(shard.ohlcMap[id]);
+        }
+        for (SealedCandle candle : shard.candles) {
+            candle.symbol = globalIds[candle.symbol];
+            candles.push_back(candle);
+        }
+    }
+
+    // Each shard seals whatever it still has open when its run ends, so a
+    // bucket that spans two runs arrives as two partial candles. Stable
+    // sorting keeps them in shard order, and merging them puts the earlier
+    // run's open first.
+    void mergeBoundaryCandles() {
+        std::stable_sort(candles.begin(), candles.end(), [](const SealedCandle& a, const SealedCandle& b) {
+            if (a.symbol != b.symbol) return a.symbol < b.symbol;
+            if (a.interval != b.interval) return a.interval < b.interval;
+            return a.start < b.start;
+        });
+
+        size_t kept = 0;
+        for (size_t i = 0; i < candles.size(); ++i) {
+            if (kept > 0 && candles[kept - 1].symbol == candles[i].symbol &&
+                candles[kept - 1].interval == candles[i].interval && candles[kept - 1].start == candles[i].start) {
+                candles[kept - 1].ohlc.merge(candles[i].ohlc);
             } else {
-                updateOHLC(it->second, price, quantity);
+                candles[kept++] = candles[i];
             }
-        }, "Error processing JSON data.");
+        }
+        candles.resize(kept);
     }
 
-    void parseJSON(Json::CharReaderBuilder& reader, std::istringstream& iss, Json::Value& jsonData) {
-        Json::parseFromStream(reader, iss, &jsonData, nullptr);
+    void printCandleSummary(size_t lateTicks) {
+        for (uint64_t interval : options.intervals) {
+            size_t count = std::count_if(candles.begin(), candles.end(), [&](const SealedCandle& candle) {
+                return candle.interval == interval;
+            });
+            std::cout << "Sealed " << count << " " << formatInterval(interval) << " candles" << std::endl;
+        }
+        if (lateTicks > 0) {
+            std::cout << "Dropped " << lateTicks << " late ticks" << std::endl;
+        }
     }
 
-    MyOHLCWithException createOHLC(double price, int quantity) {
-        return {
-            .open = price,
-            .high = price,
-            .low = price,
-            .close = price,
-            .volume = quantity,
-            .value = quantity * price,
-            .historicalHighs = {price},
-            .lowestPrice = price
-        };
+    template <typename Func>
+    size_t readRange(const FileRange& range, Func func) {
+        if (readerMode == ReaderMode::Mmap) {
+            MappedFile file(range.filePath);
+            return MappedFile::forEachLine(MappedFile::linesStartingIn(file.view(), range.begin, range.end), func);
+        }
+        return readLines(range.filePath, func);
     }
 
-    void updateOHLC(MyOHLCWithException& ohlc, double price, int quantity) {
-        ohlc.open = ohlc.close;
-        ohlc.historicalHighs.push_back(price);
-        ohlc.high = *std::max_element(ohlc.historicalHighs.begin(), ohlc.historicalHighs.end());
+    template <typename Func>
+    size_t readLines(const std::string& filePath, Func func) {
+        if (readerMode == ReaderMode::Mmap) {
+            MappedFile file(filePath);
+            return file.forEachLine(func);
+        }
 
-        if (price < ohlc.lowestPrice) {
-            ohlc.low = ohlc.lowestPrice = price;
-        } else {
-            ohlc.low = ohlc.lowestPrice;
+        std::ifstream file(filePath);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open file: " + filePath);
         }
 
-        ohlc.close = price;
-        ohlc.volume += quantity;
-        ohlc.value += quantity * price;
+        size_t lines = 0;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty()) {
+                continue;
+            }
+            func(std::string_view(line));
+            ++lines;
+        }
+        return lines;
+    }
+
+    void printErrorSummary(const ParseErrorCounts& errors) {
+        if (errors.total() > 0) {
+            std::cout << "Skipped " << errors.total() << " lines: " << errors.badJson << " bad JSON, "
+                      << errors.unknownType << " unknown type, " << errors.numericOverflow << " numeric overflow"
+                      << std::endl;
+        }
+    }
+
+    void printThroughput(const std::string& label, size_t bytes, size_t lines, double seconds) {
+        double safeSeconds = seconds > 0.0 ? seconds : 1e-9;
+        std::cout << label << ": " << bytes << " bytes, " << lines << " lines, "
+                  << (bytes / (1024.0 * 1024.0)) / safeSeconds << " MB/s, "
+                  << lines / safeSeconds << " lines/s" << std::endl;
+    }
+
+    // Per-tick path: no exceptions and no allocations. A line that cannot be
+    // used is counted in shard.errors and skipped, and npos is returned. A
+    // records add their order price and quantity, E and P records their
+    // execution price and executed quantity.
+    template <typename Sink>
+    SymbolId processJSONData(TickParser& tickParser, Shard& shard, uint64_t fileTime, std::string_view jsonDataStr, Sink& sink,
+                             uint64_t* eventTime = nullptr) {
+        Tick tick;
+        ParseStatus status = tickParser.parse(jsonDataStr, tick);
+        if (status != ParseStatus::Ok) {
+            shard.errors.count(status);
+            return SymbolTable::npos;
+        }
+
+        SymbolId id = shard.ohlcMap.intern(tick.stockCode);
+        shard.ohlcMap[id].add(tick.price, tick.quantity);
+        if (shard.buckets.enabled()) {
+            shard.buckets.add(id, tick.eventTime != 0 ? tick.eventTime : fileTime, tick.price, tick.quantity, sink);
+        }
+        if (eventTime != nullptr) {
+            *eventTime = tick.eventTime;
+        }
+        return id;
     }
 
 public:
+    // Every candle once, as the first delta of its symbol.
     void sendOHLCDataToConsumer() {
+        DeltaSet changes;
+        for (SymbolId id = 0; id < ohlcMap.size(); ++id) {
+            changes.markDirty(id);
+        }
+        std::vector<SymbolId> ids = changes.flush();
+        sendCandles(ohlcMap, ids, changes.sequences());
+    }
+
+    // The closed interval candles, on one SendOHLCStream call whatever the
+    // send mode, so the server keeps them as history.
+    void sendSealedCandles() {
+        if (candles.empty()) {
+            return;
+        }
         ExceptionHandler<CustomException>::Handle([&]() {
-            std::shared_ptr<grpc::Channel> channel = grpc::CreateChannel("localhost:50051", grpc::InsecureChannelCredentials());
-            std::unique_ptr<ohlc::OHLCConsumerService::Stub> stub = ohlc::OHLCConsumerService::NewStub(channel);
+            ohlc::SendOHLCResponse response;
+            grpc::Status status = sendSealedCandlesStream(consumerStub(), ohlcMap, candles, options.sendBatch, response);
+            if (!status.ok()) {
+                std::cerr << "Failed to send interval candles. Error: " << status.error_message() << std::endl;
+                return;
+            }
+            std::cout << "Streamed " << candles.size() << " interval candles: " << response.message() << std::endl;
+        }, "Error sending interval candles to consumer.");
+    }
 
-            for (const auto& [stockCode, ohlc] : ohlcMap) {
-                ohlc::OHLC request;
-                fillOHLCProtobuf(ohlc, stockCode, request);
+private:
+    // The channel is created once and reused, so tail mode batches do not
+    // pay for a new connection.
+    ohlc::OHLCConsumerService::Stub& consumerStub() {
+        if (!stub) {
+            std::shared_ptr<grpc::Channel> channel = grpc::CreateChannel("localhost:50051", grpc::InsecureChannelCredentials());
+            stub = ohlc::OHLCConsumerService::NewStub(channel);
+        }
+        return *stub;
+    }
 
-                grpc::ClientContext context;
-                ohlc::SendOHLCResponse response;
-                grpc::Status status = stub->SendOHLC(&context, request, &response);
+    ShmRing& shmRing() {
+        if (!ring) {
+            ring = ShmRing::attach(options.shmName);
+        }
+        return *ring;
+    }
 
+    // Streams the candles on one SendOHLCStream call by default. A server
+    // without the streaming RPC answers UNIMPLEMENTED, and the producer then
+    // falls back to one SendOHLC per candle for the rest of the run. Async
+    // mode keeps up to --send-window SendOHLC calls in flight and retries
+    // transient failures. With --schema=v2 the stream carries fixed-point
+    // OHLCColumns batches instead, and falls back to version 1 when the
+    // server does not know them. Shm mode skips gRPC and writes the candles
+    // into the shared memory ring of a server on the same host. Every candle
+    // carries its symbol's sequence number from sequences.
+    void sendCandles(const OHLCMap& candleMap, const std::vector<SymbolId>& ids, const std::vector<uint64_t>& sequences) {
+        if (ids.empty()) {
+            return;
+        }
+        ExceptionHandler<CustomException>::Handle([&]() {
+            auto onAck = [this](const std::string& stockCode, const grpc::Status& status) {
                 handleGRPCStatus(status, stockCode);
+            };
+
+            if (sendMode == SendMode::Shm) {
+                sendCandlesShm(shmRing(), candleMap, ids, sequences, options.retry.deadline, onAck);
+                return;
             }
+            if (sendMode == SendMode::Async) {
+                sendCandlesAsync(consumerStub(), candleMap, ids, sequences, options.sendWindow, options.retry, onAck);
+                return;
+            }
+            if (sendMode == SendMode::Stream && schema == WireSchema::V2) {
+                ohlc::SendOHLCResponse response;
+                grpc::Status status = sendCandlesColumns(consumerStub(), candleMap, ids, sequences, options.sendBatch, options.priceScale, response);
+                if (status.error_code() != grpc::StatusCode::UNIMPLEMENTED) {
+                    for (SymbolId id : ids) {
+                        onAck(candleMap.name(id), status);
+                    }
+                    if (status.ok()) {
+                        std::cout << "Streamed " << ids.size() << " candles as columns: " << response.message() << std::endl;
+                    }
+                    return;
+                }
+                std::cerr << "Server has no SendOHLCColumns, sending schema version 1." << std::endl;
+                schema = WireSchema::V1;
+            }
+            if (sendMode == SendMode::Stream) {
+                ohlc::SendOHLCResponse response;
+                grpc::Status status = sendCandlesStream(consumerStub(), candleMap, ids, sequences, options.sendBatch, response);
+                if (status.error_code() != grpc::StatusCode::UNIMPLEMENTED) {
+                    for (SymbolId id : ids) {
+                        onAck(candleMap.name(id), status);
+                    }
+                    if (status.ok()) {
+                        std::cout << "Streamed " << ids.size() << " candles: " << response.message() << std::endl;
+                    }
+                    return;
+                }
+                std::cerr << "Server has no SendOHLCStream, sending one candle per call." << std::endl;
+                sendMode = SendMode::Unary;
+            }
+            sendCandlesUnary(consumerStub(), candleMap, ids, sequences, onAck);
         }, "Error sending OHLC data to consumer.");
     }
 
-private:
-    void fillOHLCProtobuf(const MyOHLCWithException& ohlc, const std::string& stockCode, ohlc::OHLC& request) {
-        request.set_stock_code(stockCode);
-        request.set_open(ohlc.open);
-        request.set_high(ohlc.high);
-        request.set_low(ohlc.low);
-        request.set_close(ohlc.close);
-        request.set_volume(ohlc.volume);
-        request.set_value(ohlc.value);
-    }
-
     void handleGRPCStatus(const grpc::Status& status, const std::string& stockCode) {
         if (status.ok()) {
             std::cout << "OHLC data sent successfully for stock: " << stockCode << std::endl;
@@ -185,14 +848,117 @@ private:
     }
 
 private:
-    std::map<std::string, MyOHLCWithException> ohlcMap;
+    ProducerOptions options;
+    ReaderMode readerMode;
+    unsigned threads;
+    SendMode sendMode;
+    WireSchema schema;
+    OHLCMap ohlcMap;
+    std::vector<SealedCandle> candles;
+    std::unique_ptr<ohlc::OHLCConsumerService::Stub> stub;
+    std::unique_ptr<ShmRing> ring;
+    std::map<std::string, FilePosition> tailedFiles;
+    TickParser tailParser;
+    std::vector<char> tailBuffer;
 };
 
-int main() {
+ProducerOptions parseArguments(int argc, char** argv) {
+    const std::string usage = "Usage: " + std::string(argv[0]) + " [--reader=mmap|getline] [--threads=N] [--intervals=1s,1m,5m,1h] [--open-buckets=N] [--throughput] [--tail] [--checkpoint=FILE] [--checkpoint-interval=SECONDS] [--send=stream|unary|async|shm] [--shm=NAME] [--send-batch=N] [--schema=v1|v2] [--price-scale=N] [--send-window=N] [--send-retries=N] [--flush-ticks=N] [--flush-interval=MS] [data_folder]";
+    ProducerOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--reader=mmap") {
+            options.readerMode = ReaderMode::Mmap;
+        } else if (arg == "--reader=getline") {
+            options.readerMode = ReaderMode::Getline;
+        } else if (arg.rfind("--threads=", 0) == 0) {
+            options.threads = static_cast<unsigned>(std::stoul(std::string(arg.substr(10))));
+            if (options.threads == 0) {
+                throw std::invalid_argument(usage);
+            }
+        } else if (arg.rfind("--intervals=", 0) == 0) {
+            options.intervals = parseIntervals(arg.substr(12));
+        } else if (arg.rfind("--open-buckets=", 0) == 0) {
+            options.openBuckets = std::stoul(std::string(arg.substr(15)));
+            if (options.openBuckets == 0) {
+                throw std::invalid_argument(usage);
+            }
+        } else if (arg == "--throughput") {
+            options.throughput = true;
+        } else if (arg == "--tail") {
+            options.tail = true;
+        } else if (arg.rfind("--checkpoint=", 0) == 0) {
+            options.checkpointPath = std::string(arg.substr(13));
+        } else if (arg.rfind("--checkpoint-interval=", 0) == 0) {
+            options.checkpointSeconds = static_cast<unsigned>(std::stoul(std::string(arg.substr(22))));
+        } else if (arg == "--send=stream") {
+            options.sendMode = SendMode::Stream;
+        } else if (arg == "--send=unary") {
+            options.sendMode = SendMode::Unary;
+        } else if (arg == "--schema=v1") {
+            options.schema = WireSchema::V1;
+        } else if (arg == "--schema=v2") {
+            options.schema = WireSchema::V2;
+        } else if (arg.rfind("--price-scale=", 0) == 0) {
+            options.priceScale = static_cast<uint32_t>(std::stoul(std::string(arg.substr(14))));
+            if (options.priceScale > maxPriceScale) {
+                throw std::invalid_argument(usage);
+            }
+        } else if (arg == "--send=shm") {
+            options.sendMode = SendMode::Shm;
+        } else if (arg.rfind("--shm=", 0) == 0) {
+            options.shmName = std::string(arg.substr(6));
+        } else if (arg == "--send=async") {
+            options.sendMode = SendMode::Async;
+        } else if (arg.rfind("--send-window=", 0) == 0) {
+            options.sendWindow = std::stoul(std::string(arg.substr(14)));
+            if (options.sendWindow == 0) {
+                throw std::invalid_argument(usage);
+            }
+        } else if (arg.rfind("--send-retries=", 0) == 0) {
+            options.retry.attempts = 1 + static_cast<unsigned>(std::stoul(std::string(arg.substr(15))));
+        } else if (arg.rfind("--flush-ticks=", 0) == 0) {
+            options.flush.maxTicks = std::stoul(std::string(arg.substr(14)));
+        } else if (arg.rfind("--flush-interval=", 0) == 0) {
+            options.flush.maxDelay = std::chrono::milliseconds(std::stoul(std::string(arg.substr(17))));
+        } else if (arg.rfind("--send-batch=", 0) == 0) {
+            options.sendBatch = std::stoul(std::string(arg.substr(13)));
+            if (options.sendBatch == 0) {
+                throw std::invalid_argument(usage);
+            }
+        } else if (arg.rfind("--", 0) == 0) {
+            throw std::invalid_argument(usage);
+        } else {
+            options.folderPath = std::string(arg);
+        }
+    }
+    if (options.schema == WireSchema::V2 && options.sendMode != SendMode::Stream) {
+        throw std::invalid_argument(usage);
+    }
+    return options;
+}
+
+int main(int argc, char** argv) {
     ExceptionHandler<CustomException>::Handle([&]() {
-        OHLCProducer producer;
-        producer.processFilesInFolder("./data");
+        ProducerOptions options = parseArguments(argc, argv);
+        OHLCProducer producer(options);
+
+        if (options.throughput) {
+            producer.measureThroughput(options.folderPath);
+            return;
+        }
+        if (options.tail) {
+            std::signal(SIGINT, [](int) { stopRequested = 1; });
+            std::signal(SIGTERM, [](int) { stopRequested = 1; });
+            producer.tailFolder(options.folderPath);
+            producer.sendSealedCandles();
+            return;
+        }
+
+        producer.processFilesInFolder(options.folderPath);
         producer.sendOHLCDataToConsumer();
+        producer.sendSealedCandles();
     }, "An error occurred in the main application.");
 
     return 0;
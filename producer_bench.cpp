@@ -0,0 +1,1717 @@
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <chrono>
+#include <iomanip>
+#include <filesystem>
+#include <stdexcept>
+#include <algorithm>
+#include <random>
+#include <map>
+#include <fstream>
+#include <ctime>
+#include <charconv>
+#include <cmath>
+#include <atomic>
+#include <mutex>
+#include <future>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <json/json.h>
+#include "mapped_file.h"
+#include "tick_parser.h"
+#include "ohlc_accumulator.h"
+#include "ohlc_message.h"
+#include "ohlc_sender.h"
+#include "symbol_table.h"
+#include "candle_buckets.h"
+#include "checkpoint.h"
+#include "bench_report.h"
+#include "delta_set.h"
+#include "stored_candle.h"
+#include "candle_cache.h"
+#include "log_candle_store.h"
+#include "redis_candle_store.h"
+
+namespace fs = std::filesystem;
+
+BenchReport report;
+
+struct ParseResult {
+    size_t lines = 0;
+    long long quantity = 0;
+    double value = 0.0;
+    double seconds = 0.0;
+};
+
+// The per-line path processJSONData used before TickParser: a fresh builder,
+// stream and DOM per line, then stoi/stod on the string fields.
+Tick parseWithDom(const std::string& line, std::string& stockCode) {
+    Json::CharReaderBuilder reader;
+    Json::Value jsonData;
+    std::istringstream iss(line);
+    Json::parseFromStream(reader, iss, &jsonData, nullptr);
+
+    Tick tick;
+    tick.type = jsonData["type"].asString()[0];
+    if (tick.type == 'A') {
+        tick.quantity = std::stoi(jsonData["quantity"].asString());
+        tick.price = std::stod(jsonData["price"].asString());
+    } else if (tick.type == 'E') {
+        tick.quantity = std::stoi(jsonData["executed_quantity"].asString());
+        tick.price = std::stod(jsonData["execution_price"].asString());
+    }
+    stockCode = jsonData["stock_code"].asString();
+    tick.stockCode = stockCode;
+    return tick;
+}
+
+void accumulate(ParseResult& result, const Tick& tick) {
+    if (tick.type == 'A' || tick.type == 'E') {
+        result.quantity += tick.quantity;
+        result.value += tick.quantity * tick.price;
+    }
+    result.value += tick.stockCode.size();
+    ++result.lines;
+}
+
+template <typename Func>
+ParseResult bestOf(int iterations, Func run) {
+    ParseResult best;
+    for (int i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        ParseResult result = run();
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (i == 0 || result.seconds < best.seconds) {
+            best = result;
+        }
+    }
+    return best;
+}
+
+void printResult(const std::string& name, const ParseResult& result, size_t bytes) {
+    std::cout << std::left << std::setw(10) << name << std::right << std::fixed
+              << std::setprecision(1) << std::setw(10) << result.seconds * 1e9 / result.lines << " ns/line"
+              << std::setw(14) << result.lines / result.seconds << " lines/s"
+              << std::setw(10) << (bytes / (1024.0 * 1024.0)) / result.seconds << " MB/s"
+              << "  checksum " << result.quantity << "/" << std::setprecision(0) << result.value << std::endl;
+}
+
+void benchParse(const std::string& folderPath, int iterations) {
+    std::vector<MappedFile> files;
+    std::vector<std::string_view> views;
+    std::vector<std::string> strings;
+    size_t bytes = 0;
+
+    for (const auto& entry : fs::directory_iterator(folderPath)) {
+        files.emplace_back(entry.path().string());
+        bytes += files.back().size();
+        files.back().forEachLine([&](std::string_view line) {
+            views.push_back(line);
+            strings.emplace_back(line);
+        });
+    }
+    std::cout << "parse: " << files.size() << " files, " << views.size() << " lines, " << bytes << " bytes" << std::endl;
+
+    ParseResult dom = bestOf(iterations, [&]() {
+        ParseResult result;
+        std::string stockCode;
+        for (const std::string& line : strings) {
+            accumulate(result, parseWithDom(line, stockCode));
+        }
+        return result;
+    });
+
+    TickParser parser;
+    ParseResult tickParser = bestOf(iterations, [&]() {
+        ParseResult result;
+        Tick tick;
+        for (std::string_view line : views) {
+            parser.parse(line, tick);
+            accumulate(result, tick);
+        }
+        return result;
+    });
+
+    printResult("jsoncpp", dom, bytes);
+    printResult("tick", tickParser, bytes);
+    report.record("parse", "jsoncpp", dom.lines, bytes, dom.seconds);
+    report.record("parse", "tick", tickParser.lines, bytes, tickParser.seconds);
+    std::cout << "jsoncpp fallbacks: " << parser.fallbackCount() << ", speedup: " << std::setprecision(1)
+              << dom.seconds / tickParser.seconds << "x" << std::endl;
+
+    if (dom.quantity != tickParser.quantity || dom.value != tickParser.value) {
+        throw std::runtime_error("Tick parser results differ from the jsoncpp path.");
+    }
+}
+
+// The candle updateOHLC kept before OHLCAccumulator: every price is stored
+// and the high is rescanned on each tick.
+struct VectorScanOHLC {
+    double open;
+    double high;
+    double low;
+    double close;
+    int volume;
+    double value;
+    std::vector<double> historicalHighs;
+    double lowestPrice;
+
+    void add(double price, int quantity) {
+        if (historicalHighs.empty()) {
+            open = high = low = close = lowestPrice = price;
+            volume = 0;
+            value = 0.0;
+        }
+        historicalHighs.push_back(price);
+        high = *std::max_element(historicalHighs.begin(), historicalHighs.end());
+        low = lowestPrice = std::min(lowestPrice, price);
+        close = price;
+        volume += quantity;
+        value += quantity * price;
+    }
+};
+
+template <typename Candle>
+double nsPerTick(size_t ticks, const std::vector<double>& prices, const std::vector<int>& quantities) {
+    auto start = std::chrono::steady_clock::now();
+    Candle candle{};
+    for (size_t i = 0; i < ticks; ++i) {
+        candle.add(prices[i % prices.size()], quantities[i % quantities.size()]);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (candle.volume == 0) {
+        throw std::runtime_error("Aggregation benchmark produced an empty candle.");
+    }
+    return seconds * 1e9 / ticks;
+}
+
+// Per-tick cost of one symbol's candle as its tick count grows. The vector
+// scan is quadratic, so it is only run up to a BBRI-sized day.
+void benchAggregate() {
+    const size_t maxVectorScanTicks = 50000;
+    std::mt19937 rng(42);
+    std::vector<double> prices(1 << 16);
+    std::vector<int> quantities(1 << 16);
+    double price = 4500.0;
+    for (size_t i = 0; i < prices.size(); ++i) {
+        price = std::max(50.0, price + static_cast<int>(rng() % 5) * 10.0 - 20.0);
+        prices[i] = price;
+        quantities[i] = 1 + static_cast<int>(rng() % 100);
+    }
+
+    std::cout << "aggregate:" << std::endl;
+    for (size_t ticks : {1000, 10000, 50000, 1000000, 10000000}) {
+        double accumulatorNs = nsPerTick<OHLCAccumulator>(ticks, prices, quantities);
+        report.record("aggregate", "accumulator/" + std::to_string(ticks), ticks, 0, accumulatorNs * ticks / 1e9);
+        std::cout << std::setw(10) << ticks << " ticks" << std::fixed << std::setprecision(2)
+                  << std::setw(10) << accumulatorNs << " ns/tick accumulator";
+        if (ticks <= maxVectorScanTicks) {
+            double vectorScanNs = nsPerTick<VectorScanOHLC>(ticks, prices, quantities);
+            report.record("aggregate", "vector_scan/" + std::to_string(ticks), ticks, 0, vectorScanNs * ticks / 1e9);
+            std::cout << std::setw(12) << vectorScanNs << " ns/tick vector scan";
+        }
+        std::cout << std::endl;
+    }
+}
+
+using StringOHLCMap = std::map<std::string, OHLCAccumulator, std::less<>>;
+
+// The lookup processJSONData did before symbols were interned.
+OHLCAccumulator& candleFor(StringOHLCMap& candles, std::string_view stockCode) {
+    auto it = candles.find(stockCode);
+    if (it == candles.end()) {
+        it = candles.emplace(stockCode, OHLCAccumulator{}).first;
+    }
+    return it->second;
+}
+
+OHLCAccumulator& candleFor(SymbolMap<OHLCAccumulator>& candles, std::string_view stockCode) {
+    return candles[stockCode];
+}
+
+template <typename Map>
+double nsPerSymbolTick(const std::vector<std::string_view>& stream, const std::vector<double>& prices) {
+    Map candles;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < stream.size(); ++i) {
+        candleFor(candles, stream[i]).add(prices[i & (prices.size() - 1)], 1);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (candles.size() == 0) {
+        throw std::runtime_error("Symbol benchmark produced no candles.");
+    }
+    return seconds * 1e9 / stream.size();
+}
+
+// ns per tick for looking up a symbol's candle and updating it, from the 8
+// symbols in data/ to well past the ~900 listed names. Symbols come in short
+// runs like in the feed, with the run's symbol drawn at random.
+void benchSymbols() {
+    const size_t tickCount = 4000000;
+    std::mt19937 rng(7);
+    std::vector<double> prices(1 << 16);
+    for (double& price : prices) {
+        price = 1000.0 + rng() % 9000;
+    }
+
+    std::cout << "symbols:" << std::endl;
+    for (size_t symbolCount : {8, 100, 900, 5000, 50000}) {
+        std::vector<std::string> names;
+        for (size_t i = 0; i < symbolCount; ++i) {
+            std::string name;
+            for (size_t n = i + 26 * 26 * 26; n > 0; n /= 26) {
+                name.push_back(static_cast<char>('A' + n % 26));
+            }
+            names.push_back(name);
+        }
+
+        // Copies per tick, so lookups compare against different memory like
+        // string_views into a file would.
+        std::vector<std::string> lines;
+        lines.reserve(tickCount);
+        while (lines.size() < tickCount) {
+            const std::string& name = names[rng() % symbolCount];
+            for (size_t run = 1 + rng() % 8; run > 0 && lines.size() < tickCount; --run) {
+                lines.push_back(name);
+            }
+        }
+        std::vector<std::string_view> stream(lines.begin(), lines.end());
+
+        double mapNs = nsPerSymbolTick<StringOHLCMap>(stream, prices);
+        double symbolMapNs = nsPerSymbolTick<SymbolMap<OHLCAccumulator>>(stream, prices);
+        report.record("symbols", "std_map/" + std::to_string(symbolCount), tickCount, 0, mapNs * tickCount / 1e9);
+        report.record("symbols", "symbol_map/" + std::to_string(symbolCount), tickCount, 0, symbolMapNs * tickCount / 1e9);
+        std::cout << std::setw(10) << symbolCount << " symbols" << std::fixed << std::setprecision(2)
+                  << std::setw(10) << mapNs << " ns/tick std::map"
+                  << std::setw(10) << symbolMapNs << " ns/tick SymbolMap" << std::endl;
+    }
+}
+
+// One core bucketing a synthetic trading day (6.5 hours, 900 symbols,
+// 20M ticks in time order) into 1s/1m/5m/1h candles.
+void benchBuckets() {
+    const size_t symbolCount = 900;
+    const size_t tickCount = 20000000;
+    const uint64_t dayStart = 1668045600000000000ULL;
+    const uint64_t dayLength = 6ULL * 3600 * 1000000000ULL + 30ULL * 60 * 1000000000ULL;
+
+    std::mt19937 rng(11);
+    std::vector<SymbolId> symbols(1 << 16);
+    std::vector<double> prices(1 << 16);
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        symbols[i] = static_cast<SymbolId>(rng() % symbolCount);
+        prices[i] = 1000.0 + rng() % 9000;
+    }
+
+    CandleBuckets buckets(parseIntervals("1s,1m,5m,1h"));
+    size_t sealed = 0;
+    auto sink = [&sealed](const SealedCandle&) {
+        ++sealed;
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < tickCount; ++i) {
+        uint64_t eventTime = dayStart + dayLength / tickCount * i;
+        size_t sample = i & (symbols.size() - 1);
+        buckets.add(symbols[sample], eventTime, prices[sample], 1, sink);
+    }
+    buckets.flush(sink);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    report.record("buckets", "1s,1m,5m,1h", tickCount, 0, seconds);
+
+    std::cout << "buckets: " << tickCount << " ticks, " << symbolCount << " symbols, 4 intervals" << std::fixed
+              << std::setprecision(2) << std::setw(10) << seconds * 1e9 / tickCount << " ns/tick"
+              << std::setprecision(0) << std::setw(14) << tickCount / seconds << " ticks/s"
+              << std::setw(10) << sealed << " candles sealed, " << buckets.lateTicks() << " late" << std::endl;
+}
+
+struct CorpusOptions {
+    uint64_t bytes = 64ULL << 20;
+    size_t symbols = 8;
+    size_t fileBytes = 4 << 20;
+    uint32_t seed = 7;
+};
+
+struct CorpusFile {
+    std::string filePath;
+    uint64_t timestamp;
+};
+
+void appendNumber(std::string& out, uint64_t value) {
+    char digits[20];
+    auto [ptr, ec] = std::to_chars(digits, digits + sizeof(digits), value);
+    out.append(digits, ptr);
+}
+
+// The order number format of the feed: the trading date and a 10 digit
+// sequence.
+void appendOrderNumber(std::string& out, uint64_t sequence) {
+    char digits[10];
+    for (int i = 9; i >= 0; --i, sequence /= 10) {
+        digits[i] = static_cast<char>('0' + sequence % 10);
+    }
+    out.append("20221110").append(digits, sizeof(digits));
+}
+
+// Writes a synthetic feed shaped like data/: A, E and P records with the
+// same keys in the same order, mixed 65/33/2 like the real files. Symbols
+// are drawn with Zipf weights (rank^-1), which for data/'s 8 symbols gives
+// the busiest one the third of the lines BBRI has, and they come in short
+// runs. The first 8 symbols are data/'s codes in that rank order. Each
+// symbol walks its own price in whole ticks; E records execute a recent A
+// of the same symbol at its price. Files of about fileBytes are named with
+// a nanosecond timestamp, 0.4 s apart.
+std::vector<CorpusFile> generateCorpus(const fs::path& folder, const CorpusOptions& options) {
+    const char* rankedCodes[] = {"BBRI", "BBCA", "TLKM", "ASII", "UNVR", "HMSP", "ICBP", "GGRM"};
+    const char* quantities[] = {"1", "1", "1", "2", "3", "5", "5", "10", "10", "20", "50", "100"};
+    const uint64_t dayStart = 1668045540000000000ULL;
+
+    struct SymbolState {
+        std::string code;
+        std::string orderBook;
+        uint64_t price;
+        uint64_t tick;
+        uint64_t lastOrder;
+    };
+
+    std::mt19937_64 rng(options.seed);
+    std::vector<SymbolState> symbols;
+    std::vector<double> cumulativeWeights;
+    double totalWeight = 0.0;
+    for (size_t i = 0; i < std::max<size_t>(options.symbols, 1); ++i) {
+        SymbolState symbol;
+        if (i < std::size(rankedCodes)) {
+            symbol.code = rankedCodes[i];
+        } else {
+            for (size_t n = i + 26 * 26 * 26; n > 0; n /= 26) {
+                symbol.code.push_back(static_cast<char>('A' + n % 26));
+            }
+        }
+        symbol.orderBook = std::to_string(10 + i);
+        symbol.tick = 5 * (1 + rng() % 5);
+        symbol.price = symbol.tick * (20 + rng() % 2000);
+        symbol.lastOrder = 0;
+        symbols.push_back(symbol);
+
+        totalWeight += 1.0 / static_cast<double>(i + 1);
+        cumulativeWeights.push_back(totalWeight);
+    }
+
+    std::uniform_real_distribution<double> pick(0.0, totalWeight);
+    std::vector<CorpusFile> files;
+    std::string buffer;
+    uint64_t orderSequence = 1;
+    uint64_t written = 0;
+
+    fs::create_directories(folder);
+    while (written < options.bytes) {
+        uint64_t timestamp = dayStart + files.size() * 400000000ULL + rng() % 1000000;
+        files.push_back({(folder / ("2022-11-10-" + std::to_string(timestamp) + ".ndjson")).string(), timestamp});
+        buffer.clear();
+
+        while (buffer.size() < options.fileBytes && written + buffer.size() < options.bytes) {
+            size_t index = std::lower_bound(cumulativeWeights.begin(), cumulativeWeights.end(), pick(rng)) -
+                           cumulativeWeights.begin();
+            SymbolState& symbol = symbols[std::min(index, symbols.size() - 1)];
+
+            for (size_t run = 1 + rng() % 8; run > 0; --run) {
+                unsigned shape = rng() % 1000;
+                if (shape < 6 && symbol.price > 10 * symbol.tick) {
+                    symbol.price -= symbol.tick;
+                } else if (shape < 12) {
+                    symbol.price += symbol.tick;
+                }
+                const char* quantity = rng() % 10 == 0 ? nullptr : quantities[rng() % std::size(quantities)];
+                const std::string largeQuantity = quantity == nullptr ? std::to_string(1 + rng() % 700) : "";
+                std::string_view quantityText = quantity != nullptr ? std::string_view(quantity) : largeQuantity;
+                const char* verb = rng() % 2 == 0 ? "B" : "S";
+
+                shape = rng() % 1000;
+                if (shape < 650 || symbol.lastOrder == 0) {
+                    symbol.lastOrder = orderSequence++;
+                    buffer.append("{\"type\":\"A\",\"order_number\":\"");
+                    appendOrderNumber(buffer, symbol.lastOrder);
+                    buffer.append("\",\"order_verb\":\"").append(verb);
+                    buffer.append("\",\"quantity\":\"").append(quantityText);
+                    buffer.append("\",\"order_book\":\"").append(symbol.orderBook);
+                    buffer.append("\",\"price\":\"");
+                    appendNumber(buffer, symbol.price);
+                    buffer.append("\",\"stock_code\":\"").append(symbol.code).append("\"}\n");
+                } else if (shape < 977) {
+                    buffer.append("{\"type\":\"E\",\"order_number\":\"");
+                    appendOrderNumber(buffer, symbol.lastOrder);
+                    buffer.append("\",\"executed_quantity\":\"").append(quantityText);
+                    buffer.append("\",\"execution_price\":\"");
+                    appendNumber(buffer, symbol.price);
+                    buffer.append("\",\"order_verb\":\"").append(verb);
+                    buffer.append("\",\"stock_code\":\"").append(symbol.code);
+                    buffer.append("\",\"order_book\":\"").append(symbol.orderBook).append("\"}\n");
+                } else {
+                    buffer.append("{\"type\":\"P\",\"executed_quantity\":\"").append(quantityText);
+                    buffer.append("\",\"order_book\":\"").append(symbol.orderBook);
+                    buffer.append("\",\"execution_price\":\"");
+                    appendNumber(buffer, symbol.price);
+                    buffer.append("\",\"stock_code\":\"").append(symbol.code).append("\"}\n");
+                }
+            }
+        }
+
+        std::ofstream out(files.back().filePath, std::ios::binary);
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!out) {
+            throw std::runtime_error("Failed to write corpus file: " + files.back().filePath);
+        }
+        written += buffer.size();
+    }
+    return files;
+}
+
+std::vector<std::string> listFolder(const std::string& folderPath) {
+    std::vector<std::string> filePaths;
+    for (const auto& entry : fs::directory_iterator(folderPath)) {
+        if (entry.is_regular_file()) {
+            filePaths.push_back(entry.path().string());
+        }
+    }
+    std::sort(filePaths.begin(), filePaths.end());
+    return filePaths;
+}
+
+// Reading alone, no parsing: the mmap line splitter against std::getline,
+// best of iterations over the whole folder.
+void benchRead(const std::string& folderPath, int iterations) {
+    std::vector<std::string> filePaths = listFolder(folderPath);
+    size_t bytes = 0;
+    for (const std::string& filePath : filePaths) {
+        bytes += fs::file_size(filePath);
+    }
+    std::cout << "read: " << filePaths.size() << " files, " << bytes << " bytes" << std::endl;
+
+    ParseResult mmap = bestOf(iterations, [&]() {
+        ParseResult result;
+        for (const std::string& filePath : filePaths) {
+            MappedFile file(filePath);
+            result.lines += file.forEachLine([&](std::string_view line) {
+                result.quantity += line.size();
+            });
+        }
+        return result;
+    });
+
+    ParseResult getline = bestOf(iterations, [&]() {
+        ParseResult result;
+        std::string line;
+        for (const std::string& filePath : filePaths) {
+            std::ifstream file(filePath);
+            while (std::getline(file, line)) {
+                result.quantity += line.size();
+                ++result.lines;
+            }
+        }
+        return result;
+    });
+
+    printResult("mmap", mmap, bytes);
+    printResult("getline", getline, bytes);
+    report.record("read", "mmap", mmap.lines, bytes, mmap.seconds);
+    report.record("read", "getline", getline.lines, bytes, getline.seconds);
+}
+
+// fillOHLCProtobuf for every candle the producer would send, with a fresh
+// message per symbol like sendCandles, then the same plus serialization,
+// which is the part of the send path that does not depend on the network.
+void benchFill() {
+    const size_t messageCount = 2000000;
+    std::mt19937 rng(5);
+    std::cout << "fill:" << std::endl;
+
+    for (size_t symbolCount : {8, 900, 5000}) {
+        const size_t rounds = messageCount / symbolCount;
+        SymbolMap<OHLCAccumulator> candles;
+        for (size_t i = 0; i < symbolCount; ++i) {
+            std::string name;
+            for (size_t n = i + 26 * 26 * 26; n > 0; n /= 26) {
+                name.push_back(static_cast<char>('A' + n % 26));
+            }
+            OHLCAccumulator& candle = candles[name];
+            for (int tick = 0; tick < 16; ++tick) {
+                candle.add(1000.0 + rng() % 9000, 1 + static_cast<int>(rng() % 100));
+            }
+        }
+
+        size_t checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t round = 0; round < rounds; ++round) {
+            for (SymbolId id = 0; id < candles.size(); ++id) {
+                ohlc::OHLC request;
+                fillOHLCProtobuf(candles[id], candles.name(id), request);
+                checksum += static_cast<size_t>(request.volume());
+            }
+        }
+        double fillSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::string wire;
+        size_t wireBytes = 0;
+        start = std::chrono::steady_clock::now();
+        for (size_t round = 0; round < rounds; ++round) {
+            for (SymbolId id = 0; id < candles.size(); ++id) {
+                ohlc::OHLC request;
+                fillOHLCProtobuf(candles[id], candles.name(id), request);
+                request.SerializeToString(&wire);
+                wireBytes += wire.size();
+            }
+        }
+        double serializeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (checksum == 0 || wireBytes == 0) {
+            throw std::runtime_error("Fill benchmark produced empty messages.");
+        }
+        size_t messages = rounds * symbolCount;
+        report.record("fill", "fill/" + std::to_string(symbolCount), messages, 0, fillSeconds);
+        report.record("fill", "fill_serialize/" + std::to_string(symbolCount), messages, wireBytes / rounds, serializeSeconds);
+        std::cout << std::setw(10) << symbolCount << " symbols" << std::fixed << std::setprecision(1)
+                  << std::setw(10) << fillSeconds * 1e9 / messages << " ns/message fill"
+                  << std::setw(10) << serializeSeconds * 1e9 / messages << " ns/message fill+serialize, "
+                  << wireBytes / messages << " bytes" << std::endl;
+    }
+}
+
+// Wire size and encode/decode cost per candle of each schema, for one
+// candle per symbol with whole-rupiah prices like IDX's. Encoding fills and
+// serializes, decoding parses and turns the candle into the version 1 form
+// the server stores. Version 2 is measured per message with the stock code,
+// per message with only a symbol id (a call's later candles), and as one
+// OHLCColumns batch of every symbol with and without the symbol names.
+void benchSchema() {
+    const size_t candleCount = 1000000;
+    std::mt19937 rng(7);
+    std::cout << "schema:" << std::endl;
+
+    for (size_t symbolCount : {8, 900, 5000}) {
+        const size_t rounds = std::max<size_t>(candleCount / symbolCount, 1);
+        SymbolMap<OHLCAccumulator> candles;
+        std::vector<SymbolId> ids;
+        for (size_t i = 0; i < symbolCount; ++i) {
+            std::string name;
+            for (size_t n = i + 26 * 26 * 26; n > 0; n /= 26) {
+                name.push_back(static_cast<char>('A' + n % 26));
+            }
+            ids.push_back(candles.intern(name));
+            const double basePrice = 50 + rng() % 20000;
+            for (int tick = 0; tick < 16; ++tick) {
+                candles[ids.back()].add(basePrice + rng() % 100, 100 * (1 + static_cast<int>(rng() % 5000)));
+            }
+        }
+
+        auto measure = [&](const std::string& variant, auto encode, auto decode) {
+            std::string wire;
+            size_t wireBytes = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t round = 0; round < rounds; ++round) {
+                wireBytes = encode(wire);
+            }
+            double encodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            double checksum = 0.0;
+            start = std::chrono::steady_clock::now();
+            for (size_t round = 0; round < rounds; ++round) {
+                checksum += decode(wire);
+            }
+            double decodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (wireBytes == 0 || checksum == 0.0) {
+                throw std::runtime_error("Schema benchmark produced empty messages.");
+            }
+
+            const size_t messages = rounds * symbolCount;
+            const double bytesPerCandle = static_cast<double>(wireBytes) / symbolCount;
+            Json::Value& result = report.record("schema", variant + "/" + std::to_string(symbolCount), messages, wireBytes, encodeSeconds);
+            result["bytes_per_candle"] = bytesPerCandle;
+            result["decode_ns_per_candle"] = decodeSeconds * 1e9 / messages;
+            std::cout << std::setw(10) << symbolCount << " symbols " << std::left << std::setw(16) << variant << std::right
+                      << std::fixed << std::setprecision(1) << std::setw(8) << bytesPerCandle << " bytes/candle"
+                      << std::setw(9) << encodeSeconds * 1e9 / messages << " ns encode" << std::setw(9)
+                      << decodeSeconds * 1e9 / messages << " ns decode" << std::defaultfloat << std::endl;
+        };
+
+        // Each message encoding is kept side by side so one decode pass can
+        // walk them; the returned size is the total for every symbol.
+        std::vector<std::string> messages(symbolCount);
+        auto encodeEach = [&](auto fill) {
+            return [&, fill](std::string&) {
+                size_t bytes = 0;
+                for (size_t i = 0; i < ids.size(); ++i) {
+                    fill(ids[i], messages[i]);
+                    bytes += messages[i].size();
+                }
+                return bytes;
+            };
+        };
+
+        measure("v1", encodeEach([&](SymbolId id, std::string& out) {
+            ohlc::OHLC request;
+            fillOHLCProtobuf(candles[id], candles.name(id), request);
+            request.SerializeToString(&out);
+        }), [&](const std::string&) {
+            double sum = 0.0;
+            ohlc::OHLC candle;
+            for (const std::string& message : messages) {
+                candle.ParseFromString(message);
+                sum += candle.close();
+            }
+            return sum;
+        });
+
+        auto decodeFixed = [&](const std::string&) {
+            double sum = 0.0;
+            ohlc::OHLCFixed candle;
+            ohlc::OHLC stored;
+            for (size_t i = 0; i < messages.size(); ++i) {
+                candle.ParseFromString(messages[i]);
+                readOHLCFixed(candle, candle.stock_code().empty() ? candles.name(ids[i]) : candle.stock_code(), stored);
+                sum += stored.close();
+            }
+            return sum;
+        };
+        measure("v2", encodeEach([&](SymbolId id, std::string& out) {
+            ohlc::OHLCFixed request;
+            fillOHLCFixed(candles[id], candles.name(id), 0, request);
+            request.SerializeToString(&out);
+        }), decodeFixed);
+        measure("v2_symbol_id", encodeEach([&](SymbolId id, std::string& out) {
+            ohlc::OHLCFixed request;
+            fillOHLCFixed(candles[id], std::string(), 0, request);
+            request.set_symbol_id(id);
+            request.SerializeToString(&out);
+        }), decodeFixed);
+
+        for (bool named : {true, false}) {
+            measure(named ? "v2_columns" : "v2_columns_ids", [&](std::string& wire) {
+                ohlc::OHLCColumns batch;
+                batch.set_price_scale(0);
+                for (SymbolId id : ids) {
+                    if (named) {
+                        (*batch.mutable_symbol_names())[id] = candles.name(id);
+                    }
+                    appendOHLCColumns(candles[id], id, batch);
+                }
+                batch.SerializeToString(&wire);
+                return wire.size();
+            }, [&](const std::string& wire) {
+                double sum = 0.0;
+                ohlc::OHLCColumns batch;
+                ohlc::OHLC stored;
+                batch.ParseFromString(wire);
+                for (int row = 0; row < batch.symbol_ids_size(); ++row) {
+                    readOHLCColumns(batch, row, candles.name(batch.symbol_ids(row)), stored);
+                    sum += stored.close();
+                }
+                return sum;
+            });
+        }
+    }
+}
+
+// Bytes and ns encode/decode per candle of the Redis value the server
+// stores: the old CSV text against the version 1 binary encoding. Candles
+// are IDX-like, whole rupiah with a traded value in the billions, and again
+// with two-decimal prices, which the binary encoding stores as raw doubles.
+// "lossy" counts candles that do not decode to exactly what was encoded.
+void benchStored() {
+    const size_t candleCount = 1000000;
+    const size_t symbolCount = 900;
+    std::mt19937 rng(11);
+    std::cout << "stored:" << std::endl;
+
+    for (bool whole : {true, false}) {
+        std::vector<ohlc::OHLC> candles(symbolCount);
+        for (size_t i = 0; i < symbolCount; ++i) {
+            std::string name;
+            for (size_t n = i + 26 * 26 * 26; n > 0; n /= 26) {
+                name.push_back(static_cast<char>('A' + n % 26));
+            }
+            OHLCAccumulator ohlc;
+            const double basePrice = 50 + rng() % 20000;
+            for (int tick = 0; tick < 64; ++tick) {
+                const double price = basePrice + (whole ? rng() % 100 : (rng() % 10000) / 100.0);
+                ohlc.add(price, 100 * (1 + static_cast<int>(rng() % 50000)));
+            }
+            fillOHLCProtobuf(ohlc, name, candles[i]);
+            candles[i].set_sequence(1 + rng() % 100000);
+        }
+        const size_t rounds = candleCount / symbolCount;
+        const size_t messages = rounds * symbolCount;
+        const std::string prices = whole ? "whole" : "decimal";
+
+        auto print = [&](const std::string& variant, size_t bytes, double encodeSeconds, double decodeSeconds, size_t lossy) {
+            const double bytesPerCandle = static_cast<double>(bytes) / symbolCount;
+            Json::Value& result = report.record("stored", variant + "/" + prices, messages, bytes, encodeSeconds);
+            result["bytes_per_candle"] = bytesPerCandle;
+            result["decode_ns_per_candle"] = decodeSeconds * 1e9 / messages;
+            result["lossy_candles"] = Json::UInt64(lossy);
+            std::cout << std::setw(10) << prices << " prices " << std::left << std::setw(8) << variant << std::right
+                      << std::fixed << std::setprecision(1) << std::setw(8) << bytesPerCandle << " bytes/candle"
+                      << std::setw(9) << encodeSeconds * 1e9 / messages << " ns encode" << std::setw(9)
+                      << decodeSeconds * 1e9 / messages << " ns decode" << std::setw(6) << lossy << " lossy"
+                      << std::defaultfloat << std::endl;
+        };
+        auto countLossy = [&](auto decode) {
+            size_t lossy = 0;
+            ohlc::OHLC decoded;
+            for (size_t i = 0; i < symbolCount; ++i) {
+                decode(i, decoded);
+                const ohlc::OHLC& saved = candles[i];
+                if (decoded.stock_code() != saved.stock_code() || decoded.open() != saved.open() || decoded.high() != saved.high() ||
+                    decoded.low() != saved.low() || decoded.close() != saved.close() || decoded.volume() != saved.volume() ||
+                    decoded.value() != saved.value()) {
+                    ++lossy;
+                }
+            }
+            return lossy;
+        };
+
+        std::vector<std::string> csv(symbolCount);
+        size_t csvBytes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t round = 0; round < rounds; ++round) {
+            csvBytes = 0;
+            for (size_t i = 0; i < symbolCount; ++i) {
+                csv[i] = encodeCsvCandle(candles[i]);
+                csvBytes += csv[i].size();
+            }
+        }
+        double encodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double checksum = 0.0;
+        ohlc::OHLC decoded;
+        start = std::chrono::steady_clock::now();
+        for (size_t round = 0; round < rounds; ++round) {
+            for (size_t i = 0; i < symbolCount; ++i) {
+                decodeCsvCandle(csv[i], &decoded);
+                checksum += decoded.close();
+            }
+        }
+        double decodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        print("csv", csvBytes, encodeSeconds, decodeSeconds, countLossy([&](size_t i, ohlc::OHLC& out) {
+            decodeCsvCandle(csv[i], &out);
+        }));
+
+        std::vector<StoredCandleBytes> binary(symbolCount);
+        size_t binaryBytes = 0;
+        start = std::chrono::steady_clock::now();
+        for (size_t round = 0; round < rounds; ++round) {
+            binaryBytes = 0;
+            for (size_t i = 0; i < symbolCount; ++i) {
+                encodeStoredCandle(candles[i], binary[i]);
+                binaryBytes += binary[i].size;
+            }
+        }
+        encodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        start = std::chrono::steady_clock::now();
+        for (size_t round = 0; round < rounds; ++round) {
+            for (size_t i = 0; i < symbolCount; ++i) {
+                if (!decodeStoredCandle(binary[i].data, binary[i].size, &decoded)) {
+                    throw std::runtime_error("Stored candle benchmark failed to decode its own encoding.");
+                }
+                checksum += decoded.close();
+            }
+        }
+        decodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        print("binary", binaryBytes, encodeSeconds, decodeSeconds, countLossy([&](size_t i, ohlc::OHLC& out) {
+            decodeStoredCandle(binary[i].data, binary[i].size, &out);
+        }));
+        if (checksum == 0.0) {
+            throw std::runtime_error("Stored candle benchmark decoded nothing.");
+        }
+    }
+}
+
+// ns per lookup of the server's latest-candle cache for 900 symbols, alone
+// and while a writer thread replaces candles as fast as it can, against an
+// unordered_map behind a mutex. The writer's puts per second show how much
+// the readers hold it up: with the seqlock cache they cannot.
+void benchCache() {
+    const size_t symbolCount = 900;
+    const size_t lookups = 2000000;
+    std::cout << "cache:" << std::endl;
+
+    std::vector<ohlc::OHLC> candles(symbolCount);
+    std::vector<std::string> symbols;
+    for (size_t i = 0; i < symbolCount; ++i) {
+        std::string name;
+        for (size_t n = i + 26 * 26 * 26; n > 0; n /= 26) {
+            name.push_back(static_cast<char>('A' + n % 26));
+        }
+        symbols.push_back(name);
+        candles[i].set_stock_code(name);
+        candles[i].set_open(1000 + i);
+        candles[i].set_high(1100 + i);
+        candles[i].set_low(900 + i);
+        candles[i].set_close(1050 + i);
+        candles[i].set_volume(100);
+        candles[i].set_value(105000);
+    }
+
+    CandleCache cache;
+    std::mutex mapMutex;
+    std::unordered_map<std::string, ohlc::OHLC> lockedMap;
+    for (const ohlc::OHLC& candle : candles) {
+        cache.put(candle);
+        lockedMap[candle.stock_code()] = candle;
+    }
+
+    auto measure = [&](const std::string& variant, bool withWriter, auto get, auto put) {
+        std::atomic<bool> stop{false};
+        std::atomic<size_t> puts{0};
+        std::thread writer;
+        if (withWriter) {
+            writer = std::thread([&]() {
+                size_t count = 0;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    put(candles[count % symbolCount]);
+                    ++count;
+                }
+                puts = count;
+            });
+        }
+        ohlc::OHLC candle;
+        double checksum = 0.0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < lookups; ++i) {
+            if (get(symbols[(i * 7) % symbolCount], candle)) {
+                checksum += candle.close();
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        stop = true;
+        if (writer.joinable()) {
+            writer.join();
+        }
+        if (checksum == 0.0) {
+            throw std::runtime_error("Cache benchmark found no candles.");
+        }
+        const std::string name = variant + (withWriter ? "+writer" : "");
+        Json::Value& result = report.record("cache", name + "/" + std::to_string(symbolCount), lookups, 0, seconds);
+        result["writer_puts_per_s"] = puts / seconds;
+        std::cout << "  " << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(8) << seconds * 1e9 / lookups << " ns/get";
+        if (withWriter) {
+            std::cout << std::setw(12) << std::setprecision(0) << puts / seconds << " puts/s";
+        }
+        std::cout << std::defaultfloat << std::endl;
+    };
+
+    for (bool withWriter : {false, true}) {
+        measure("seqlock", withWriter, [&](const std::string& symbol, ohlc::OHLC& candle) {
+            return cache.get(symbol, candle);
+        }, [&](const ohlc::OHLC& candle) {
+            cache.put(candle);
+        });
+        measure("mutex_map", withWriter, [&](const std::string& symbol, ohlc::OHLC& candle) {
+            std::lock_guard<std::mutex> lock(mapMutex);
+            auto it = lockedMap.find(symbol);
+            if (it == lockedMap.end()) {
+                return false;
+            }
+            candle = it->second;
+            return true;
+        }, [&](const ohlc::OHLC& candle) {
+            std::lock_guard<std::mutex> lock(mapMutex);
+            lockedMap[candle.stock_code()] = candle;
+        });
+    }
+}
+
+// Candles and v1 bytes a continuously running producer sends for a session
+// of 2M ticks, flushing every 100, 1000 or 10000 ticks: all symbols each
+// flush, as before, against only the symbols that changed. Activity is
+// Zipf-like as on IDX, where a few hundred symbols take most of the ticks
+// and the rest trade a handful of times a day. The ns/tick is the cost of
+// aggregating, tracking changes and filling and sizing the deltas.
+void benchDelta() {
+    const size_t tickCount = 2000000;
+    std::cout << "delta:" << std::endl;
+
+    for (size_t symbolCount : {900, 5000}) {
+        std::vector<double> weights(symbolCount);
+        for (size_t rank = 0; rank < symbolCount; ++rank) {
+            weights[rank] = 1.0 / std::pow(static_cast<double>(rank + 1), 1.2);
+        }
+        std::mt19937 rng(13);
+        std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+        std::vector<size_t> ticks(tickCount);
+        for (size_t& symbol : ticks) {
+            symbol = pick(rng);
+        }
+
+        for (size_t flushTicks : {100, 1000, 10000}) {
+            SymbolMap<OHLCAccumulator> candles;
+            std::vector<SymbolId> ids;
+            for (size_t i = 0; i < symbolCount; ++i) {
+                std::string name;
+                for (size_t n = i + 26 * 26 * 26; n > 0; n /= 26) {
+                    name.push_back(static_cast<char>('A' + n % 26));
+                }
+                ids.push_back(candles.intern(name));
+            }
+
+            DeltaSet changes;
+            FlushPolicy policy;
+            policy.maxTicks = flushTicks;
+            ohlc::OHLC request;
+            size_t flushes = 0;
+            size_t deltaCandles = 0;
+            size_t deltaBytes = 0;
+            auto flush = [&]() {
+                std::vector<SymbolId> dirty = changes.flush();
+                for (SymbolId id : dirty) {
+                    fillOHLCProtobuf(candles[id], candles.name(id), request);
+                    request.set_sequence(changes.sequences()[id]);
+                    deltaBytes += request.ByteSizeLong();
+                }
+                deltaCandles += dirty.size();
+                ++flushes;
+            };
+
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < ticks.size(); ++i) {
+                SymbolId id = ids[ticks[i]];
+                candles[id].add(1000.0 + (i * 7919) % 500, 100);
+                changes.touch(id);
+                if (policy.due(changes.ticks(), std::chrono::steady_clock::duration::zero())) {
+                    flush();
+                }
+            }
+            if (!changes.empty()) {
+                flush();
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            size_t fullBytes = 0;
+            for (SymbolId id : ids) {
+                fillOHLCProtobuf(candles[id], candles.name(id), request);
+                fullBytes += request.ByteSizeLong();
+            }
+            const size_t fullCandles = flushes * symbolCount;
+            fullBytes *= flushes;
+
+            const std::string variant = "flush_" + std::to_string(flushTicks) + "/" + std::to_string(symbolCount);
+            Json::Value& result = report.record("delta", variant, tickCount, deltaBytes, seconds);
+            result["full_candles"] = static_cast<Json::UInt64>(fullCandles);
+            result["delta_candles"] = static_cast<Json::UInt64>(deltaCandles);
+            result["full_bytes"] = static_cast<Json::UInt64>(fullBytes);
+            std::cout << std::setw(10) << symbolCount << " symbols, flush every " << std::setw(5) << flushTicks << " ticks: "
+                      << std::setw(9) << fullCandles << " -> " << std::setw(7) << deltaCandles << " candles, "
+                      << std::setw(10) << fullBytes << " -> " << std::setw(8) << deltaBytes << " bytes ("
+                      << std::fixed << std::setprecision(1) << static_cast<double>(fullBytes) / deltaBytes << "x), "
+                      << seconds * 1e9 / tickCount << " ns/tick" << std::defaultfloat << std::endl;
+        }
+    }
+}
+
+// The producer's single-threaded batch path without the network: mmap each
+// file, parse every line, fold it into the symbol's candle, then fill and
+// serialize one message per symbol.
+void benchEndToEnd(const std::string& folderPath, int iterations) {
+    std::vector<std::string> filePaths = listFolder(folderPath);
+    size_t bytes = 0;
+    for (const std::string& filePath : filePaths) {
+        bytes += fs::file_size(filePath);
+    }
+
+    size_t symbols = 0;
+    ParseErrorCounts errors;
+    ParseResult endToEnd = bestOf(iterations, [&]() {
+        ParseResult result;
+        SymbolMap<OHLCAccumulator> candles;
+        TickParser parser;
+        Tick tick;
+        errors = ParseErrorCounts{};
+        for (const std::string& filePath : filePaths) {
+            MappedFile file(filePath);
+            result.lines += file.forEachLine([&](std::string_view line) {
+                ParseStatus status = parser.parse(line, tick);
+                if (status != ParseStatus::Ok) {
+                    errors.count(status);
+                    return;
+                }
+                candles[tick.stockCode].add(tick.price, tick.quantity);
+            });
+        }
+
+        std::string wire;
+        for (SymbolId id = 0; id < candles.size(); ++id) {
+            ohlc::OHLC request;
+            fillOHLCProtobuf(candles[id], candles.name(id), request);
+            request.SerializeToString(&wire);
+            result.quantity += candles[id].volume;
+            result.value += wire.size();
+        }
+        symbols = candles.size();
+        return result;
+    });
+
+    std::cout << "e2e: " << filePaths.size() << " files, " << symbols << " symbols, " << errors.total()
+              << " skipped lines" << std::endl;
+    printResult("producer", endToEnd, bytes);
+    report.record("e2e", "producer", endToEnd.lines, bytes, endToEnd.seconds);
+}
+
+// Restart cost against data volume: a producer without a checkpoint
+// re-reads every file, one with a checkpoint loads its state and stats the
+// files for new bytes, with the producer's own checkpoint code.
+void benchRestart() {
+    const fs::path folder = fs::temp_directory_path() / "producer_bench_restart";
+    std::cout << "restart:" << std::endl;
+
+    for (size_t megabytes : {16, 64, 256}) {
+        fs::remove_all(folder);
+        CorpusOptions corpus;
+        corpus.bytes = static_cast<uint64_t>(megabytes) << 20;
+        std::vector<CorpusFile> files = generateCorpus(folder, corpus);
+        const std::vector<uint64_t> intervals = parseIntervals("1s,1m,5m,1h");
+        const std::string checkpointPath = (folder / "state.ckpt").string();
+
+        auto start = std::chrono::steady_clock::now();
+        SymbolMap<OHLCAccumulator> totals;
+        CandleBuckets buckets(intervals);
+        std::vector<SealedCandle> candles;
+        std::map<std::string, FilePosition> positions;
+        auto sink = [&candles](const SealedCandle& candle) {
+            candles.push_back(candle);
+        };
+        TickParser parser;
+        Tick tick;
+        ParseErrorCounts errors;
+        size_t lines = 0;
+        for (const CorpusFile& corpusFile : files) {
+            MappedFile file(corpusFile.filePath);
+            uint64_t fileTime = corpusFile.timestamp;
+            buckets.advanceTo(fileTime, sink);
+            lines += file.forEachLine([&](std::string_view line) {
+                ParseStatus status = parser.parse(line, tick);
+                if (status != ParseStatus::Ok) {
+                    errors.count(status);
+                    return;
+                }
+                SymbolId id = totals.intern(tick.stockCode);
+                totals[id].add(tick.price, tick.quantity);
+                buckets.add(id, fileTime, tick.price, tick.quantity, sink);
+            });
+            positions[corpusFile.filePath] = FilePosition{corpusFile.timestamp, file.size()};
+        }
+        double replaySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        size_t checkpointBytes = saveProducerCheckpoint(checkpointPath, lines, errors, positions, totals, buckets, candles);
+        double saveSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        uint64_t restoredLines = 0;
+        ParseErrorCounts restoredErrors;
+        std::map<std::string, FilePosition> restoredPositions;
+        SymbolMap<OHLCAccumulator> restoredTotals;
+        CandleBuckets restoredBuckets(intervals);
+        std::vector<SealedCandle> restoredCandles;
+        loadProducerCheckpoint(checkpointPath, restoredLines, restoredErrors, restoredPositions, restoredTotals, restoredBuckets,
+                               restoredCandles);
+        size_t pendingBytes = 0;
+        for (const auto& [filePath, position] : restoredPositions) {
+            pendingBytes += fs::file_size(filePath) - position.offset;
+        }
+        double resumeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (restoredLines != lines || pendingBytes != 0 || restoredTotals.size() != totals.size() ||
+            restoredCandles.size() != candles.size()) {
+            throw std::runtime_error("Restored checkpoint differs from the replayed state.");
+        }
+
+        const std::string variant = std::to_string(megabytes) + "MB";
+        report.record("restart", "replay/" + variant, lines, corpus.bytes, replaySeconds);
+        report.record("restart", "save/" + variant, lines, checkpointBytes, saveSeconds);
+        report.record("restart", "resume/" + variant, lines, checkpointBytes, resumeSeconds);
+
+        std::cout << std::setw(6) << megabytes << " MB, " << std::setw(9) << lines << " lines: replay " << std::fixed
+                  << std::setprecision(3) << std::setw(8) << replaySeconds << " s, checkpoint " << std::setw(8)
+                  << checkpointBytes / 1024.0 << " KB saved in " << std::setw(7) << saveSeconds * 1e3 << " ms, resume "
+                  << std::setw(7) << resumeSeconds * 1e3 << " ms" << std::defaultfloat << std::endl;
+    }
+    fs::remove_all(folder);
+}
+
+uint64_t steadyNanoseconds() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Counts what arrives and nothing else, so the send benchmark measures the
+// RPC pattern rather than Redis. serviceTime stands in for the server's own
+// work per call. With failEvery set, the first SendOHLC of every
+// failEvery-th symbol is refused as UNAVAILABLE to exercise the async
+// sender's retries. arrivalTime is the steady_clock time in nanoseconds at
+// which the latest SendOHLC arrived.
+class CountingConsumer final : public ohlc::OHLCConsumerService::Service {
+public:
+    grpc::Status SendOHLC(grpc::ServerContext*, const ohlc::OHLC* request, ohlc::SendOHLCResponse*) override {
+        arrivalTime = steadyNanoseconds();
+        std::this_thread::sleep_for(serviceTime);
+        if (failEvery != 0 && std::hash<std::string>()(request->stock_code()) % failEvery == 0) {
+            std::lock_guard<std::mutex> lock(failedMutex);
+            if (failed.insert(request->stock_code()).second) {
+                return grpc::Status(grpc::StatusCode::UNAVAILABLE, "Injected failure");
+            }
+        }
+        ++received;
+        return grpc::Status::OK;
+    }
+
+    grpc::Status SendOHLCStream(grpc::ServerContext*, grpc::ServerReader<ohlc::OHLC>* reader,
+                                ohlc::SendOHLCResponse* response) override {
+        ohlc::OHLC request;
+        size_t count = 0;
+        while (reader->Read(&request)) {
+            std::this_thread::sleep_for(serviceTime);
+            ++count;
+        }
+        received += count;
+        response->set_message("Received " + std::to_string(count) + " candles");
+        return grpc::Status::OK;
+    }
+
+    grpc::Status SendOHLCColumns(grpc::ServerContext*, grpc::ServerReader<ohlc::OHLCColumns>* reader,
+                                 ohlc::SendOHLCResponse* response) override {
+        ohlc::OHLCColumns batch;
+        size_t count = 0;
+        while (reader->Read(&batch)) {
+            std::this_thread::sleep_for(serviceTime * batch.symbol_ids_size());
+            count += batch.symbol_ids_size();
+        }
+        received += count;
+        response->set_message("Received " + std::to_string(count) + " candles");
+        return grpc::Status::OK;
+    }
+
+    std::atomic<size_t> received{0};
+    std::atomic<uint64_t> arrivalTime{0};
+    std::chrono::microseconds serviceTime{0};
+    size_t failEvery = 0;
+    std::mutex failedMutex;
+    std::set<std::string> failed;
+};
+
+// One upload of every candle to an in-process server over loopback TCP: the
+// unary loop the producer used to run against SendOHLCStream at a few batch
+// sizes and the async sender at a few window sizes, then again with 2% of
+// calls failing once and retried. The "+0.2ms" variants give the server
+// 0.2 ms of work per candle, which a deep enough window overlaps.
+void benchSend(int iterations) {
+    CountingConsumer consumer;
+    int port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&consumer);
+    std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+    if (!server || port == 0) {
+        throw std::runtime_error("Send benchmark could not start a server.");
+    }
+    std::unique_ptr<ohlc::OHLCConsumerService::Stub> stub = ohlc::OHLCConsumerService::NewStub(
+        grpc::CreateChannel("127.0.0.1:" + std::to_string(port), grpc::InsecureChannelCredentials()));
+
+    std::mt19937 rng(11);
+    std::cout << "send:" << std::endl;
+    for (size_t symbolCount : {8, 900, 5000}) {
+        SymbolMap<OHLCAccumulator> candles;
+        std::vector<SymbolId> ids;
+        for (size_t i = 0; i < symbolCount; ++i) {
+            std::string name;
+            for (size_t n = i + 26 * 26 * 26; n > 0; n /= 26) {
+                name.push_back(static_cast<char>('A' + n % 26));
+            }
+            ids.push_back(candles.intern(name));
+            candles[ids.back()].add(1000.0 + rng() % 9000, 1 + static_cast<int>(rng() % 100));
+        }
+
+        auto time = [&](const std::string& variant, auto send) {
+            double best = 1e30;
+            for (int i = 0; i < iterations; ++i) {
+                consumer.received = 0;
+                auto start = std::chrono::steady_clock::now();
+                send();
+                best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+                if (consumer.received != symbolCount) {
+                    throw std::runtime_error("Send benchmark lost candles on " + variant + ".");
+                }
+            }
+            report.record("send", variant + "/" + std::to_string(symbolCount), symbolCount, 0, best);
+            std::cout << std::setw(10) << symbolCount << " symbols " << std::left << std::setw(16) << variant
+                      << std::right << std::fixed << std::setprecision(0) << std::setw(12) << symbolCount / best
+                      << " candles/s" << std::defaultfloat << std::endl;
+        };
+
+        time("unary", [&]() {
+            sendCandlesUnary(*stub, candles, ids, {}, [](const std::string&, const grpc::Status& status) {
+                if (!status.ok()) {
+                    throw std::runtime_error("SendOHLC failed: " + status.error_message());
+                }
+            });
+        });
+        for (size_t batchSize : {1, 64, 512}) {
+            time("stream/" + std::to_string(batchSize), [&]() {
+                ohlc::SendOHLCResponse response;
+                grpc::Status status = sendCandlesStream(*stub, candles, ids, {}, batchSize, response);
+                if (!status.ok()) {
+                    throw std::runtime_error("SendOHLCStream failed: " + status.error_message());
+                }
+            });
+        }
+        time("columns/512", [&]() {
+            ohlc::SendOHLCResponse response;
+            grpc::Status status = sendCandlesColumns(*stub, candles, ids, {}, 512, 0, response);
+            if (!status.ok()) {
+                throw std::runtime_error("SendOHLCColumns failed: " + status.error_message());
+            }
+        });
+
+        RetryPolicy retry;
+        retry.backoff = std::chrono::milliseconds(1);
+        auto sendAsync = [&](size_t window) {
+            sendCandlesAsync(*stub, candles, ids, {}, window, retry, [](const std::string&, const grpc::Status& status) {
+                if (!status.ok()) {
+                    throw std::runtime_error("SendOHLC failed: " + status.error_message());
+                }
+            });
+        };
+        for (size_t window : {1, 16, 64, 256}) {
+            time("async/" + std::to_string(window), [&]() { sendAsync(window); });
+        }
+        consumer.failEvery = 50;
+        time("async/64+retry", [&]() {
+            consumer.failed.clear();
+            sendAsync(64);
+        });
+        consumer.failEvery = 0;
+
+        if (symbolCount == 900) {
+            consumer.serviceTime = std::chrono::microseconds(200);
+            time("unary+0.2ms", [&]() {
+                sendCandlesUnary(*stub, candles, ids, {}, [](const std::string&, const grpc::Status&) {});
+            });
+            for (size_t window : {16, 64}) {
+                time("async/" + std::to_string(window) + "+0.2ms", [&]() { sendAsync(window); });
+            }
+            consumer.serviceTime = std::chrono::microseconds(0);
+        }
+    }
+    server->Shutdown();
+}
+
+// Producer to consumer latency of one candle at a time, the next sent once
+// the last has arrived: SendOHLC to an in-process gRPC server over loopback
+// TCP against a write into a shared memory ring with a reader thread that
+// polls it the way the server's does. One-way latency runs from the start of
+// the send to the consumer having the candle; for gRPC the round trip until
+// SendOHLC returns is shown too. Then candles/s of 5000 symbols sent back to
+// back, SendOHLCStream in batches of 512 against the ring.
+void benchShm() {
+    const size_t samples = 20000;
+    const size_t symbolCount = 5000;
+    const int rounds = 20;
+
+    CountingConsumer consumer;
+    int port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&consumer);
+    std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+    if (!server || port == 0) {
+        throw std::runtime_error("Shm benchmark could not start a server.");
+    }
+    std::unique_ptr<ohlc::OHLCConsumerService::Stub> stub = ohlc::OHLCConsumerService::NewStub(
+        grpc::CreateChannel("127.0.0.1:" + std::to_string(port), grpc::InsecureChannelCredentials()));
+
+    const std::string ringName = "/ohlc-bench-" + std::to_string(::getpid());
+    std::unique_ptr<ShmRing> ring = ShmRing::create(ringName, 65536);
+    std::unique_ptr<ShmRing> writer = ShmRing::attach(ringName);
+    std::vector<uint64_t> ringLatency(samples);
+    std::atomic<size_t> ringReceived{0};
+    std::atomic<bool> measuring{true};
+    std::atomic<bool> stop{false};
+    std::thread reader([&]() {
+        ShmCandle candle;
+        ShmBackoff backoff;
+        while (!stop) {
+            if (!ring->tryRead(candle)) {
+                backoff.wait();
+                continue;
+            }
+            backoff.reset();
+            size_t index = ringReceived.load(std::memory_order_relaxed);
+            if (measuring && index < samples) {
+                ringLatency[index] = steadyNanoseconds() - candle.sendTime;
+            }
+            ringReceived.store(index + 1, std::memory_order_release);
+        }
+    });
+
+    std::mt19937 rng(17);
+    SymbolMap<OHLCAccumulator> candles;
+    std::vector<SymbolId> ids;
+    for (size_t i = 0; i < symbolCount; ++i) {
+        std::string name;
+        for (size_t n = i + 26 * 26 * 26; n > 0; n /= 26) {
+            name.push_back(static_cast<char>('A' + n % 26));
+        }
+        ids.push_back(candles.intern(name));
+        candles[ids.back()].add(1000.0 + rng() % 9000, 1 + static_cast<int>(rng() % 100));
+    }
+
+    auto print = [&](const std::string& variant, std::vector<uint64_t>& nanoseconds) {
+        std::sort(nanoseconds.begin(), nanoseconds.end());
+        auto percentile = [&](double p) {
+            return nanoseconds[std::min(nanoseconds.size() - 1, static_cast<size_t>(p * nanoseconds.size()))] / 1000.0;
+        };
+        Json::Value& result = report.record("shm", variant, nanoseconds.size(), 0, 0.0);
+        result["p50_us"] = percentile(0.50);
+        result["p99_us"] = percentile(0.99);
+        result["p999_us"] = percentile(0.999);
+        std::cout << "  " << std::left << std::setw(22) << variant << std::right << std::fixed << std::setprecision(1)
+                  << " p50 " << std::setw(7) << percentile(0.50) << " us, p99 " << std::setw(7) << percentile(0.99)
+                  << " us, p99.9 " << std::setw(7) << percentile(0.999) << " us" << std::defaultfloat << std::endl;
+    };
+
+    std::cout << "shm:" << std::endl;
+    std::vector<uint64_t> grpcOneWay(samples);
+    std::vector<uint64_t> grpcRoundTrip(samples);
+    for (size_t i = 0; i < samples; ++i) {
+        SymbolId id = ids[i % ids.size()];
+        uint64_t start = steadyNanoseconds();
+        ohlc::OHLC request;
+        fillOHLCProtobuf(candles[id], candles.name(id), request);
+        grpc::ClientContext context;
+        ohlc::SendOHLCResponse response;
+        grpc::Status status = stub->SendOHLC(&context, request, &response);
+        if (!status.ok()) {
+            throw std::runtime_error("SendOHLC failed: " + status.error_message());
+        }
+        grpcRoundTrip[i] = steadyNanoseconds() - start;
+        grpcOneWay[i] = consumer.arrivalTime - start;
+    }
+    print("grpc_unary_one_way", grpcOneWay);
+    print("grpc_unary_round_trip", grpcRoundTrip);
+
+    ShmCandle candle;
+    for (size_t i = 0; i < samples; ++i) {
+        SymbolId id = ids[i % ids.size()];
+        ShmBackoff backoff;
+        candle.sendTime = steadyNanoseconds();
+        fillShmCandle(candles[id], candles.name(id), 0, candle);
+        while (!writer->tryWrite(candle)) {
+            backoff.wait();
+        }
+        backoff.reset();
+        while (ringReceived.load(std::memory_order_acquire) != i + 1) {
+            backoff.wait();
+        }
+    }
+    print("shm_one_way", ringLatency);
+    measuring = false;
+
+    auto throughput = [&](const std::string& variant, auto send, auto arrived) {
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; ++round) {
+            send();
+        }
+        ShmBackoff backoff;
+        while (arrived() < symbolCount * rounds) {
+            backoff.wait();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        report.record("shm", variant, symbolCount * rounds, 0, seconds);
+        std::cout << "  " << std::left << std::setw(22) << variant << std::right << std::fixed << std::setprecision(0)
+                  << std::setw(12) << symbolCount * rounds / seconds << " candles/s" << std::defaultfloat << std::endl;
+    };
+    consumer.received = 0;
+    throughput("grpc_stream/512", [&]() {
+        ohlc::SendOHLCResponse response;
+        grpc::Status status = sendCandlesStream(*stub, candles, ids, {}, 512, response);
+        if (!status.ok()) {
+            throw std::runtime_error("SendOHLCStream failed: " + status.error_message());
+        }
+    }, [&]() { return consumer.received.load(); });
+    ringReceived = 0;
+    throughput("shm", [&]() {
+        sendCandlesShm(*writer, candles, ids, {}, std::chrono::milliseconds(5000), [](const std::string&, const grpc::Status& status) {
+            if (!status.ok()) {
+                throw std::runtime_error("Shared memory send failed: " + status.error_message());
+            }
+        });
+    }, [&]() { return ringReceived.load(); });
+
+    stop = true;
+    reader.join();
+    server->Shutdown();
+}
+
+// The two candle stores the server can run on, behind the same calls it
+// makes: running candles for 900 symbols written 256 at a time and waited
+// on, as the shared memory path saves them; one symbol read back at a time;
+// and a day of one-second history written, then read a page of 5000 at a
+// time. Redis is skipped when it cannot be reached.
+void benchStore() {
+    const size_t symbolCount = 900;
+    const size_t writeCount = 200000;
+    const size_t batchSize = 256;
+    const size_t reads = 20000;
+    const size_t historyCount = 23400;
+    const uint32_t pageSize = 5000;
+    const uint64_t second = 1000000000ULL;
+    const uint64_t dayStart = 1704067200ULL * second;
+    std::mt19937 rng(23);
+    std::cout << "store:" << std::endl;
+
+    std::vector<ohlc::OHLC> candles(symbolCount);
+    std::vector<std::string> symbols;
+    for (size_t i = 0; i < symbolCount; ++i) {
+        std::string name;
+        for (size_t n = i + 26 * 26 * 26; n > 0; n /= 26) {
+            name.push_back(static_cast<char>('A' + n % 26));
+        }
+        symbols.push_back(name);
+        OHLCAccumulator ohlc;
+        const double basePrice = 50 + rng() % 20000;
+        for (int tick = 0; tick < 64; ++tick) {
+            ohlc.add(basePrice + rng() % 100, 100 * (1 + static_cast<int>(rng() % 50000)));
+        }
+        fillOHLCProtobuf(ohlc, name, candles[i]);
+    }
+    std::vector<StoredCandleBytes> values(symbolCount);
+    for (size_t i = 0; i < symbolCount; ++i) {
+        encodeStoredCandle(candles[i], values[i]);
+    }
+    std::vector<StoredCandleBytes> historyValues(historyCount);
+    for (size_t i = 0; i < historyCount; ++i) {
+        ohlc::OHLC candle = candles[0];
+        candle.set_interval(second);
+        candle.set_start_time(dayStart + i * second);
+        encodeStoredCandle(candle, historyValues[i]);
+    }
+
+    auto wait = [](auto start) {
+        auto result = std::make_shared<std::promise<StoreResult>>();
+        std::future<StoreResult> done = result->get_future();
+        start([result](const StoreResult& outcome) { result->set_value(outcome); });
+        StoreResult outcome = done.get();
+        if (!outcome.ok()) {
+            throw std::runtime_error("Store benchmark failed: " + outcome.message);
+        }
+    };
+
+    auto measure = [&](const std::string& variant, CandleStore& store) {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<LatestWrite> latest;
+        for (size_t written = 0; written < writeCount;) {
+            latest.clear();
+            for (; latest.size() < batchSize && written < writeCount; ++written) {
+                const size_t i = written % symbolCount;
+                latest.push_back(LatestWrite{symbols[i], std::string_view(values[i].data, values[i].size)});
+            }
+            wait([&](StoreDone done) { store.write(latest, {}, done); });
+        }
+        double writeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::vector<uint64_t> readNanoseconds(reads);
+        size_t found = 0;
+        for (size_t i = 0; i < reads; ++i) {
+            const std::vector<std::string_view> stockCode{symbols[(i * 7) % symbolCount]};
+            const uint64_t readStart = steadyNanoseconds();
+            wait([&](StoreDone done) {
+                store.readLatest(stockCode, [&](size_t, std::string_view) { ++found; }, done);
+            });
+            readNanoseconds[i] = steadyNanoseconds() - readStart;
+        }
+        std::sort(readNanoseconds.begin(), readNanoseconds.end());
+
+        start = std::chrono::steady_clock::now();
+        std::vector<HistoryWrite> history;
+        for (size_t begin = 0; begin < historyCount; begin += batchSize) {
+            history.clear();
+            for (size_t i = begin; i < std::min(begin + batchSize, historyCount); ++i) {
+                history.push_back(HistoryWrite{symbols[0], second, (dayStart + i * second) / 1000000,
+                                               std::string_view(historyValues[i].data, historyValues[i].size)});
+            }
+            wait([&](StoreDone done) { store.write({}, history, done); });
+        }
+        double historySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        size_t pages = 0;
+        size_t historyRead = 0;
+        for (int round = 0; round < 5; ++round) {
+            uint64_t from = dayStart / 1000000;
+            size_t count = pageSize;
+            while (count == pageSize) {
+                count = 0;
+                wait([&](StoreDone done) {
+                    store.readHistory(HistoryQuery{symbols[0], second, from, HistoryQuery::unbounded, pageSize},
+                                      [&](size_t, std::string_view) { ++count; }, done);
+                });
+                from += count * 1000;
+                historyRead += count;
+                ++pages;
+            }
+        }
+        double pageSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (found != reads || historyRead != 5 * historyCount) {
+            throw std::runtime_error("Store benchmark read back " + std::to_string(found) + " candles and " +
+                                     std::to_string(historyRead) + " history candles.");
+        }
+
+        const double p50 = readNanoseconds[reads / 2] / 1000.0;
+        const double p99 = readNanoseconds[reads * 99 / 100] / 1000.0;
+        Json::Value& result = report.record("store", variant, writeCount, 0, writeSeconds);
+        result["read_p50_us"] = p50;
+        result["read_p99_us"] = p99;
+        result["history_candles_per_s"] = historyCount / historySeconds;
+        result["page_ms"] = pageSeconds * 1000 / pages;
+        std::cout << "  " << std::left << std::setw(6) << variant << std::right << std::fixed << std::setprecision(0)
+                  << std::setw(10) << writeCount / writeSeconds << " candles/s written" << std::setprecision(1)
+                  << "  read p50 " << std::setw(6) << p50 << " us, p99 " << std::setw(6) << p99 << " us" << std::setprecision(0)
+                  << std::setw(10) << historyCount / historySeconds << " history candles/s" << std::setprecision(2)
+                  << std::setw(8) << pageSeconds * 1000 / pages << " ms/page" << std::defaultfloat << std::endl;
+    };
+
+    const fs::path logPath = fs::temp_directory_path() / ("ohlc-bench-" + std::to_string(::getpid()) + ".log");
+    {
+        LogCandleStore store(logPath.string(), 1024);
+        measure("log", store);
+    }
+    fs::remove(logPath);
+
+    std::unique_ptr<RedisCandleStore> redis;
+    try {
+        redis = std::make_unique<RedisCandleStore>("localhost", 6379, 1, 1024, std::chrono::milliseconds(1000), std::chrono::seconds(5), batchSize);
+    } catch (const std::exception& e) {
+        std::cout << "  redis  skipped: " << e.what() << std::endl;
+        return;
+    }
+    measure("redis", *redis);
+}
+
+// "10G", "512M", "64K" or plain bytes.
+uint64_t parseSize(std::string_view text) {
+    uint64_t value = 0;
+    auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    std::string_view suffix(ptr, text.data() + text.size() - ptr);
+    if (ec != std::errc() || value == 0) {
+        throw std::invalid_argument("Invalid size: " + std::string(text));
+    }
+    if (suffix == "K") return value << 10;
+    if (suffix == "M") return value << 20;
+    if (suffix == "G") return value << 30;
+    if (suffix.empty()) return value;
+    throw std::invalid_argument("Invalid size: " + std::string(text));
+}
+
+int main(int argc, char** argv) {
+    try {
+        const std::string usage = "Usage: " + std::string(argv[0]) +
+            " [all|read|parse|aggregate|symbols|buckets|fill|schema|stored|cache|store|delta|send|shm|e2e|restart] [data_folder] [iterations] [--json=FILE] [--label=NAME]\n"
+            "       " + std::string(argv[0]) + " generate folder [--size=10G] [--symbols=5000]";
+        std::vector<std::string> positional;
+        std::string jsonPath;
+        std::string label;
+        CorpusOptions corpus;
+        for (int i = 1; i < argc; ++i) {
+            std::string_view arg = argv[i];
+            if (arg.rfind("--json=", 0) == 0) {
+                jsonPath = std::string(arg.substr(7));
+            } else if (arg.rfind("--label=", 0) == 0) {
+                label = std::string(arg.substr(8));
+            } else if (arg.rfind("--size=", 0) == 0) {
+                corpus.bytes = parseSize(arg.substr(7));
+            } else if (arg.rfind("--symbols=", 0) == 0) {
+                corpus.symbols = std::stoul(std::string(arg.substr(10)));
+            } else if (arg.rfind("--", 0) == 0) {
+                throw std::invalid_argument(usage);
+            } else {
+                positional.emplace_back(arg);
+            }
+        }
+
+        std::string benchmark = positional.size() > 0 ? positional[0] : "all";
+        std::string folderPath = positional.size() > 1 ? positional[1] : "./data";
+        int iterations = positional.size() > 2 ? std::stoi(positional[2]) : 3;
+
+        if (benchmark == "generate") {
+            if (positional.size() != 2 || corpus.symbols == 0) {
+                throw std::invalid_argument(usage);
+            }
+            auto start = std::chrono::steady_clock::now();
+            std::vector<CorpusFile> files = generateCorpus(folderPath, corpus);
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "Generated " << files.size() << " files, " << corpus.bytes << " bytes, " << corpus.symbols
+                      << " symbols in " << folderPath << " in " << seconds << " s" << std::endl;
+            return 0;
+        }
+
+        if (benchmark != "all" && benchmark != "read" && benchmark != "parse" && benchmark != "aggregate" &&
+            benchmark != "symbols" && benchmark != "buckets" && benchmark != "fill" && benchmark != "schema" &&
+            benchmark != "stored" && benchmark != "cache" && benchmark != "store" && benchmark != "delta" && benchmark != "send" && benchmark != "shm" && benchmark != "e2e" && benchmark != "restart") {
+            throw std::invalid_argument(usage);
+        }
+        if (benchmark == "all" || benchmark == "read") {
+            benchRead(folderPath, iterations);
+        }
+        if (benchmark == "all" || benchmark == "parse") {
+            benchParse(folderPath, iterations);
+        }
+        if (benchmark == "all" || benchmark == "aggregate") {
+            benchAggregate();
+        }
+        if (benchmark == "all" || benchmark == "symbols") {
+            benchSymbols();
+        }
+        if (benchmark == "all" || benchmark == "buckets") {
+            benchBuckets();
+        }
+        if (benchmark == "all" || benchmark == "fill") {
+            benchFill();
+        }
+        if (benchmark == "all" || benchmark == "schema") {
+            benchSchema();
+        }
+        if (benchmark == "all" || benchmark == "stored") {
+            benchStored();
+        }
+        if (benchmark == "all" || benchmark == "cache") {
+            benchCache();
+        }
+        if (benchmark == "all" || benchmark == "store") {
+            benchStore();
+        }
+        if (benchmark == "all" || benchmark == "delta") {
+            benchDelta();
+        }
+        if (benchmark == "all" || benchmark == "send") {
+            benchSend(iterations);
+        }
+        if (benchmark == "all" || benchmark == "shm") {
+            benchShm();
+        }
+        if (benchmark == "all" || benchmark == "e2e") {
+            benchEndToEnd(folderPath, iterations);
+        }
+        if (benchmark == "all" || benchmark == "restart") {
+            benchRestart();
+        }
+        if (!jsonPath.empty()) {
+            report.save(jsonPath, label);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
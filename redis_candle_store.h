@@ -0,0 +1,232 @@
+#ifndef REDIS_CANDLE_STORE_H
+#define REDIS_CANDLE_STORE_H
+
+#include <hiredis/hiredis.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "async_redis.h"
+#include "candle_buckets.h"
+#include "candle_store.h"
+
+// Candles in Redis. A running candle is a string keyed by its stock code. A
+// symbol's history at one interval is a sorted set, "history:1m:BBCA" for
+// its one-minute candles, of values scored by their start in milliseconds
+// since the epoch. Scores are doubles, and milliseconds keep them exact for
+// any date.
+//
+// Commands go out on AsyncRedis event loops and done is called from the
+// loop once the replies are in. Reads take readLoops loops in turn, which
+// share maxQueued between them. Writes all go out on one more loop of their
+// own, with maxQueued to themselves, whose one connection Redis answers in
+// order, so a later write can never land before an earlier one and set a
+// symbol back to an older candle. A write is
+// one pipelined MULTI/EXEC however many candles it holds, the latest values
+// with one MSET per maxSetBatch and then the history values, so a command
+// Redis refuses to queue, or a connection lost before EXEC, keeps none of
+// it. Redis does not roll back a command that fails inside EXEC, which only
+// a key of the wrong type can cause; the write is still reported as failed.
+class RedisCandleStore final : public CandleStore {
+public:
+    RedisCandleStore(std::string host, int port, unsigned readLoops, size_t maxQueued, std::chrono::milliseconds timeout,
+                     std::chrono::seconds healthCheck, size_t maxSetBatch)
+        : host(std::move(host)), port(port), timeout(timeout), maxSetBatch(std::max<size_t>(maxSetBatch, 1)) {
+        writeLoop = std::make_unique<AsyncRedis>(this->host, port, timeout, healthCheck, std::max<size_t>(maxQueued, 1));
+        const size_t queuedPerLoop = std::max<size_t>(maxQueued / std::max(readLoops, 1u), 1);
+        for (unsigned i = 0; i < std::max(readLoops, 1u); ++i) {
+            redis.push_back(std::make_unique<AsyncRedis>(this->host, port, timeout, healthCheck, queuedPerLoop));
+        }
+    }
+
+    static std::string historyKey(std::string_view stockCode, uint64_t interval) {
+        return "history:" + formatInterval(interval) + ":" + std::string(stockCode);
+    }
+
+    std::string describe() const override {
+        return "Redis at " + host + ":" + std::to_string(port) + " (" + std::to_string(redis.size()) + " read event loops and a write one)";
+    }
+
+    void write(const std::vector<LatestWrite>& latest, const std::vector<HistoryWrite>& history, StoreDone done) override {
+        if (latest.empty() && history.empty()) {
+            done(StoreResult{});
+            return;
+        }
+        RedisPipeline pipeline;
+        pipeline.add({"MULTI"});
+        for (size_t begin = 0; begin < latest.size(); begin += maxSetBatch) {
+            const size_t end = std::min(begin + maxSetBatch, latest.size());
+            std::vector<const char*> argv{"MSET"};
+            std::vector<size_t> argvLengths{4};
+            for (size_t i = begin; i < end; ++i) {
+                argv.push_back(latest[i].stockCode.data());
+                argvLengths.push_back(latest[i].stockCode.size());
+                argv.push_back(latest[i].value.data());
+                argvLengths.push_back(latest[i].value.size());
+            }
+            pipeline.add(static_cast<int>(argv.size()), argv.data(), argvLengths.data());
+        }
+        for (const HistoryWrite& candle : history) {
+            const std::string key = historyKey(candle.stockCode, candle.interval);
+            const std::string score = std::to_string(candle.startMilliseconds);
+            pipeline.add({"ZREMRANGEBYSCORE", key, score, score});
+            pipeline.add({"ZADD", key, score, candle.value});
+        }
+        pipeline.add({"EXEC"});
+        const size_t execReply = pipeline.size() - 1;
+        run(*writeLoop, std::move(pipeline), [execReply](size_t index, const redisReply& reply) {
+            if (reply.type == REDIS_REPLY_ERROR) {
+                throw std::runtime_error("Failed to save OHLC data to Redis: " + std::string(reply.str, reply.len));
+            }
+            if (index != execReply) {
+                return;
+            }
+            if (reply.type != REDIS_REPLY_ARRAY) {
+                throw std::runtime_error("Failed to save OHLC data to Redis: transaction aborted");
+            }
+            for (size_t i = 0; i < reply.elements; ++i) {
+                if (reply.element[i]->type == REDIS_REPLY_ERROR) {
+                    throw std::runtime_error("Failed to save OHLC data to Redis: " + std::string(reply.element[i]->str, reply.element[i]->len));
+                }
+            }
+        }, std::move(done));
+    }
+
+    // One symbol with GET, more with one MGET.
+    void readLatest(const std::vector<std::string_view>& stockCodes, StoredValueHandler onValue, StoreDone done) override {
+        if (stockCodes.empty()) {
+            done(StoreResult{});
+            return;
+        }
+        RedisPipeline pipeline;
+        if (stockCodes.size() == 1) {
+            pipeline.add({"GET", stockCodes[0]});
+            run(nextLoop(), std::move(pipeline), [onValue](size_t, const redisReply& reply) {
+                if (reply.type == REDIS_REPLY_STRING) {
+                    onValue(0, std::string_view(reply.str, reply.len));
+                } else if (reply.type == REDIS_REPLY_ERROR) {
+                    throw std::runtime_error("Failed to retrieve OHLC data from Redis: " + std::string(reply.str, reply.len));
+                }
+            }, std::move(done));
+            return;
+        }
+        std::vector<const char*> argv{"MGET"};
+        std::vector<size_t> argvLengths{4};
+        for (std::string_view stockCode : stockCodes) {
+            argv.push_back(stockCode.data());
+            argvLengths.push_back(stockCode.size());
+        }
+        pipeline.add(static_cast<int>(argv.size()), argv.data(), argvLengths.data());
+        const size_t expected = stockCodes.size();
+        run(nextLoop(), std::move(pipeline), [onValue, expected](size_t, const redisReply& reply) {
+            if (reply.type != REDIS_REPLY_ARRAY || reply.elements != expected) {
+                std::string error = reply.type == REDIS_REPLY_ERROR ? std::string(reply.str) : "unexpected reply";
+                throw std::runtime_error("Failed to retrieve OHLC batch from Redis: " + error);
+            }
+            for (size_t i = 0; i < reply.elements; ++i) {
+                if (reply.element[i]->type == REDIS_REPLY_STRING) {
+                    onValue(i, std::string_view(reply.element[i]->str, reply.element[i]->len));
+                }
+            }
+        }, std::move(done));
+    }
+
+    void readHistory(const HistoryQuery& query, StoredValueHandler onValue, StoreDone done) override {
+        RedisPipeline pipeline;
+        pipeline.add({"ZRANGEBYSCORE", historyKey(query.stockCode, query.interval), std::to_string(query.fromMilliseconds),
+                      query.toMilliseconds == HistoryQuery::unbounded ? "+inf" : "(" + std::to_string(query.toMilliseconds), "LIMIT", "0",
+                      std::to_string(query.limit)});
+        run(nextLoop(), std::move(pipeline), [onValue](size_t, const redisReply& reply) {
+            if (reply.type != REDIS_REPLY_ARRAY) {
+                std::string error = reply.type == REDIS_REPLY_ERROR ? std::string(reply.str) : "unexpected reply";
+                throw std::runtime_error("Failed to retrieve OHLC range from Redis: " + error);
+            }
+            for (size_t i = 0; i < reply.elements; ++i) {
+                onValue(i, std::string_view(reply.element[i]->str, reply.element[i]->len));
+            }
+        }, std::move(done));
+    }
+
+    // Scans the string keys on a connection of its own and reads them 1000
+    // at a time.
+    void scanLatest(const std::function<void(std::string_view stockCode, std::string_view value)>& onValue) override {
+        const timeval tv{static_cast<time_t>(timeout.count() / 1000), static_cast<suseconds_t>(timeout.count() % 1000 * 1000)};
+        std::unique_ptr<redisContext, void (*)(redisContext*)> context(redisConnectWithTimeout(host.c_str(), port, tv), redisFree);
+        if (context == nullptr || context->err) {
+            throw std::runtime_error("Failed to connect to Redis: " + std::string(context ? context->errstr : "out of memory"));
+        }
+        redisSetTimeout(context.get(), tv);
+        std::string cursor = "0";
+        do {
+            std::unique_ptr<redisReply, void (*)(void*)> reply(
+                static_cast<redisReply*>(redisCommand(context.get(), "SCAN %s COUNT 1000 TYPE string", cursor.c_str())), freeReplyObject);
+            if (reply == nullptr || reply->type != REDIS_REPLY_ARRAY || reply->elements != 2 ||
+                reply->element[0]->type != REDIS_REPLY_STRING || reply->element[1]->type != REDIS_REPLY_ARRAY) {
+                std::string error = reply && reply->type == REDIS_REPLY_ERROR ? std::string(reply->str) : "unexpected reply";
+                throw std::runtime_error("Failed to scan Redis: " + error);
+            }
+            cursor = reply->element[0]->str;
+            const redisReply* keys = reply->element[1];
+            if (keys->elements == 0) {
+                continue;
+            }
+            std::vector<const char*> argv{"MGET"};
+            std::vector<size_t> argvLengths{4};
+            for (size_t i = 0; i < keys->elements; ++i) {
+                argv.push_back(keys->element[i]->str);
+                argvLengths.push_back(keys->element[i]->len);
+            }
+            std::unique_ptr<redisReply, void (*)(void*)> values(
+                static_cast<redisReply*>(redisCommandArgv(context.get(), static_cast<int>(argv.size()), argv.data(), argvLengths.data())),
+                freeReplyObject);
+            if (values == nullptr || values->type != REDIS_REPLY_ARRAY || values->elements != keys->elements) {
+                std::string error = values && values->type == REDIS_REPLY_ERROR ? std::string(values->str) : "unexpected reply";
+                throw std::runtime_error("Failed to read scanned keys from Redis: " + error);
+            }
+            for (size_t i = 0; i < values->elements; ++i) {
+                if (values->element[i]->type == REDIS_REPLY_STRING) {
+                    onValue(std::string_view(keys->element[i]->str, keys->element[i]->len),
+                            std::string_view(values->element[i]->str, values->element[i]->len));
+                }
+            }
+        } while (cursor != "0");
+    }
+
+private:
+    AsyncRedis& nextLoop() {
+        return *redis[next.fetch_add(1, std::memory_order_relaxed) % redis.size()];
+    }
+
+    static void run(AsyncRedis& loop, RedisPipeline pipeline, RedisReplyHandler onReply, StoreDone done) {
+        auto finish = std::make_shared<StoreDone>(std::move(done));
+        bool queued = loop.send(std::move(pipeline), std::move(onReply), [finish](const RedisResult& result) {
+            switch (result.code) {
+                case RedisResult::Code::Ok:
+                    (*finish)(StoreResult{});
+                    return;
+                case RedisResult::Code::Unavailable:
+                    (*finish)(StoreResult{StoreResult::Code::Unavailable, result.message});
+                    return;
+                case RedisResult::Code::Failed:
+                    (*finish)(StoreResult{StoreResult::Code::Failed, result.message});
+                    return;
+            }
+        });
+        if (!queued) {
+            (*finish)(StoreResult{StoreResult::Code::Busy, "Redis queue is full"});
+        }
+    }
+
+    const std::string host;
+    const int port;
+    const std::chrono::milliseconds timeout;
+    const size_t maxSetBatch;
+    std::unique_ptr<AsyncRedis> writeLoop;
+    std::vector<std::unique_ptr<AsyncRedis>> redis;
+    std::atomic<size_t> next{0};
+};
+
+#endif // REDIS_CANDLE_STORE_H
@@ -1,10 +1,28 @@
 #include <grpc++/grpc++.h>
 #include "ohlc.grpc.pb.h"
-#include <hiredis/hiredis.h>
 #include <iostream>
-#include <sstream>
 #include <stdexcept>
 #include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include "candle_buckets.h"
+#include "candle_cache.h"
+#include "candle_store.h"
+#include "log_candle_store.h"
+#include "ohlc_message.h"
+#include "redis_candle_store.h"
+#include "shm_ring.h"
+#include "stored_candle.h"
+#include "subscription_hub.h"
+#include "write_batcher.h"
 
 template <typename ExceptionType>
 class ExceptionHandler {
@@ -28,7 +46,7 @@ struct OHLCData {
     double high;
     double low;
     double close;
-    int volume;
+    int64_t volume;
     double value;
     std::string stockCode;
 };
@@ -38,128 +56,1122 @@ public:
     OHLCWithRedisException(const std::string& message) : std::runtime_error(message) {}
 };
 
-class RedisConnection {
+// The sequence number of the last delta saved for each symbol. Producers
+// number a symbol's deltas from 1 on every run, so 1 always starts over. A
+// number past the next one means deltas were lost on the way; one at or
+// below the last saved is a repeat, such as the retry of a call that was
+// saved after all, and must not overwrite the newer candle. Sequence 0 is an
+// unnumbered candle and always saved.
+//
+// A candle let through is pending until its save succeeds or fails, and the
+// next one of its symbol is judged against it, so a batch judged while the
+// one before it is still on its way to the store sees no false gap.
+class SequenceTracker {
 public:
-    RedisConnection(const char* host, int port) : connection(redisConnect(host, port)) {
-        if (connection != nullptr && connection->err) {
-            throw OHLCWithRedisException("Failed to connect to Redis: " + std::string(connection->errstr));
+    enum class Verdict { Next, Gap, Repeat };
+
+    static Verdict judge(uint64_t sequence, uint64_t last) {
+        if (sequence == 0 || sequence == 1 || sequence == last + 1) {
+            return Verdict::Next;
         }
+        return sequence > last ? Verdict::Gap : Verdict::Repeat;
     }
 
-    ~RedisConnection() {
-        redisFree(connection);
+    // Judges sequence against the last pending or saved one, which is left
+    // in last. Unless it is a repeat, sequence is pending from here on.
+    Verdict check(const std::string& symbol, uint64_t sequence, uint64_t& last) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto inFlight = pending.find(symbol);
+        if (inFlight != pending.end()) {
+            last = inFlight->second;
+        } else {
+            auto it = lastSaved.find(symbol);
+            last = it == lastSaved.end() ? 0 : it->second;
+        }
+        Verdict verdict = judge(sequence, last);
+        if (verdict != Verdict::Repeat && sequence != 0) {
+            pending[symbol] = sequence;
+        }
+        return verdict;
     }
 
-    redisContext* get() const {
-        return connection;
+    // Called once the candle is saved.
+    void saved(const std::string& symbol, uint64_t sequence) {
+        if (sequence == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        uint64_t& last = lastSaved[symbol];
+        last = sequence == 1 ? 1 : std::max(last, sequence);
+        release(symbol, sequence);
+    }
+
+    // Called when the candle's save failed, so that it can be retried.
+    void failed(const std::string& symbol, uint64_t sequence) {
+        if (sequence == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        release(symbol, sequence);
     }
 
 private:
-    redisContext* connection;
+    // Nothing is pending for symbol any more unless a later candle is.
+    void release(const std::string& symbol, uint64_t sequence) {
+        auto inFlight = pending.find(symbol);
+        if (inFlight != pending.end() && inFlight->second == sequence) {
+            pending.erase(inFlight);
+        }
+    }
+
+    std::mutex mutex;
+    std::unordered_map<std::string, uint64_t> lastSaved;
+    std::unordered_map<std::string, uint64_t> pending;
+};
+
+// Interval candles are kept in their symbol's history at that interval under
+// their start in milliseconds since the epoch, which Redis scores keep exact
+// for any date. Intervals are whole milliseconds, so no two buckets of one
+// interval share a start.
+constexpr uint64_t nanosecondsPerMillisecond = 1000000;
+
+inline bool isHistoryInterval(uint64_t interval) {
+    return interval != 0 && interval % nanosecondsPerMillisecond == 0;
+}
+
+// The first millisecond at or after time, in nanoseconds.
+inline uint64_t startMillisecondsFrom(uint64_t time) {
+    return time / nanosecondsPerMillisecond + (time % nanosecondsPerMillisecond != 0 ? 1 : 0);
+}
+
+struct ServerOptions {
+    std::string address = "0.0.0.0:50051";
+    unsigned completionQueues = std::max(std::thread::hardware_concurrency(), 1u);
+    unsigned redisThreads = std::max(std::thread::hardware_concurrency() / 4, 1u);
+    size_t maxQueuedJobs = 65536;
+    std::chrono::milliseconds redisTimeout{1000};
+    std::chrono::seconds redisHealthCheck{5};
+    size_t writeBatch = 256;
+    std::chrono::microseconds writeDelay{200};
+    bool quiet = false;
+    bool cache = true;
+    std::string shmName;
+    size_t shmSlots = 65536;
+    std::string store = "redis";
+    std::string storePath = "candles.log";
 };
 
-class OHLCConsumerServiceImpl final : public ohlc::OHLCConsumerService::Service {
+// Async OHLCConsumerService. Each completion queue is polled by one thread
+// that only moves calls between states. Candles are kept in the CandleStore
+// picked by --store, and a call is finished from wherever the store reports
+// back: with Redis, from the event loop that got the replies, so a slow
+// Redis delays the calls waiting on it without holding any thread, and
+// thousands can wait at once; with the candle log, at once on the completion
+// queue thread. Reads of a cached symbol skip the store altogether.
+class OHLCConsumerServiceImpl final {
 public:
-    grpc::Status SendOHLC(grpc::ServerContext* context, const ohlc::OHLC* request, ohlc::SendOHLCResponse* response) override {
-        ExceptionHandler<OHLCWithRedisException>::Handle([&]() {
-            saveOHLCDataToRedis(request);
-            response->set_message("OHLC data received successfully");
-        }, "Error saving OHLC data to Redis.");
+    explicit OHLCConsumerServiceImpl(const ServerOptions& options)
+        : options(options), store(openStore()),
+          writes(options.writeBatch, options.writeDelay, [this](std::vector<PendingWrite> batch) {
+              saveBatch(std::move(batch));
+          }) {}
 
-        return grpc::Status::OK;
-    }
+    // Serves until the process is stopped.
+    void run() {
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort(options.address, grpc::InsecureServerCredentials());
+        builder.RegisterService(&service);
+        for (unsigned i = 0; i < options.completionQueues; ++i) {
+            queues.push_back(builder.AddCompletionQueue());
+        }
+        server = builder.BuildAndStart();
+        if (!server) {
+            throw OHLCWithRedisException("Failed to listen on " + options.address);
+        }
+        std::cout << "Server listening on " << options.address << " with " << options.completionQueues
+                  << " completion queue threads, keeping candles in " << store->describe() << std::endl;
 
-    grpc::Status GetOHLC(grpc::ServerContext* context, const ohlc::StockRequest* request, ohlc::OHLC* response) override {
-        ExceptionHandler<OHLCWithRedisException>::Handle([&]() {
-            retrieveOHLCDataFromRedis(request->stock_code(), response);
-        }, "Error retrieving OHLC data from Redis.");
+        if (options.cache) {
+            warmCache();
+        }
 
-        return grpc::Status::OK;
+        std::vector<std::thread> threads;
+        if (!options.shmName.empty()) {
+            ring = ShmRing::create(options.shmName, options.shmSlots);
+            threads.emplace_back([this]() { consumeRing(); });
+            std::cout << "Reading candles from shared memory " << options.shmName << " (" << ring->capacity() << " slots)" << std::endl;
+        }
+        for (std::unique_ptr<grpc::ServerCompletionQueue>& queue : queues) {
+            threads.emplace_back([this, &queue]() { serve(*queue); });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
     }
 
 private:
-    RedisConnection redisConnection{"localhost", 6379};
+    using AsyncService = ohlc::OHLCConsumerService::WithAsyncMethod_SendOHLC<
+        ohlc::OHLCConsumerService::WithAsyncMethod_GetOHLC<
+        ohlc::OHLCConsumerService::WithAsyncMethod_GetOHLCBatch<
+        ohlc::OHLCConsumerService::WithAsyncMethod_SendOHLCStream<
+        ohlc::OHLCConsumerService::WithAsyncMethod_SendOHLCFixedStream<
+        ohlc::OHLCConsumerService::WithAsyncMethod_SendOHLCColumns<
+        ohlc::OHLCConsumerService::WithAsyncMethod_GetOHLCRange<
+        ohlc::OHLCConsumerService::WithRawMethod_SubscribeOHLC<ohlc::OHLCConsumerService::Service>>>>>>>>;
 
-    void saveOHLCDataToRedis(const ohlc::OHLC* ohlcData) {
-        std::string formattedData = serializeOHLCData(ohlcData);
+    // One RPC on a completion queue. The call is its own tag: every event for
+    // it comes back to proceed, and it deletes itself once finished.
+    class Call {
+    public:
+        virtual ~Call() = default;
+        virtual void proceed(bool ok) = 0;
+    };
 
-        // Save OHLC data to Redis using SET
-        redisReply* reply = static_cast<redisReply*>(redisCommand(redisConnection.get(), "SET %s %s", ohlcData->stock_code().c_str(), formattedData.c_str()));
+    class SendOHLCCall final : public Call {
+    public:
+        SendOHLCCall(OHLCConsumerServiceImpl& owner, grpc::ServerCompletionQueue& queue)
+            : owner(owner), queue(queue), responder(&context) {
+            owner.service.RequestSendOHLC(&context, &request, &responder, &queue, &queue, this);
+        }
 
-        if (reply == nullptr || reply->type == REDIS_REPLY_ERROR) {
-            throw OHLCWithRedisException("Failed to save OHLC data to Redis: " + (reply ? std::string(reply->str) : "NULL"));
-        } else {
-            std::cout << "Saved OHLC data for stock: " << ohlcData->stock_code() << std::endl;
+        void proceed(bool ok) override {
+            if (finishing || !ok) {
+                delete this;
+                return;
+            }
+            new SendOHLCCall(owner, queue);
+            finishing = true;
+            owner.writes.add({&request, [this](const grpc::Status& status) {
+                if (status.ok()) {
+                    response.set_message("OHLC data received successfully");
+                }
+                responder.Finish(response, status, this);
+            }});
+        }
+
+    private:
+        OHLCConsumerServiceImpl& owner;
+        grpc::ServerCompletionQueue& queue;
+        grpc::ServerContext context;
+        ohlc::OHLC request;
+        ohlc::SendOHLCResponse response;
+        grpc::ServerAsyncResponseWriter<ohlc::SendOHLCResponse> responder;
+        bool finishing = false;
+    };
+
+    // Decodes each message into version 1 candles as it arrives and hands
+    // them to the store --write-batch candles at a time, so a long stream
+    // neither piles up in memory nor waits for its end to be saved. The
+    // store applies the chunks in order; the call is acknowledged once the
+    // stream has ended and every chunk has been answered, with the first
+    // error if any. Upload names the RPC and decodes its messages; one
+    // instance lives as long as the call, so it can keep per-call state such
+    // as a symbol table. A message that does not decode fails the call, and
+    // nothing after it is saved.
+    template <typename Upload>
+    class UploadCall final : public Call {
+    public:
+        UploadCall(OHLCConsumerServiceImpl& owner, grpc::ServerCompletionQueue& queue)
+            : owner(owner), queue(queue), reader(&context) {
+            Upload::request(owner.service, &context, &reader, &queue, this);
+        }
+
+        void proceed(bool ok) override {
+            switch (state) {
+                case State::Listening:
+                    if (!ok) {
+                        delete this;
+                        return;
+                    }
+                    new UploadCall(owner, queue);
+                    state = State::Reading;
+                    reader.Read(&message, this);
+                    return;
+                case State::Reading:
+                    if (ok) {
+                        if (decodeStatus.ok()) {
+                            decodeStatus = upload.decode(message, candles);
+                            if (decodeStatus.ok() && candles.size() >= owner.options.writeBatch) {
+                                saveCandles();
+                            }
+                        }
+                        reader.Read(&message, this);
+                        return;
+                    }
+                    state = State::Finishing;
+                    if (decodeStatus.ok() && !candles.empty()) {
+                        saveCandles();
+                    }
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        streamEnded = true;
+                        if (savesInFlight > 0) {
+                            return;
+                        }
+                    }
+                    finish();
+                    return;
+                case State::Finishing:
+                    delete this;
+                    return;
+            }
+        }
+
+    private:
+        enum class State { Listening, Reading, Finishing };
+
+        // Hands the candles decoded so far to the store; they stay alive
+        // until it answers.
+        void saveCandles() {
+            auto chunk = std::make_shared<std::vector<ohlc::OHLC>>(std::move(candles));
+            candles.clear();
+            received += chunk->size();
+            std::vector<const ohlc::OHLC*> batch;
+            batch.reserve(chunk->size());
+            for (const ohlc::OHLC& candle : *chunk) {
+                batch.push_back(&candle);
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++savesInFlight;
+            }
+            owner.saveOHLCBatch(batch, "Error saving streamed OHLC data.", [this, chunk](const grpc::Status& status) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (saveStatus.ok() && !status.ok()) {
+                        saveStatus = status;
+                    }
+                    if (--savesInFlight > 0 || !streamEnded) {
+                        return;
+                    }
+                }
+                finish();
+            });
+        }
+
+        void finish() {
+            grpc::Status status = !saveStatus.ok() ? saveStatus : decodeStatus;
+            if (status.ok()) {
+                response.set_message("Received " + std::to_string(received) + " candles");
+            }
+            reader.Finish(response, status, this);
+        }
+
+        OHLCConsumerServiceImpl& owner;
+        grpc::ServerCompletionQueue& queue;
+        grpc::ServerContext context;
+        typename Upload::Message message;
+        Upload upload;
+        grpc::Status decodeStatus;
+        std::vector<ohlc::OHLC> candles;
+        size_t received = 0;
+        std::mutex mutex;
+        size_t savesInFlight = 0;
+        bool streamEnded = false;
+        grpc::Status saveStatus;
+        ohlc::SendOHLCResponse response;
+        grpc::ServerAsyncReader<ohlc::SendOHLCResponse, typename Upload::Message> reader;
+        State state = State::Listening;
+    };
+
+    template <typename Message>
+    using UploadReader = grpc::ServerAsyncReader<ohlc::SendOHLCResponse, Message>;
+
+    // SendOHLCStream: version 1 candles as they are.
+    struct CandleUpload {
+        using Message = ohlc::OHLC;
+
+        static void request(AsyncService& service, grpc::ServerContext* context, UploadReader<Message>* reader,
+                            grpc::ServerCompletionQueue* queue, void* tag) {
+            service.RequestSendOHLCStream(context, reader, queue, queue, tag);
+        }
+
+        grpc::Status decode(Message& candle, std::vector<ohlc::OHLC>& candles) {
+            candles.push_back(std::move(candle));
+            return grpc::Status::OK;
+        }
+    };
+
+    // SendOHLCFixedStream: a candle with a stock_code names its symbol_id
+    // for the rest of the call; one with only a symbol_id uses that name.
+    struct FixedUpload {
+        using Message = ohlc::OHLCFixed;
+
+        static void request(AsyncService& service, grpc::ServerContext* context, UploadReader<Message>* reader,
+                            grpc::ServerCompletionQueue* queue, void* tag) {
+            service.RequestSendOHLCFixedStream(context, reader, queue, queue, tag);
+        }
+
+        grpc::Status decode(Message& candle, std::vector<ohlc::OHLC>& candles) {
+            if (candle.price_scale() > maxPriceScale) {
+                return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "price_scale above " + std::to_string(maxPriceScale));
+            }
+            if (!candle.stock_code().empty()) {
+                if (candle.symbol_id() != 0) {
+                    symbolNames[candle.symbol_id()] = candle.stock_code();
+                }
+                readOHLCFixed(candle, candle.stock_code(), candles.emplace_back());
+                return grpc::Status::OK;
+            }
+            auto name = symbolNames.find(candle.symbol_id());
+            if (name == symbolNames.end()) {
+                return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "Unnamed symbol_id " + std::to_string(candle.symbol_id()));
+            }
+            readOHLCFixed(candle, name->second, candles.emplace_back());
+            return grpc::Status::OK;
+        }
+
+        std::unordered_map<uint32_t, std::string> symbolNames;
+    };
+
+    // SendOHLCColumns: every batch adds its symbol_names to the call's table
+    // before its rows are read.
+    struct ColumnsUpload {
+        using Message = ohlc::OHLCColumns;
+
+        static void request(AsyncService& service, grpc::ServerContext* context, UploadReader<Message>* reader,
+                            grpc::ServerCompletionQueue* queue, void* tag) {
+            service.RequestSendOHLCColumns(context, reader, queue, queue, tag);
+        }
+
+        grpc::Status decode(Message& batch, std::vector<ohlc::OHLC>& candles) {
+            if (batch.price_scale() > maxPriceScale) {
+                return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "price_scale above " + std::to_string(maxPriceScale));
+            }
+            if (!hasEqualColumns(batch)) {
+                return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "OHLCColumns columns differ in length");
+            }
+            for (const auto& [id, name] : batch.symbol_names()) {
+                symbolNames[id] = name;
+            }
+            for (int row = 0; row < batch.symbol_ids_size(); ++row) {
+                auto name = symbolNames.find(batch.symbol_ids(row));
+                if (name == symbolNames.end()) {
+                    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "Unnamed symbol_id " + std::to_string(batch.symbol_ids(row)));
+                }
+                readOHLCColumns(batch, row, name->second, candles.emplace_back());
+            }
+            return grpc::Status::OK;
+        }
+
+        std::unordered_map<uint32_t, std::string> symbolNames;
+    };
+
+    // From the cache when the symbol is in it, otherwise from the store.
+    class GetOHLCCall final : public Call {
+    public:
+        GetOHLCCall(OHLCConsumerServiceImpl& owner, grpc::ServerCompletionQueue& queue)
+            : owner(owner), queue(queue), responder(&context) {
+            owner.service.RequestGetOHLC(&context, &request, &responder, &queue, &queue, this);
+        }
+
+        void proceed(bool ok) override {
+            if (finishing || !ok) {
+                delete this;
+                return;
+            }
+            new GetOHLCCall(owner, queue);
+            finishing = true;
+            if (owner.options.cache && owner.cache.get(request.stock_code(), response)) {
+                if (!owner.options.quiet) {
+                    std::cout << "Retrieved OHLC data for stock: " << request.stock_code() << " from cache" << std::endl;
+                }
+                responder.Finish(response, grpc::Status::OK, this);
+                return;
+            }
+            owner.retrieveOHLCData(request.stock_code(), &response, [this](const grpc::Status& status) {
+                responder.Finish(response, status, this);
+            });
+        }
+
+    private:
+        OHLCConsumerServiceImpl& owner;
+        grpc::ServerCompletionQueue& queue;
+        grpc::ServerContext context;
+        ohlc::StockRequest request;
+        ohlc::OHLC response;
+        grpc::ServerAsyncResponseWriter<ohlc::OHLC> responder;
+        bool finishing = false;
+    };
+
+    // From the cache when every requested symbol is in it, otherwise with
+    // one read of the store.
+    class GetOHLCBatchCall final : public Call {
+    public:
+        GetOHLCBatchCall(OHLCConsumerServiceImpl& owner, grpc::ServerCompletionQueue& queue)
+            : owner(owner), queue(queue), responder(&context) {
+            owner.service.RequestGetOHLCBatch(&context, &request, &responder, &queue, &queue, this);
+        }
+
+        void proceed(bool ok) override {
+            if (finishing || !ok) {
+                delete this;
+                return;
+            }
+            new GetOHLCBatchCall(owner, queue);
+            finishing = true;
+            if (owner.options.cache && owner.retrieveOHLCBatchFromCache(request, &response)) {
+                responder.Finish(response, grpc::Status::OK, this);
+                return;
+            }
+            owner.retrieveOHLCBatch(request, &response, [this](const grpc::Status& status) {
+                responder.Finish(response, status, this);
+            });
+        }
+
+    private:
+        OHLCConsumerServiceImpl& owner;
+        grpc::ServerCompletionQueue& queue;
+        grpc::ServerContext context;
+        ohlc::StockBatchRequest request;
+        ohlc::OHLCBatch response;
+        grpc::ServerAsyncResponseWriter<ohlc::OHLCBatch> responder;
+        bool finishing = false;
+    };
+
+    // Streams a range of a symbol's history a page at a time. Each page is
+    // written from wherever the store reports it read; the next page is read
+    // once that write completes, so a call holds one page however long its
+    // range. A page shorter than the page size is the last one and is sent
+    // together with the final status.
+    class GetOHLCRangeCall final : public Call {
+    public:
+        static constexpr uint32_t defaultPageSize = 5000;
+        static constexpr uint32_t maxPageSize = 20000;
+
+        GetOHLCRangeCall(OHLCConsumerServiceImpl& owner, grpc::ServerCompletionQueue& queue)
+            : owner(owner), queue(queue), writer(&context) {
+            owner.service.RequestGetOHLCRange(&context, &request, &writer, &queue, &queue, this);
+        }
+
+        void proceed(bool ok) override {
+            switch (state) {
+                case State::Listening:
+                    if (!ok) {
+                        delete this;
+                        return;
+                    }
+                    new GetOHLCRangeCall(owner, queue);
+                    if (request.stock_code().empty() || !isHistoryInterval(request.interval())) {
+                        state = State::Finishing;
+                        writer.Finish(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                                   "GetOHLCRange needs a stock_code and an interval of whole milliseconds"), this);
+                        return;
+                    }
+                    pageSize = request.page_size() == 0 ? defaultPageSize : std::min(request.page_size(), maxPageSize);
+                    fromMilliseconds = startMillisecondsFrom(request.from_time());
+                    toMilliseconds = request.to_time() == 0 ? HistoryQuery::unbounded : startMillisecondsFrom(request.to_time());
+                    readPage();
+                    return;
+                case State::Writing:
+                    if (!ok) {
+                        delete this;
+                        return;
+                    }
+                    readPage();
+                    return;
+                case State::Finishing:
+                    delete this;
+                    return;
+            }
         }
 
-        freeReplyObject(reply);
+    private:
+        enum class State { Listening, Writing, Finishing };
+
+        void readPage() {
+            page.Clear();
+            owner.retrieveOHLCRange(request, fromMilliseconds, toMilliseconds, pageSize, &page, [this](const grpc::Status& status) {
+                if (!status.ok() || page.candles_size() == 0) {
+                    state = State::Finishing;
+                    writer.Finish(status, this);
+                    return;
+                }
+                if (static_cast<uint32_t>(page.candles_size()) < pageSize) {
+                    state = State::Finishing;
+                    writer.WriteAndFinish(page, grpc::WriteOptions(), grpc::Status::OK, this);
+                    return;
+                }
+                fromMilliseconds = page.candles(page.candles_size() - 1).start_time() / nanosecondsPerMillisecond + 1;
+                state = State::Writing;
+                writer.Write(page, this);
+            });
+        }
+
+        OHLCConsumerServiceImpl& owner;
+        grpc::ServerCompletionQueue& queue;
+        grpc::ServerContext context;
+        ohlc::OHLCRangeRequest request;
+        ohlc::OHLCPage page;
+        grpc::ServerAsyncWriter<ohlc::OHLCPage> writer;
+        State state = State::Listening;
+        uint32_t pageSize = defaultPageSize;
+        uint64_t fromMilliseconds = 0;
+        uint64_t toMilliseconds = HistoryQuery::unbounded;
+    };
+
+    // A candle serialized once and shared by every subscriber it goes to.
+    using CandleUpdate = std::shared_ptr<const grpc::ByteBuffer>;
+
+    // Streams stored candles to one subscriber. SubscribeOHLC is registered
+    // raw, so each write sends the shared, already serialized bytes. Pending
+    // updates wait in one slot per symbol where the newest replaces an
+    // unsent one: a slow reader costs at most one buffered candle per symbol
+    // and never holds up the thread that publishes. One Write is in
+    // flight at a time, as gRPC requires; the next starts from its
+    // completion, or from push when the stream was idle. The call is deleted
+    // once gRPC reports it done and no operation of its own is pending.
+    class SubscribeOHLCCall final : public Call, public Subscriber<CandleUpdate> {
+    public:
+        SubscribeOHLCCall(OHLCConsumerServiceImpl& owner, grpc::ServerCompletionQueue& queue)
+            : owner(owner), queue(queue), writer(&context), done(*this) {
+            context.AsyncNotifyWhenDone(&done);
+            owner.service.RequestSubscribeOHLC(&context, &request, &writer, &queue, &queue, this);
+        }
+
+        void push(const std::string& symbol, const CandleUpdate& update) override {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (closed) {
+                return;
+            }
+            auto [slot, added] = pending.try_emplace(symbol, update);
+            if (!added) {
+                slot->second = update;
+                ++conflated;
+                return;
+            }
+            order.push_back(symbol);
+            if (!writing) {
+                writeNext();
+            }
+        }
+
+        void proceed(bool ok) override {
+            if (state == State::Listening) {
+                if (!ok) {
+                    delete this;
+                    return;
+                }
+                new SubscribeOHLCCall(owner, queue);
+                ohlc::SubscribeRequest subscribeRequest;
+                if (!grpc::SerializationTraits<ohlc::SubscribeRequest>::Deserialize(&request, &subscribeRequest).ok()) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    state = State::Finishing;
+                    writing = true;
+                    writer.Finish(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "Malformed SubscribeRequest"), this);
+                    return;
+                }
+                symbols.assign(subscribeRequest.stock_codes().begin(), subscribeRequest.stock_codes().end());
+                state = State::Streaming;
+                owner.subscriptions.subscribe(this, symbols);
+                std::cout << "Subscriber joined for " << (symbols.empty() ? "every symbol" : std::to_string(symbols.size()) + " symbols") << std::endl;
+                return;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            writing = false;
+            if (!ok) {
+                closed = true;
+            } else if (state == State::Streaming && !closed && !order.empty()) {
+                writeNext();
+            }
+            if (finished && !writing) {
+                lock.unlock();
+                delete this;
+            }
+        }
+
+    private:
+        enum class State { Listening, Streaming, Finishing };
+
+        // The done tag: the client went away or the call was finished.
+        class Done final : public Call {
+        public:
+            explicit Done(SubscribeOHLCCall& call) : call(call) {}
+
+            void proceed(bool) override {
+                call.onDone();
+            }
+
+        private:
+            SubscribeOHLCCall& call;
+        };
+
+        void onDone() {
+            if (state == State::Streaming) {
+                owner.subscriptions.unsubscribe(this);
+                std::cout << "Subscriber left after " << sent << " candles, " << conflated << " replaced before sending" << std::endl;
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            closed = true;
+            finished = true;
+            if (!writing) {
+                lock.unlock();
+                delete this;
+            }
+        }
+
+        // Called with mutex held and no write in flight.
+        void writeNext() {
+            std::string symbol = std::move(order.front());
+            order.pop_front();
+            auto slot = pending.find(symbol);
+            CandleUpdate update = std::move(slot->second);
+            pending.erase(slot);
+            writing = true;
+            ++sent;
+            writer.Write(*update, this);
+        }
+
+        OHLCConsumerServiceImpl& owner;
+        grpc::ServerCompletionQueue& queue;
+        grpc::ServerContext context;
+        grpc::ByteBuffer request;
+        grpc::ServerAsyncWriter<grpc::ByteBuffer> writer;
+        Done done;
+        State state = State::Listening;
+        std::vector<std::string> symbols;
+
+        std::mutex mutex;
+        std::unordered_map<std::string, CandleUpdate> pending;
+        std::deque<std::string> order;
+        bool writing = false;
+        bool closed = false;
+        bool finished = false;
+        size_t sent = 0;
+        size_t conflated = 0;
+    };
+
+    void serve(grpc::ServerCompletionQueue& queue) {
+        new SendOHLCCall(*this, queue);
+        new UploadCall<CandleUpload>(*this, queue);
+        new UploadCall<FixedUpload>(*this, queue);
+        new UploadCall<ColumnsUpload>(*this, queue);
+        new GetOHLCCall(*this, queue);
+        new GetOHLCBatchCall(*this, queue);
+        new GetOHLCRangeCall(*this, queue);
+        new SubscribeOHLCCall(*this, queue);
+
+        void* tag = nullptr;
+        bool ok = false;
+        while (queue.Next(&tag, &ok)) {
+            static_cast<Call*>(tag)->proceed(ok);
+        }
     }
 
-    void retrieveOHLCDataFromRedis(const std::string& stockCode, ohlc::OHLC* response) {
-        // Retrieve OHLC data from Redis using GET
-        redisReply* reply = static_cast<redisReply*>(redisCommand(redisConnection.get(), "GET %s", stockCode.c_str()));
+    // The SendOHLC path for a producer on the same host: candles come out of
+    // the shared memory ring instead of gRPC and are saved and published the
+    // same way. One thread saves them in ring order, waiting for each batch
+    // to be stored before reading the next, so a symbol's deltas reach the
+    // store in sequence. Whatever is in the ring, up to --write-batch
+    // candles, goes out as one batch; a batch that fails to save is logged
+    // and dropped, as there is no caller to return an error to.
+    void consumeRing() {
+        ShmCandle slot;
+        std::vector<ohlc::OHLC> candles(options.writeBatch);
+        std::vector<const ohlc::OHLC*> batch;
+        ShmBackoff backoff;
+        while (true) {
+            batch.clear();
+            while (batch.size() < candles.size() && ring->tryRead(slot)) {
+                readShmCandle(slot, candles[batch.size()]);
+                batch.push_back(&candles[batch.size()]);
+            }
+            if (batch.empty()) {
+                backoff.wait();
+                continue;
+            }
+            backoff.reset();
+            try {
+                ExceptionHandler<OHLCWithRedisException>::Handle([&]() {
+                    std::vector<StoredCandleBytes> values;
+                    std::vector<LatestWrite> latest;
+                    std::vector<HistoryWrite> history;
+                    std::shared_ptr<const CandleSave> save = prepareCandleSave(batch, values, latest, history);
+                    StoreResult result = writeAndWait(*store, latest, history);
+                    if (!result.ok()) {
+                        candlesFailed(*save);
+                        throw OHLCWithRedisException(result.message);
+                    }
+                    candlesSaved(*save);
+                }, "Error saving OHLC data from shared memory.");
+            } catch (const OHLCWithRedisException& e) {
+                std::cerr << e.what() << std::endl;
+            }
+        }
+    }
 
-        if (reply != nullptr && reply->type == REDIS_REPLY_STRING) {
-            deserializeOHLCData(reply->str, response);
-            std::cout << "Retrieved OHLC data for stock: " << stockCode << std::endl;
-        } else {
-            std::cerr << "OHLC data not found for stock: " << stockCode << std::endl;
+    // A SendOHLC waiting in the write batcher. done finishes the call with the
+    // status of the batch it was saved in.
+    struct PendingWrite {
+        const ohlc::OHLC* candle;
+        std::function<void(const grpc::Status&)> done;
+    };
+
+    // Saves a batch closed by the write batcher with one write to the store,
+    // then finishes every call in it with the batch's status.
+    void saveBatch(std::vector<PendingWrite> batch) {
+        auto writes = std::make_shared<std::vector<PendingWrite>>(std::move(batch));
+        std::vector<const ohlc::OHLC*> candles;
+        candles.reserve(writes->size());
+        for (const PendingWrite& write : *writes) {
+            candles.push_back(write.candle);
         }
+        saveOHLCBatch(candles, "Error saving OHLC data.", [writes](const grpc::Status& status) {
+            for (const PendingWrite& write : *writes) {
+                write.done(status);
+            }
+        });
+    }
 
-        freeReplyObject(reply);
+    // The candle log at --store-path with up to --redis-queue writes waiting
+    // for its writer thread, or Redis on localhost with one read event loop
+    // per --redis-threads sharing --redis-queue between them and a write loop
+    // with --redis-queue of its own.
+    std::unique_ptr<CandleStore> openStore() const {
+        if (options.store == "log") {
+            return std::make_unique<LogCandleStore>(options.storePath, options.maxQueuedJobs);
+        }
+        return std::make_unique<RedisCandleStore>("localhost", 6379, options.redisThreads, options.maxQueuedJobs, options.redisTimeout,
+                                                  options.redisHealthCheck, options.writeBatch);
     }
 
-    std::string serializeOHLCData(const ohlc::OHLC* ohlcData) {
-        std::ostringstream oss;
-        oss << ohlcData->stock_code() << "," << ohlcData->open() << "," << ohlcData->high() << ","
-            << ohlcData->low() << "," << ohlcData->close() << "," << ohlcData->volume() << ","
-            << ohlcData->value();
-        return oss.str();
+    // The status a call finishes with once the store reports back: OK, or
+    // RESOURCE_EXHAUSTED or UNAVAILABLE when the store is busy or cannot be
+    // reached, which clients may retry. Anything else is logged and reported
+    // as INTERNAL with errorMessage.
+    static grpc::Status toStatus(const StoreResult& result, const std::string& errorMessage) {
+        switch (result.code) {
+            case StoreResult::Code::Ok:
+                return grpc::Status::OK;
+            case StoreResult::Code::Busy:
+                return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, result.message);
+            case StoreResult::Code::Unavailable:
+                return grpc::Status(grpc::StatusCode::UNAVAILABLE, result.message);
+            case StoreResult::Code::Failed:
+                break;
+        }
+        std::cerr << "Exception: " << result.message << std::endl;
+        return grpc::Status(grpc::StatusCode::INTERNAL, errorMessage);
     }
 
-    void deserializeOHLCData(const std::string& serializedData, ohlc::OHLC* response) {
-        std::istringstream iss(serializedData);
-        std::string token;
+    // Hands a stored candle to its subscribers, serialized once however many
+    // there are. Runs on the thread that saw it saved.
+    void publishCandle(const ohlc::OHLC& candle) {
+        if (!subscriptions.hasSubscribers(candle.stock_code())) {
+            return;
+        }
+        auto buffer = std::make_shared<grpc::ByteBuffer>();
+        bool ownBuffer = false;
+        if (grpc::SerializationTraits<ohlc::OHLC>::Serialize(candle, buffer.get(), &ownBuffer).ok()) {
+            subscriptions.publish(candle.stock_code(), buffer);
+        }
+    }
 
-        std::getline(iss, token, ',');
-        response->set_stock_code(token);
+    ServerOptions options;
+    AsyncService service;
+    SubscriptionHub<CandleUpdate> subscriptions;
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> queues;
+    std::unique_ptr<grpc::Server> server;
+    SequenceTracker sequences;
+    CandleCache cache;
+    std::unique_ptr<CandleStore> store;
+    std::unique_ptr<ShmRing> ring;
+    WriteBatcher<PendingWrite> writes;
 
-        std::getline(iss, token, ',');
-        response->set_open(std::stod(token));
+    // A batch of candles judged for saving.
+    struct CandleSave {
+        std::vector<const ohlc::OHLC*> accepted;
+        std::vector<const ohlc::OHLC*> history;
+    };
 
-        std::getline(iss, token, ',');
-        response->set_high(std::stod(token));
+    // Saves candles in order with one write to the store however many the
+    // batch holds, then calls finish with the status toStatus gives. The
+    // candles must outlive the call to finish.
+    template <typename Finish>
+    void saveOHLCBatch(const std::vector<const ohlc::OHLC*>& candles, const std::string& errorMessage, Finish finish) {
+        std::vector<StoredCandleBytes> values;
+        std::vector<LatestWrite> latest;
+        std::vector<HistoryWrite> history;
+        std::shared_ptr<const CandleSave> save;
+        try {
+            ExceptionHandler<OHLCWithRedisException>::Handle([&]() { save = prepareCandleSave(candles, values, latest, history); }, errorMessage);
+        } catch (const OHLCWithRedisException& e) {
+            finish(grpc::Status(grpc::StatusCode::INTERNAL, e.what()));
+            return;
+        }
+        store->write(latest, history, [this, save, errorMessage, finish](const StoreResult& result) {
+            if (result.ok()) {
+                candlesSaved(*save);
+            } else {
+                candlesFailed(*save);
+            }
+            finish(toStatus(result, errorMessage));
+        });
+    }
+
+    // Judges candles and encodes the ones to save into values, which latest
+    // and history then point into: the running candles, and the closed
+    // interval candles each replacing any with the same start in their
+    // history. Repeated deltas are left out, judged against the candles
+    // before them in this batch and those still on their way to the store as
+    // well as those already saved; a symbol that appears twice ends up with
+    // its later candle, as the store keeps latest in order. The accepted
+    // candles stay pending with sequences until candlesSaved or
+    // candlesFailed.
+    std::shared_ptr<const CandleSave> prepareCandleSave(const std::vector<const ohlc::OHLC*>& candles, std::vector<StoredCandleBytes>& values,
+                                                        std::vector<LatestWrite>& latest, std::vector<HistoryWrite>& history) {
+        auto save = std::make_shared<CandleSave>();
+        std::vector<const ohlc::OHLC*>& accepted = save->accepted;
+        for (const ohlc::OHLC* ohlcData : candles) {
+            if (ohlcData->interval() != 0) {
+                if (!isHistoryInterval(ohlcData->interval()) || ohlcData->start_time() % ohlcData->interval() != 0) {
+                    std::cerr << "Skipped OHLC candle for stock: " << ohlcData->stock_code() << " (interval " << ohlcData->interval()
+                              << " ns, start " << ohlcData->start_time() << " ns is not a whole-millisecond bucket)" << std::endl;
+                    continue;
+                }
+                save->history.push_back(ohlcData);
+                continue;
+            }
+            uint64_t lastSequence = 0;
+            SequenceTracker::Verdict verdict = sequences.check(ohlcData->stock_code(), ohlcData->sequence(), lastSequence);
+            if (verdict == SequenceTracker::Verdict::Repeat) {
+                if (!options.quiet) {
+                    std::cout << "Skipped repeated OHLC data for stock: " << ohlcData->stock_code() << " (sequence "
+                              << ohlcData->sequence() << ", last " << lastSequence << ")" << std::endl;
+                }
+                continue;
+            }
+            if (verdict == SequenceTracker::Verdict::Gap) {
+                std::cerr << "Missed " << ohlcData->sequence() - lastSequence - 1 << " OHLC deltas for stock: "
+                          << ohlcData->stock_code() << " (sequence " << ohlcData->sequence() << ", last " << lastSequence << ")" << std::endl;
+            }
+            accepted.push_back(ohlcData);
+        }
+
+        // Everything is encoded before the first write is listed, so a
+        // candle that cannot be stored leaves nothing half built.
+        values.resize(accepted.size() + save->history.size());
+        try {
+            for (size_t i = 0; i < accepted.size(); ++i) {
+                encodeStoredCandle(*accepted[i], values[i]);
+            }
+            for (size_t i = 0; i < save->history.size(); ++i) {
+                encodeStoredCandle(*save->history[i], values[accepted.size() + i]);
+            }
+        } catch (...) {
+            candlesFailed(*save);
+            throw;
+        }
+
+        latest.reserve(accepted.size());
+        for (size_t i = 0; i < accepted.size(); ++i) {
+            latest.push_back(LatestWrite{accepted[i]->stock_code(), std::string_view(values[i].data, values[i].size)});
+        }
+        history.reserve(save->history.size());
+        for (size_t i = 0; i < save->history.size(); ++i) {
+            const ohlc::OHLC& candle = *save->history[i];
+            const StoredCandleBytes& value = values[accepted.size() + i];
+            history.push_back(HistoryWrite{candle.stock_code(), candle.interval(), candle.start_time() / nanosecondsPerMillisecond,
+                                           std::string_view(value.data, value.size)});
+        }
+        return save;
+    }
 
-        std::getline(iss, token, ',');
-        response->set_low(std::stod(token));
+    // Sequence numbers are recorded, and running candles cached and
+    // published, only once the whole batch is stored.
+    void candlesSaved(const CandleSave& save) {
+        for (const ohlc::OHLC* ohlcData : save.accepted) {
+            if (!options.quiet) {
+                std::cout << "Saved OHLC data for stock: " << ohlcData->stock_code() << std::endl;
+            }
+            sequences.saved(ohlcData->stock_code(), ohlcData->sequence());
+            if (options.cache) {
+                cache.put(*ohlcData);
+            }
+            publishCandle(*ohlcData);
+        }
+        if (!options.quiet && !save.history.empty()) {
+            std::cout << "Saved " << save.history.size() << " interval candles to history" << std::endl;
+        }
+    }
 
-        std::getline(iss, token, ',');
-        response->set_close(std::stod(token));
+    // Lets the candles of a batch that was not stored be sent again.
+    void candlesFailed(const CandleSave& save) {
+        for (const ohlc::OHLC* ohlcData : save.accepted) {
+            sequences.failed(ohlcData->stock_code(), ohlcData->sequence());
+        }
+    }
 
-        std::getline(iss, token, ',');
-        response->set_volume(std::stod(token));
+    // The stored candle of one symbol. stockCode and response must outlive
+    // the call to finish, as must the request and response of the other
+    // retrieves.
+    template <typename Finish>
+    void retrieveOHLCData(const std::string& stockCode, ohlc::OHLC* response, Finish finish) {
+        auto found = std::make_shared<bool>(false);
+        store->readLatest({stockCode}, [this, &stockCode, response, found](size_t, std::string_view value) {
+            readStoredCandle(value, stockCode, response);
+            *found = true;
+            if (options.cache) {
+                cache.putIfAbsent(*response);
+            }
+        }, [this, &stockCode, found, finish](const StoreResult& result) {
+            if (result.ok() && !options.quiet) {
+                if (*found) {
+                    std::cout << "Retrieved OHLC data for stock: " << stockCode << std::endl;
+                } else {
+                    std::cerr << "OHLC data not found for stock: " << stockCode << std::endl;
+                }
+            }
+            finish(toStatus(result, "Error retrieving OHLC data."));
+        });
+    }
 
-        std::getline(iss, token, ',');
-        response->set_value(std::stod(token));
+    // Every requested symbol in one read. Found candles go into the response
+    // in request order, the rest into missing_codes.
+    template <typename Finish>
+    void retrieveOHLCBatch(const ohlc::StockBatchRequest& request, ohlc::OHLCBatch* response, Finish finish) {
+        std::vector<std::string_view> stockCodes(request.stock_codes().begin(), request.stock_codes().end());
+        auto found = std::make_shared<std::vector<bool>>(stockCodes.size());
+        store->readLatest(stockCodes, [this, &request, response, found](size_t index, std::string_view value) {
+            ohlc::OHLC* candle = response->add_candles();
+            readStoredCandle(value, request.stock_codes(static_cast<int>(index)), candle);
+            (*found)[index] = true;
+            if (options.cache) {
+                cache.putIfAbsent(*candle);
+            }
+        }, [this, &request, response, found, finish](const StoreResult& result) {
+            if (result.ok()) {
+                for (size_t i = 0; i < found->size(); ++i) {
+                    if (!(*found)[i]) {
+                        response->add_missing_codes(request.stock_codes(static_cast<int>(i)));
+                    }
+                }
+                if (!options.quiet) {
+                    std::cout << "Retrieved OHLC data for " << response->candles_size() << " of " << request.stock_codes_size() << " stocks" << std::endl;
+                }
+            }
+            finish(toStatus(result, "Error retrieving OHLC batch."));
+        });
+    }
+
+    // Fills response from the cache alone; false, with response left empty,
+    // unless every requested symbol is cached.
+    bool retrieveOHLCBatchFromCache(const ohlc::StockBatchRequest& request, ohlc::OHLCBatch* response) {
+        for (const std::string& stockCode : request.stock_codes()) {
+            if (!cache.get(stockCode, *response->add_candles())) {
+                response->Clear();
+                return false;
+            }
+        }
+        if (!options.quiet) {
+            std::cout << "Retrieved OHLC data for " << request.stock_codes_size() << " stocks from cache" << std::endl;
+        }
+        return true;
+    }
+
+    // Fills the cache with every running candle in the store before the
+    // server starts answering. Values that are not candles of the symbol
+    // they are kept under are skipped. When the store cannot be read the
+    // server starts with an empty cache, which fills as candles are saved
+    // and read.
+    void warmCache() {
+        try {
+            ExceptionHandler<OHLCWithRedisException>::Handle([&]() {
+                ohlc::OHLC candle;
+                store->scanLatest([&](std::string_view stockCode, std::string_view value) {
+                    if (decodeStoredCandle(value.data(), value.size(), &candle) && candle.stock_code() == stockCode) {
+                        cache.putIfAbsent(candle);
+                    }
+                });
+            }, "Error warming the candle cache.");
+            std::cout << "Cached " << cache.size() << " candles from " << store->describe() << std::endl;
+        } catch (const OHLCWithRedisException& e) {
+            std::cerr << e.what() << std::endl;
+        }
+    }
+
+    // One page of a symbol's history: up to pageSize candles starting from
+    // fromMilliseconds up to but not including toMilliseconds, in start
+    // order.
+    template <typename Finish>
+    void retrieveOHLCRange(const ohlc::OHLCRangeRequest& request, uint64_t fromMilliseconds, uint64_t toMilliseconds,
+                           uint32_t pageSize, ohlc::OHLCPage* page, Finish finish) {
+        const HistoryQuery query{request.stock_code(), request.interval(), fromMilliseconds, toMilliseconds, pageSize};
+        store->readHistory(query, [&request, page](size_t, std::string_view value) {
+            readStoredCandle(value, request.stock_code(), page->add_candles());
+        }, [this, &request, page, finish](const StoreResult& result) {
+            if (result.ok() && !options.quiet) {
+                std::cout << "Retrieved " << page->candles_size() << " " << formatInterval(request.interval()) << " candles for stock: "
+                          << request.stock_code() << std::endl;
+            }
+            finish(toStatus(result, "Error retrieving OHLC range."));
+        });
+    }
+
+    static void readStoredCandle(std::string_view value, const std::string& stockCode, ohlc::OHLC* candle) {
+        if (!decodeStoredCandle(value.data(), value.size(), candle)) {
+            throw OHLCWithRedisException("Unreadable OHLC data stored for stock: " + stockCode);
+        }
     }
 };
 
-void runServer() {
-    std::string server_address("0.0.0.0:50051");
-    OHLCConsumerServiceImpl service;
+ServerOptions parseArguments(int argc, char** argv) {
+    const std::string usage = "Usage: " + std::string(argv[0]) + " [--cq-threads=N] [--redis-threads=N] [--redis-queue=N] [--redis-timeout=MS] [--redis-health-check=SECONDS] [--write-batch=N] [--write-delay-us=N] [--quiet] [--no-cache] [--shm[=NAME]] [--shm-slots=N] [--store=redis|log] [--store-path=FILE] [port]";
+    ServerOptions options;
 
-    grpc::ServerBuilder builder;
-    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-    builder.RegisterService(&service);
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg.rfind("--cq-threads=", 0) == 0) {
+            options.completionQueues = static_cast<unsigned>(std::stoul(std::string(arg.substr(13))));
+        } else if (arg.rfind("--redis-threads=", 0) == 0) {
+            options.redisThreads = static_cast<unsigned>(std::stoul(std::string(arg.substr(16))));
+        } else if (arg.rfind("--redis-queue=", 0) == 0) {
+            options.maxQueuedJobs = std::stoul(std::string(arg.substr(14)));
+        } else if (arg.rfind("--redis-timeout=", 0) == 0) {
+            options.redisTimeout = std::chrono::milliseconds(std::stoul(std::string(arg.substr(16))));
+        } else if (arg.rfind("--redis-health-check=", 0) == 0) {
+            options.redisHealthCheck = std::chrono::seconds(std::stoul(std::string(arg.substr(21))));
+        } else if (arg.rfind("--write-batch=", 0) == 0) {
+            options.writeBatch = std::stoul(std::string(arg.substr(14)));
+        } else if (arg.rfind("--write-delay-us=", 0) == 0) {
+            options.writeDelay = std::chrono::microseconds(std::stoul(std::string(arg.substr(17))));
+        } else if (arg == "--quiet") {
+            options.quiet = true;
+        } else if (arg == "--no-cache") {
+            options.cache = false;
+        } else if (arg == "--shm") {
+            options.shmName = defaultShmName;
+        } else if (arg.rfind("--shm=", 0) == 0) {
+            options.shmName = std::string(arg.substr(6));
+        } else if (arg.rfind("--shm-slots=", 0) == 0) {
+            options.shmSlots = std::stoul(std::string(arg.substr(12)));
+        } else if (arg.rfind("--store=", 0) == 0) {
+            options.store = std::string(arg.substr(8));
+        } else if (arg.rfind("--store-path=", 0) == 0) {
+            options.storePath = std::string(arg.substr(13));
+        } else if (arg.rfind("--", 0) == 0) {
+            throw std::invalid_argument(usage);
+        } else {
+            options.address = "0.0.0.0:" + std::to_string(std::stoi(std::string(arg)));
+        }
+    }
+    if (options.completionQueues == 0 || options.redisThreads == 0 || options.maxQueuedJobs == 0 || options.redisTimeout.count() == 0 || options.writeBatch == 0 ||
+        options.shmSlots == 0 || (options.shmSlots & (options.shmSlots - 1)) != 0 || (options.store != "redis" && options.store != "log") ||
+        options.storePath.empty()) {
+        throw std::invalid_argument(usage);
+    }
+    return options;
+}
 
-    std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
-    std::cout << "Server listening on " << server_address << std::endl;
-    server->Wait();
+void runServer(const ServerOptions& options) {
+    OHLCConsumerServiceImpl service(options);
+    service.run();
 }
 
-int main() {
+int main(int argc, char** argv) {
     ExceptionHandler<OHLCWithRedisException>::Handle([&]() {
-        runServer();
+        runServer(parseArguments(argc, argv));
     }, "Error in the main application.");
 
     return 0;
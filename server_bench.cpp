@@ -0,0 +1,539 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <chrono>
+#include <iomanip>
+#include <stdexcept>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <grpc++/grpc++.h>
+#include "ohlc.grpc.pb.h"
+#include "bench_report.h"
+
+BenchReport report;
+
+struct LoadOptions {
+    std::string target = "localhost:50051";
+    std::vector<size_t> rates = {10000, 50000, 100000};
+    double seconds = 10.0;
+    size_t symbols = 1000;
+    size_t channels = 4;
+    size_t maxInFlight = 20000;
+    size_t subscribers = 100;
+    size_t rounds = 10;
+    unsigned writePercent = 0;
+};
+
+std::string symbolName(size_t index) {
+    std::string name;
+    for (size_t n = index + 26 * 26 * 26; n > 0; n /= 26) {
+        name.push_back(static_cast<char>('A' + n % 26));
+    }
+    return name;
+}
+
+// Separate channels get separate connections, so one HTTP/2 connection is
+// not the limit at high rates.
+std::vector<std::unique_ptr<ohlc::OHLCConsumerService::Stub>> connect(const LoadOptions& options) {
+    std::vector<std::unique_ptr<ohlc::OHLCConsumerService::Stub>> stubs;
+    for (size_t i = 0; i < options.channels; ++i) {
+        grpc::ChannelArguments arguments;
+        arguments.SetInt("server_bench.channel", static_cast<int>(i));
+        stubs.push_back(ohlc::OHLCConsumerService::NewStub(
+            grpc::CreateCustomChannel(options.target, grpc::InsecureChannelCredentials(), arguments)));
+    }
+    return stubs;
+}
+
+// One candle per symbol on a single stream, so every GetOHLC finds a value.
+void seedSymbols(ohlc::OHLCConsumerService::Stub& stub, size_t symbols) {
+    grpc::ClientContext context;
+    ohlc::SendOHLCResponse response;
+    std::unique_ptr<grpc::ClientWriter<ohlc::OHLC>> writer = stub.SendOHLCStream(&context, &response);
+    for (size_t i = 0; i < symbols; ++i) {
+        ohlc::OHLC candle;
+        candle.set_stock_code(symbolName(i));
+        candle.set_open(1000);
+        candle.set_high(1100);
+        candle.set_low(900);
+        candle.set_close(1050);
+        candle.set_volume(100);
+        candle.set_value(105000);
+        if (!writer->Write(candle)) {
+            break;
+        }
+    }
+    writer->WritesDone();
+    grpc::Status status = writer->Finish();
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to seed symbols: " + status.error_message());
+    }
+}
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t index = static_cast<size_t>(fraction * sorted.size());
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+// Open-loop GetOHLC load: request i is due at start + i / rate whether or
+// not earlier ones have been answered, and its latency is counted from that
+// due time. A server that falls behind shows up as queueing delay in the
+// percentiles instead of quietly lowering the offered rate. Requests beyond
+// maxInFlight wait for a slot, and that wait is counted too. With
+// writePercent set, that share of the requests are SendOHLC instead, spread
+// evenly, so the server's Redis write path is loaded along with reads.
+void benchGet(const LoadOptions& options) {
+    std::vector<std::unique_ptr<ohlc::OHLCConsumerService::Stub>> stubs = connect(options);
+    seedSymbols(*stubs[0], options.symbols);
+    std::cout << "GetOHLC" << (options.writePercent != 0 ? " + " + std::to_string(options.writePercent) + "% SendOHLC" : "")
+              << " against " << options.target << ", " << options.symbols << " symbols, " << options.channels << " channels:" << std::endl;
+
+    using Clock = std::chrono::steady_clock;
+    struct Request {
+        grpc::ClientContext context;
+        ohlc::StockRequest request;
+        ohlc::OHLC response;
+        ohlc::OHLC candle;
+        ohlc::SendOHLCResponse sendResponse;
+        grpc::Status status;
+        Clock::time_point due;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<ohlc::OHLC>> reader;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<ohlc::SendOHLCResponse>> writer;
+    };
+
+    for (size_t rate : options.rates) {
+        const size_t total = static_cast<size_t>(rate * options.seconds);
+        grpc::CompletionQueue queue;
+        std::vector<double> latencies;
+        latencies.reserve(total);
+        std::atomic<size_t> inFlight{0};
+        size_t errors = 0;
+
+        std::thread receiver([&]() {
+            void* tag = nullptr;
+            bool ok = false;
+            for (size_t done = 0; done < total && queue.Next(&tag, &ok); ++done) {
+                std::unique_ptr<Request> request(static_cast<Request*>(tag));
+                latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - request->due).count());
+                if (!ok || !request->status.ok()) {
+                    ++errors;
+                }
+                --inFlight;
+            }
+        });
+
+        const auto interval = std::chrono::duration<double>(1.0 / rate);
+        const Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < total; ++i) {
+            Clock::time_point due = start + std::chrono::duration_cast<Clock::duration>(interval * i);
+            if (due > Clock::now()) {
+                std::this_thread::sleep_until(due);
+            }
+            while (inFlight >= options.maxInFlight) {
+                std::this_thread::yield();
+            }
+            auto request = std::make_unique<Request>();
+            request->due = due;
+            ohlc::OHLCConsumerService::Stub& stub = *stubs[i % stubs.size()];
+            if ((i + 1) * options.writePercent / 100 != i * options.writePercent / 100) {
+                request->candle.set_stock_code(symbolName(i % options.symbols));
+                request->candle.set_open(1000);
+                request->candle.set_high(1100);
+                request->candle.set_low(900);
+                request->candle.set_close(1000 + static_cast<double>(i % 100));
+                request->candle.set_volume(static_cast<double>(i));
+                request->candle.set_value(1000.0 * i);
+                request->writer = stub.PrepareAsyncSendOHLC(&request->context, request->candle, &queue);
+                request->writer->StartCall();
+                Request* tag = request.release();
+                tag->writer->Finish(&tag->sendResponse, &tag->status, tag);
+            } else {
+                request->request.set_stock_code(symbolName(i % options.symbols));
+                request->reader = stub.PrepareAsyncGetOHLC(&request->context, request->request, &queue);
+                request->reader->StartCall();
+                Request* tag = request.release();
+                tag->reader->Finish(&tag->response, &tag->status, tag);
+            }
+            ++inFlight;
+        }
+        receiver.join();
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        queue.Shutdown();
+
+        std::sort(latencies.begin(), latencies.end());
+        double p50 = percentile(latencies, 0.50);
+        double p99 = percentile(latencies, 0.99);
+        double p999 = percentile(latencies, 0.999);
+        Json::Value& result = report.record("get", "qps/" + std::to_string(rate) +
+            (options.writePercent != 0 ? "+writes/" + std::to_string(options.writePercent) : ""), total, 0, seconds);
+        result["p50_us"] = p50;
+        result["p99_us"] = p99;
+        result["p999_us"] = p999;
+        result["errors"] = Json::UInt64(errors);
+
+        std::cout << std::setw(8) << rate << " QPS target" << std::fixed << std::setprecision(0) << std::setw(9)
+                  << total / seconds << " achieved" << std::setprecision(1) << "  p50 " << std::setw(8) << p50
+                  << " us  p99 " << std::setw(8) << p99 << " us  p99.9 " << std::setw(8) << p999 << " us  "
+                  << errors << " errors" << std::defaultfloat << std::endl;
+    }
+}
+
+// A market snapshot of options.symbols symbols, taken options.rounds times
+// each way: one GetOHLC after another, every GetOHLC in flight at once, and
+// a single GetOHLCBatch. Prints the best time per snapshot.
+void benchSnapshot(const LoadOptions& options) {
+    std::unique_ptr<ohlc::OHLCConsumerService::Stub> stub = std::move(connect(options)[0]);
+    seedSymbols(*stub, options.symbols);
+    std::vector<std::string> symbols;
+    for (size_t i = 0; i < options.symbols; ++i) {
+        symbols.push_back(symbolName(i));
+    }
+    std::cout << "Snapshot of " << options.symbols << " symbols from " << options.target << ":" << std::endl;
+
+    auto time = [&](const std::string& variant, auto snapshot) {
+        double best = 1e30;
+        for (size_t round = 0; round < options.rounds; ++round) {
+            auto start = std::chrono::steady_clock::now();
+            size_t candles = snapshot();
+            best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+            if (candles != symbols.size()) {
+                throw std::runtime_error(variant + " returned " + std::to_string(candles) + " candles.");
+            }
+        }
+        report.record("snapshot", variant + "/" + std::to_string(symbols.size()), symbols.size(), 0, best);
+        std::cout << "  " << std::left << std::setw(14) << variant << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(10) << best * 1e3 << " ms per snapshot" << std::defaultfloat << std::endl;
+    };
+
+    time("sequential", [&]() {
+        size_t candles = 0;
+        for (const std::string& symbol : symbols) {
+            grpc::ClientContext context;
+            ohlc::StockRequest request;
+            ohlc::OHLC response;
+            request.set_stock_code(symbol);
+            candles += stub->GetOHLC(&context, request, &response).ok() && response.stock_code() == symbol;
+        }
+        return candles;
+    });
+
+    time("concurrent", [&]() {
+        struct Request {
+            grpc::ClientContext context;
+            ohlc::StockRequest request;
+            ohlc::OHLC response;
+            grpc::Status status;
+            std::unique_ptr<grpc::ClientAsyncResponseReader<ohlc::OHLC>> reader;
+        };
+        grpc::CompletionQueue queue;
+        std::vector<std::unique_ptr<Request>> requests;
+        for (const std::string& symbol : symbols) {
+            requests.push_back(std::make_unique<Request>());
+            Request& request = *requests.back();
+            request.request.set_stock_code(symbol);
+            request.reader = stub->PrepareAsyncGetOHLC(&request.context, request.request, &queue);
+            request.reader->StartCall();
+            request.reader->Finish(&request.response, &request.status, &request);
+        }
+        size_t candles = 0;
+        void* tag = nullptr;
+        bool ok = false;
+        for (size_t done = 0; done < requests.size() && queue.Next(&tag, &ok); ++done) {
+            candles += ok && static_cast<Request*>(tag)->status.ok();
+        }
+        queue.Shutdown();
+        while (queue.Next(&tag, &ok)) {
+        }
+        return candles;
+    });
+
+    time("batch", [&]() {
+        grpc::ClientContext context;
+        ohlc::StockBatchRequest request;
+        ohlc::OHLCBatch response;
+        for (const std::string& symbol : symbols) {
+            request.add_stock_codes(symbol);
+        }
+        grpc::Status status = stub->GetOHLCBatch(&context, request, &response);
+        return status.ok() ? static_cast<size_t>(response.candles_size()) : 0;
+    });
+}
+
+// A trading day of 1s candles, 09:00 to 15:30 UTC on 2 January 2024, uploaded
+// as one symbol's history and then read back whole with GetOHLCRange
+// options.rounds times at the server's default page size and at smaller
+// pages. Prints the median and best time per full-day read.
+void benchRange(const LoadOptions& options) {
+    std::unique_ptr<ohlc::OHLCConsumerService::Stub> stub = std::move(connect(options)[0]);
+    const std::string symbol = symbolName(0);
+    const uint64_t interval = 1000000000ULL;
+    const uint64_t dayStart = 1704186000ULL * interval;
+    const size_t candleCount = 6 * 3600 + 30 * 60;
+    {
+        grpc::ClientContext context;
+        ohlc::SendOHLCResponse response;
+        std::unique_ptr<grpc::ClientWriter<ohlc::OHLC>> writer = stub->SendOHLCStream(&context, &response);
+        for (size_t i = 0; i < candleCount; ++i) {
+            ohlc::OHLC candle;
+            candle.set_stock_code(symbol);
+            candle.set_open(1000 + i % 50);
+            candle.set_high(1100 + i % 50);
+            candle.set_low(900 + i % 50);
+            candle.set_close(1050 + i % 50);
+            candle.set_volume(100 * (1 + i % 7));
+            candle.set_value(105000 * (1 + i % 7));
+            candle.set_start_time(dayStart + i * interval);
+            candle.set_interval(interval);
+            if (!writer->Write(candle)) {
+                break;
+            }
+        }
+        writer->WritesDone();
+        grpc::Status status = writer->Finish();
+        if (!status.ok()) {
+            throw std::runtime_error("Failed to seed history: " + status.error_message());
+        }
+    }
+    std::cout << "GetOHLCRange of " << candleCount << " 1s candles from " << options.target << ":" << std::endl;
+
+    for (uint32_t pageSize : {0u, 1000u, 100u}) {
+        std::vector<double> times;
+        for (size_t round = 0; round < options.rounds; ++round) {
+            grpc::ClientContext context;
+            ohlc::OHLCRangeRequest request;
+            request.set_stock_code(symbol);
+            request.set_interval(interval);
+            request.set_from_time(dayStart);
+            request.set_to_time(dayStart + candleCount * interval);
+            request.set_page_size(pageSize);
+
+            auto start = std::chrono::steady_clock::now();
+            std::unique_ptr<grpc::ClientReader<ohlc::OHLCPage>> reader = stub->GetOHLCRange(&context, request);
+            ohlc::OHLCPage page;
+            size_t candles = 0;
+            uint64_t lastStart = 0;
+            while (reader->Read(&page)) {
+                for (const ohlc::OHLC& candle : page.candles()) {
+                    if (candle.start_time() < lastStart) {
+                        throw std::runtime_error("GetOHLCRange returned candles out of order.");
+                    }
+                    lastStart = candle.start_time();
+                }
+                candles += page.candles_size();
+            }
+            grpc::Status status = reader->Finish();
+            times.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+            if (!status.ok() || candles != candleCount) {
+                throw std::runtime_error("GetOHLCRange returned " + std::to_string(candles) + " candles: " + status.error_message());
+            }
+        }
+        std::sort(times.begin(), times.end());
+        const std::string variant = pageSize == 0 ? "default_page" : "page_" + std::to_string(pageSize);
+        report.record("range", variant + "/" + std::to_string(candleCount), candleCount, 0, percentile(times, 0.5));
+        std::cout << "  " << std::left << std::setw(14) << variant << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(10) << percentile(times, 0.5) * 1e3 << " ms median" << std::setw(10) << times.front() * 1e3
+                  << " ms best" << std::defaultfloat << std::endl;
+    }
+}
+
+// Subscribers to every symbol on their own channels, then rounds uploads
+// of every symbol on SendOHLCStream, round r carrying volume r. Reports the
+// candles delivered per second across subscribers, how many were replaced
+// before they could be sent, and how long after the last upload was
+// acknowledged each subscriber had seen the last round of every symbol.
+void benchSubscribe(const LoadOptions& options) {
+    LoadOptions subscriberChannels = options;
+    subscriberChannels.channels = options.subscribers;
+    std::vector<std::unique_ptr<ohlc::OHLCConsumerService::Stub>> stubs = connect(subscriberChannels);
+    std::unique_ptr<ohlc::OHLCConsumerService::Stub> publisher = std::move(connect(options)[0]);
+    std::cout << "SubscribeOHLC against " << options.target << ", " << options.subscribers << " subscribers, "
+              << options.symbols << " symbols, " << options.rounds << " rounds:" << std::endl;
+
+    using Clock = std::chrono::steady_clock;
+    struct Session {
+        grpc::ClientContext context;
+        std::atomic<size_t> received{0};
+        std::atomic<bool> warm{false};
+        Clock::time_point caughtUp;
+    };
+    std::vector<std::unique_ptr<Session>> sessions;
+    std::vector<std::thread> readers;
+    const std::string warmup = "WARMUP";
+    for (size_t i = 0; i < options.subscribers; ++i) {
+        sessions.push_back(std::make_unique<Session>());
+        readers.emplace_back([&, session = sessions.back().get(), stub = stubs[i].get()]() {
+            std::unique_ptr<grpc::ClientReader<ohlc::OHLC>> reader = stub->SubscribeOHLC(&session->context, ohlc::SubscribeRequest());
+            std::vector<bool> done(options.symbols, false);
+            size_t remaining = options.symbols;
+            ohlc::OHLC candle;
+            while (remaining > 0 && reader->Read(&candle)) {
+                if (candle.stock_code() == warmup) {
+                    session->warm = true;
+                    continue;
+                }
+                ++session->received;
+                size_t index = static_cast<size_t>(candle.value());
+                if (candle.volume() == options.rounds && index < done.size() && !done[index]) {
+                    done[index] = true;
+                    --remaining;
+                }
+            }
+            session->caughtUp = Clock::now();
+            session->context.TryCancel();
+            reader->Finish();
+        });
+    }
+
+    auto upload = [&](const std::vector<ohlc::OHLC>& candles) {
+        grpc::ClientContext context;
+        ohlc::SendOHLCResponse response;
+        std::unique_ptr<grpc::ClientWriter<ohlc::OHLC>> writer = publisher->SendOHLCStream(&context, &response);
+        for (const ohlc::OHLC& candle : candles) {
+            writer->Write(candle);
+        }
+        writer->WritesDone();
+        grpc::Status status = writer->Finish();
+        if (!status.ok()) {
+            throw std::runtime_error("Failed to upload candles: " + status.error_message());
+        }
+    };
+
+    // Subscriptions are registered asynchronously; keep publishing a marker
+    // until every subscriber has seen one.
+    ohlc::OHLC marker;
+    marker.set_stock_code(warmup);
+    while (std::any_of(sessions.begin(), sessions.end(), [](const auto& session) { return !session->warm; })) {
+        upload({marker});
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    std::vector<ohlc::OHLC> candles(options.symbols);
+    for (size_t i = 0; i < options.symbols; ++i) {
+        candles[i].set_stock_code(symbolName(i));
+        candles[i].set_value(static_cast<double>(i));
+    }
+    const Clock::time_point start = Clock::now();
+    for (size_t round = 1; round <= options.rounds; ++round) {
+        for (ohlc::OHLC& candle : candles) {
+            candle.set_open(1000 + round);
+            candle.set_close(1000 + round);
+            candle.set_volume(static_cast<double>(round));
+        }
+        upload(candles);
+    }
+    const Clock::time_point acknowledged = Clock::now();
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    std::vector<double> lags;
+    size_t delivered = 0;
+    Clock::time_point last = acknowledged;
+    for (const std::unique_ptr<Session>& session : sessions) {
+        delivered += session->received;
+        lags.push_back(std::chrono::duration<double, std::milli>(std::max(session->caughtUp, acknowledged) - acknowledged).count());
+        last = std::max(last, session->caughtUp);
+    }
+    std::sort(lags.begin(), lags.end());
+    double seconds = std::chrono::duration<double>(last - start).count();
+    size_t published = options.symbols * options.rounds;
+    double replaced = 1.0 - static_cast<double>(delivered) / (published * options.subscribers);
+
+    Json::Value& result = report.record("subscribe", "subscribers/" + std::to_string(options.subscribers), delivered, 0, seconds);
+    result["published"] = Json::UInt64(published);
+    result["replaced_fraction"] = replaced;
+    result["lag_p50_ms"] = percentile(lags, 0.50);
+    result["lag_max_ms"] = lags.back();
+
+    std::cout << std::fixed << std::setprecision(0) << std::setw(10) << published / seconds << " candles/s published"
+              << std::setw(12) << delivered / seconds << " candles/s delivered" << std::setprecision(1) << std::setw(7)
+              << replaced * 100 << "% replaced before sending, caught up " << percentile(lags, 0.50) << " ms (p50) "
+              << lags.back() << " ms (max) after the last ack" << std::defaultfloat << std::endl;
+}
+
+std::vector<size_t> parseRates(std::string_view text) {
+    std::vector<size_t> rates;
+    while (!text.empty()) {
+        size_t comma = text.find(',');
+        std::string_view rate = text.substr(0, comma);
+        rates.push_back(std::stoul(std::string(rate)));
+        if (rates.back() == 0) {
+            throw std::invalid_argument("Invalid rate: " + std::string(rate));
+        }
+        text = comma == std::string_view::npos ? std::string_view() : text.substr(comma + 1);
+    }
+    return rates;
+}
+
+int main(int argc, char** argv) {
+    try {
+        const std::string usage = "Usage: " + std::string(argv[0]) +
+            " [get|snapshot|subscribe|range] [--target=localhost:50051] [--rates=10000,50000,100000] [--seconds=10] [--symbols=1000]"
+            " [--channels=4] [--max-in-flight=20000] [--writes=PERCENT] [--subscribers=100] [--rounds=10] [--json=FILE] [--label=NAME]";
+        std::vector<std::string> positional;
+        std::string jsonPath;
+        std::string label;
+        LoadOptions options;
+        for (int i = 1; i < argc; ++i) {
+            std::string_view arg = argv[i];
+            if (arg.rfind("--target=", 0) == 0) {
+                options.target = std::string(arg.substr(9));
+            } else if (arg.rfind("--rates=", 0) == 0) {
+                options.rates = parseRates(arg.substr(8));
+            } else if (arg.rfind("--seconds=", 0) == 0) {
+                options.seconds = std::stod(std::string(arg.substr(10)));
+            } else if (arg.rfind("--symbols=", 0) == 0) {
+                options.symbols = std::stoul(std::string(arg.substr(10)));
+            } else if (arg.rfind("--channels=", 0) == 0) {
+                options.channels = std::stoul(std::string(arg.substr(11)));
+            } else if (arg.rfind("--max-in-flight=", 0) == 0) {
+                options.maxInFlight = std::stoul(std::string(arg.substr(16)));
+            } else if (arg.rfind("--writes=", 0) == 0) {
+                options.writePercent = static_cast<unsigned>(std::stoul(std::string(arg.substr(9))));
+            } else if (arg.rfind("--subscribers=", 0) == 0) {
+                options.subscribers = std::stoul(std::string(arg.substr(14)));
+            } else if (arg.rfind("--rounds=", 0) == 0) {
+                options.rounds = std::stoul(std::string(arg.substr(9)));
+            } else if (arg.rfind("--json=", 0) == 0) {
+                jsonPath = std::string(arg.substr(7));
+            } else if (arg.rfind("--label=", 0) == 0) {
+                label = std::string(arg.substr(8));
+            } else if (arg.rfind("--", 0) == 0) {
+                throw std::invalid_argument(usage);
+            } else {
+                positional.emplace_back(arg);
+            }
+        }
+        if (options.rates.empty() || options.seconds <= 0.0 || options.symbols == 0 || options.channels == 0 ||
+            options.maxInFlight == 0 || options.subscribers == 0 || options.rounds == 0 || options.writePercent > 100) {
+            throw std::invalid_argument(usage);
+        }
+
+        std::string benchmark = positional.size() > 0 ? positional[0] : "get";
+        if (positional.size() > 1 || (benchmark != "get" && benchmark != "snapshot" && benchmark != "subscribe" && benchmark != "range")) {
+            throw std::invalid_argument(usage);
+        }
+        if (benchmark == "get") {
+            benchGet(options);
+        } else if (benchmark == "snapshot") {
+            benchSnapshot(options);
+        } else if (benchmark == "subscribe") {
+            benchSubscribe(options);
+        } else {
+            benchRange(options);
+        }
+        if (!jsonPath.empty()) {
+            report.save(jsonPath, label);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,228 @@
+#ifndef SHM_RING_H
+#define SHM_RING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "symbol_table.h"
+
+// Ring the server creates with a bare --shm and the producer attaches to
+// with --send=shm.
+constexpr char defaultShmName[] = "/ohlc-candles";
+
+// One candle as it sits in the ring: plain data, copied in and out with no
+// encoding. sendTime is the writer's steady_clock in nanoseconds, which is
+// shared by processes on the same host, so the reader can measure latency.
+struct ShmCandle {
+    static constexpr size_t maxStockCode = 31;
+
+    char stockCode[maxStockCode + 1];
+    double open;
+    double high;
+    double low;
+    double close;
+    int64_t volume;
+    double value;
+    uint64_t sequence;
+    uint64_t sendTime;
+
+    std::string_view code() const {
+        return {stockCode, ::strnlen(stockCode, sizeof(stockCode))};
+    }
+};
+
+// Waits for the other side of the ring: spins briefly, then yields, then
+// sleeps, so an idle reader costs almost nothing while a busy one sees a new
+// candle within a few hundred nanoseconds.
+class ShmBackoff {
+public:
+    void wait() {
+        if (idleRounds >= 1024) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        } else if (idleRounds >= 64) {
+            std::this_thread::yield();
+        }
+        ++idleRounds;
+    }
+
+    void reset() {
+        idleRounds = 0;
+    }
+
+private:
+    unsigned idleRounds = 0;
+};
+
+// Single-producer, single-consumer ring of ShmCandle in a POSIX shared
+// memory object, for a producer and server on the same host. head and tail
+// count every slot ever written and read; each side owns one of them, reads
+// the other with acquire and publishes its own with release, so no lock or
+// system call is needed per candle. The two counters sit on their own cache
+// lines and each side keeps a cached copy of the other's, which it reloads
+// only when the ring looks full or empty.
+//
+// The server creates the ring, replacing any left by an earlier run; the
+// server is stopped by a signal, so the ring stays in /dev/shm until the
+// next server replaces it. One producer at a time attaches to it: attach
+// takes an exclusive flock on the shared memory object, which the kernel
+// drops when the producer exits however it exits, and refuses to attach a
+// second producer whose writes would race the first's. A producer attached
+// before a server restart still holds the old ring and must be restarted
+// too.
+class ShmRing {
+public:
+    static std::unique_ptr<ShmRing> create(const std::string& name, size_t slots) {
+        if (slots == 0 || (slots & (slots - 1)) != 0) {
+            throw std::invalid_argument("Shared memory ring slots must be a power of two: " + std::to_string(slots));
+        }
+        ::shm_unlink(name.c_str());
+        int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to create shared memory: " + name);
+        }
+        size_t length = sizeof(Header) + slots * sizeof(ShmCandle);
+        if (::ftruncate(fd, static_cast<off_t>(length)) != 0) {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            throw std::runtime_error("Failed to size shared memory: " + name);
+        }
+        std::unique_ptr<ShmRing> ring(new ShmRing(name, fd, length, true));
+        Header* header = new (ring->mapping) Header();
+        header->slots = slots;
+        header->magic.store(headerMagic, std::memory_order_release);
+        ring->attachHeader();
+        return ring;
+    }
+
+    static std::unique_ptr<ShmRing> attach(const std::string& name) {
+        int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            throw std::runtime_error("No shared memory ring " + name + "; start the server with --shm first.");
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+            ::close(fd);
+            throw std::runtime_error("Invalid shared memory ring: " + name);
+        }
+        if (::flock(fd, LOCK_EX | LOCK_NB) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Shared memory ring " + name + " already has a producer attached.");
+        }
+        // The lock belongs to the open file, which the mapping does not keep
+        // open, so a duplicate descriptor holds it for as long as the ring.
+        int claim = ::dup(fd);
+        std::unique_ptr<ShmRing> ring(new ShmRing(name, fd, static_cast<size_t>(st.st_size), false, claim));
+        if (ring->header()->magic.load(std::memory_order_acquire) != headerMagic ||
+            sizeof(Header) + ring->header()->slots * sizeof(ShmCandle) > ring->length) {
+            throw std::runtime_error("Invalid shared memory ring: " + name);
+        }
+        ring->attachHeader();
+        return ring;
+    }
+
+    ~ShmRing() {
+        ::munmap(mapping, length);
+        if (claim >= 0) {
+            ::close(claim);
+        }
+        if (owner) {
+            ::shm_unlink(name.c_str());
+        }
+    }
+
+    ShmRing(const ShmRing&) = delete;
+    ShmRing& operator=(const ShmRing&) = delete;
+
+    // Producer side. False when the ring is full.
+    bool tryWrite(const ShmCandle& candle) {
+        uint64_t head = header()->head.load(std::memory_order_relaxed);
+        if (head - cachedTail >= mask + 1) {
+            cachedTail = header()->tail.load(std::memory_order_acquire);
+            if (head - cachedTail >= mask + 1) {
+                return false;
+            }
+        }
+        slots[head & mask] = candle;
+        header()->head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. False when the ring is empty.
+    bool tryRead(ShmCandle& candle) {
+        uint64_t tail = header()->tail.load(std::memory_order_relaxed);
+        if (tail == cachedHead) {
+            cachedHead = header()->head.load(std::memory_order_acquire);
+            if (tail == cachedHead) {
+                return false;
+            }
+        }
+        candle = slots[tail & mask];
+        header()->tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t capacity() const {
+        return mask + 1;
+    }
+
+private:
+    static constexpr uint64_t headerMagic = 0x4F484C4352494E47ULL;
+
+    struct Header {
+        std::atomic<uint64_t> magic{0};
+        uint64_t slots = 0;
+        alignas(cacheLineSize) std::atomic<uint64_t> head{0};
+        alignas(cacheLineSize) std::atomic<uint64_t> tail{0};
+    };
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "the ring needs lock-free 64-bit atomics across processes");
+
+    ShmRing(const std::string& name, int fd, size_t length, bool owner, int claim = -1)
+        : name(name), length(length), owner(owner), claim(claim) {
+        mapping = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            if (owner) {
+                ::shm_unlink(name.c_str());
+            }
+            if (claim >= 0) {
+                ::close(claim);
+            }
+            throw std::runtime_error("Failed to map shared memory: " + name);
+        }
+    }
+
+    Header* header() const {
+        return static_cast<Header*>(mapping);
+    }
+
+    void attachHeader() {
+        mask = header()->slots - 1;
+        slots = reinterpret_cast<ShmCandle*>(static_cast<char*>(mapping) + sizeof(Header));
+        cachedHead = header()->head.load(std::memory_order_acquire);
+        cachedTail = header()->tail.load(std::memory_order_acquire);
+    }
+
+    std::string name;
+    void* mapping = nullptr;
+    size_t length;
+    bool owner;
+    int claim;
+    ShmCandle* slots = nullptr;
+    uint64_t mask = 0;
+    uint64_t cachedHead = 0;
+    uint64_t cachedTail = 0;
+};
+
+#endif // SHM_RING_H
@@ -0,0 +1,227 @@
+#ifndef STORED_CANDLE_H
+#define STORED_CANDLE_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "ohlc.pb.h"
+
+// How the server stores a candle as a Redis value. Version 2 is binary:
+//
+//   byte 0        storedCandleVersion
+//   byte 1        length n of the stock code, at most 255
+//   n bytes       stock code
+//   1 byte        one bit per price field, open, high, low, close, volume
+//                 and value from bit 0: clear when the field is a whole
+//                 number stored as a zigzag varint, set when it is stored as
+//                 the 8 bytes of its double, least significant first
+//   fields        in that order
+//   varint        sequence
+//   varint        start_time
+//   varint        interval
+//
+// Version 1 was the same without start_time and interval, which a running
+// candle leaves 0. IDX prices, volumes and values are whole numbers, so a
+// candle usually takes about 30 bytes, and every double comes back exactly
+// as it was saved. Values from before version 1 were CSV text, which always
+// starts with the stock code or a comma, never with a version byte;
+// decodeStoredCandle still reads every version.
+constexpr uint8_t storedCandleVersion = 2;
+
+// An encoded candle, held inline so that encoding needs no allocation.
+struct StoredCandleBytes {
+    static constexpr size_t maxStockCode = 255;
+    static constexpr size_t maxSize = 2 + maxStockCode + 1 + 6 * 10 + 3 * 10;
+
+    char data[maxSize];
+    size_t size = 0;
+};
+
+namespace storedcandle {
+
+constexpr int fieldCount = 6;
+// Whole doubles below 2^53 in magnitude survive a round trip through int64;
+// -0.0 does not, so it is stored raw.
+constexpr double maxWholeNumber = 9007199254740992.0;
+
+inline void putVarint(char*& out, uint64_t value) {
+    while (value >= 0x80) {
+        *out++ = static_cast<char>(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<char>(value);
+}
+
+inline bool getVarint(const char*& in, const char* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && in < end; shift += 7) {
+        const uint8_t byte = static_cast<uint8_t>(*in++);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool isWholeNumber(double value) {
+    return std::fabs(value) < maxWholeNumber && std::trunc(value) == value && !(value == 0.0 && std::signbit(value));
+}
+
+inline void putField(char*& out, double value, bool raw) {
+    if (!raw) {
+        const int64_t whole = static_cast<int64_t>(value);
+        putVarint(out, (static_cast<uint64_t>(whole) << 1) ^ static_cast<uint64_t>(whole >> 63));
+        return;
+    }
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 8; ++i) {
+        *out++ = static_cast<char>(bits >> (8 * i));
+    }
+}
+
+inline bool getField(const char*& in, const char* end, bool raw, double& value) {
+    if (!raw) {
+        uint64_t zigzag;
+        if (!getVarint(in, end, zigzag)) {
+            return false;
+        }
+        value = static_cast<double>(static_cast<int64_t>((zigzag >> 1) ^ (~(zigzag & 1) + 1)));
+        return true;
+    }
+    if (end - in < 8) {
+        return false;
+    }
+    uint64_t bits = 0;
+    for (int i = 0; i < 8; ++i) {
+        bits |= static_cast<uint64_t>(static_cast<uint8_t>(*in++)) << (8 * i);
+    }
+    std::memcpy(&value, &bits, sizeof(value));
+    return true;
+}
+
+} // namespace storedcandle
+
+inline void encodeStoredCandle(const ohlc::OHLC& candle, StoredCandleBytes& out) {
+    const std::string& code = candle.stock_code();
+    if (code.size() > StoredCandleBytes::maxStockCode) {
+        throw std::invalid_argument("Stock code too long to store: " + code.substr(0, 32) + "...");
+    }
+    const double fields[storedcandle::fieldCount] = {
+        candle.open(), candle.high(), candle.low(), candle.close(), candle.volume(), candle.value()};
+
+    char* cursor = out.data;
+    *cursor++ = static_cast<char>(storedCandleVersion);
+    *cursor++ = static_cast<char>(code.size());
+    std::memcpy(cursor, code.data(), code.size());
+    cursor += code.size();
+    uint8_t rawFields = 0;
+    for (int i = 0; i < storedcandle::fieldCount; ++i) {
+        if (!storedcandle::isWholeNumber(fields[i])) {
+            rawFields |= static_cast<uint8_t>(1u << i);
+        }
+    }
+    *cursor++ = static_cast<char>(rawFields);
+    for (int i = 0; i < storedcandle::fieldCount; ++i) {
+        storedcandle::putField(cursor, fields[i], (rawFields >> i) & 1);
+    }
+    storedcandle::putVarint(cursor, candle.sequence());
+    storedcandle::putVarint(cursor, candle.start_time());
+    storedcandle::putVarint(cursor, candle.interval());
+    out.size = static_cast<size_t>(cursor - out.data);
+}
+
+// The format before version 1: stock code and prices joined by commas, written
+// with ostream's default 6 significant digits. Kept to compare against.
+inline std::string encodeCsvCandle(const ohlc::OHLC& candle) {
+    std::ostringstream oss;
+    oss << candle.stock_code() << "," << candle.open() << "," << candle.high() << ","
+        << candle.low() << "," << candle.close() << "," << candle.volume() << ","
+        << candle.value();
+    return oss.str();
+}
+
+inline void decodeCsvCandle(const std::string& serializedData, ohlc::OHLC* candle) {
+    std::istringstream iss(serializedData);
+    std::string token;
+
+    std::getline(iss, token, ',');
+    candle->set_stock_code(token);
+
+    std::getline(iss, token, ',');
+    candle->set_open(std::stod(token));
+
+    std::getline(iss, token, ',');
+    candle->set_high(std::stod(token));
+
+    std::getline(iss, token, ',');
+    candle->set_low(std::stod(token));
+
+    std::getline(iss, token, ',');
+    candle->set_close(std::stod(token));
+
+    std::getline(iss, token, ',');
+    candle->set_volume(std::stod(token));
+
+    std::getline(iss, token, ',');
+    candle->set_value(std::stod(token));
+}
+
+// Reads a stored value of any version into candle. False when the value is
+// truncated or of a version this build does not know.
+inline bool decodeStoredCandle(const char* data, size_t size, ohlc::OHLC* candle) {
+    const uint8_t version = size == 0 ? 0 : static_cast<uint8_t>(data[0]);
+    if (version != 1 && version != storedCandleVersion) {
+        if (size != 0 && static_cast<uint8_t>(data[0]) < ' ') {
+            return false;
+        }
+        try {
+            decodeCsvCandle(std::string(data, size), candle);
+        } catch (const std::exception&) {
+            return false;
+        }
+        return true;
+    }
+    const char* cursor = data + 1;
+    const char* end = data + size;
+    if (end - cursor < 1) {
+        return false;
+    }
+    const size_t codeLength = static_cast<uint8_t>(*cursor++);
+    if (static_cast<size_t>(end - cursor) < codeLength + 1) {
+        return false;
+    }
+    candle->set_stock_code(cursor, codeLength);
+    cursor += codeLength;
+    const uint8_t rawFields = static_cast<uint8_t>(*cursor++);
+
+    double fields[storedcandle::fieldCount];
+    for (int i = 0; i < storedcandle::fieldCount; ++i) {
+        if (!storedcandle::getField(cursor, end, (rawFields >> i) & 1, fields[i])) {
+            return false;
+        }
+    }
+    uint64_t sequence;
+    uint64_t startTime = 0;
+    uint64_t interval = 0;
+    if (!storedcandle::getVarint(cursor, end, sequence) ||
+        (version >= 2 && (!storedcandle::getVarint(cursor, end, startTime) || !storedcandle::getVarint(cursor, end, interval)))) {
+        return false;
+    }
+    candle->set_open(fields[0]);
+    candle->set_high(fields[1]);
+    candle->set_low(fields[2]);
+    candle->set_close(fields[3]);
+    candle->set_volume(fields[4]);
+    candle->set_value(fields[5]);
+    candle->set_sequence(sequence);
+    candle->set_start_time(startTime);
+    candle->set_interval(interval);
+    return true;
+}
+
+#endif // STORED_CANDLE_H
@@ -0,0 +1,82 @@
+#ifndef SUBSCRIPTION_HUB_H
+#define SUBSCRIPTION_HUB_H
+
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Something that wants the updates of some symbols. push is called from the
+// publishing thread and must not block on the subscriber's reader.
+template <typename Update>
+class Subscriber {
+public:
+    virtual ~Subscriber() = default;
+    virtual void push(const std::string& symbol, const Update& update) = 0;
+};
+
+// Routes each published update to the subscribers of its symbol and to
+// those that follow every symbol. Publishing takes a shared lock, so
+// publishers on different threads do not wait for one another; subscribing
+// and unsubscribing take it exclusively, which also means that once
+// unsubscribe returns no push to that subscriber is still running.
+template <typename Update>
+class SubscriptionHub {
+public:
+    // An empty symbol list follows every symbol.
+    void subscribe(Subscriber<Update>* subscriber, const std::vector<std::string>& symbols) {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        if (symbols.empty()) {
+            everything.push_back(subscriber);
+        }
+        for (const std::string& symbol : symbols) {
+            std::vector<Subscriber<Update>*>& list = bySymbol[symbol];
+            if (std::find(list.begin(), list.end(), subscriber) == list.end()) {
+                list.push_back(subscriber);
+            }
+        }
+    }
+
+    void unsubscribe(Subscriber<Update>* subscriber) {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        erase(everything, subscriber);
+        for (auto it = bySymbol.begin(); it != bySymbol.end();) {
+            erase(it->second, subscriber);
+            it = it->second.empty() ? bySymbol.erase(it) : std::next(it);
+        }
+    }
+
+    // Lets a publisher skip building an update nobody will receive.
+    bool hasSubscribers(const std::string& symbol) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return !everything.empty() || bySymbol.count(symbol) != 0;
+    }
+
+    // The same update object goes to every subscriber, so anything costly,
+    // like serialization, is done once by the caller.
+    void publish(const std::string& symbol, const Update& update) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        for (Subscriber<Update>* subscriber : everything) {
+            subscriber->push(symbol, update);
+        }
+        auto it = bySymbol.find(symbol);
+        if (it != bySymbol.end()) {
+            for (Subscriber<Update>* subscriber : it->second) {
+                subscriber->push(symbol, update);
+            }
+        }
+    }
+
+private:
+    static void erase(std::vector<Subscriber<Update>*>& list, Subscriber<Update>* subscriber) {
+        list.erase(std::remove(list.begin(), list.end(), subscriber), list.end());
+    }
+
+    mutable std::shared_mutex mutex;
+    std::vector<Subscriber<Update>*> everything;
+    std::unordered_map<std::string, std::vector<Subscriber<Update>*>> bySymbol;
+};
+
+#endif // SUBSCRIPTION_HUB_H
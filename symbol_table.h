@@ -0,0 +1,160 @@
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using SymbolId = uint32_t;
+
+constexpr size_t cacheLineSize = 64;
+
+// Interns stock codes as dense ids 0..size()-1 in first-seen order. Lookups
+// hash the string_view in place, so a tick never allocates; the last id
+// handed out is checked first because a symbol's ticks arrive in runs.
+class SymbolTable {
+public:
+    static constexpr SymbolId npos = std::numeric_limits<SymbolId>::max();
+
+    SymbolTable() : slots(16) {}
+
+    SymbolId intern(std::string_view symbol) {
+        if (lastId != npos && names[lastId] == symbol) {
+            return lastId;
+        }
+
+        uint64_t symbolHash = hash(symbol);
+        size_t index = probe(symbol, symbolHash);
+        if (slots[index].id != npos) {
+            return lastId = slots[index].id;
+        }
+
+        SymbolId id = static_cast<SymbolId>(names.size());
+        names.emplace_back(symbol);
+        slots[index] = {static_cast<uint32_t>(symbolHash), id};
+        if (names.size() * 4 > slots.size() * 3) {
+            grow();
+        }
+        return lastId = id;
+    }
+
+    SymbolId find(std::string_view symbol) const {
+        return slots[probe(symbol, hash(symbol))].id;
+    }
+
+    const std::string& name(SymbolId id) const {
+        return names[id];
+    }
+
+    size_t size() const {
+        return names.size();
+    }
+
+private:
+    struct Slot {
+        uint32_t hashTag = 0;
+        SymbolId id = npos;
+    };
+
+    static uint64_t mix(uint64_t x) {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
+    }
+
+    // Stock codes are a handful of bytes, so whole words are mixed at once.
+    static uint64_t hash(std::string_view symbol) {
+        uint64_t h = 0x9E3779B97F4A7C15ULL ^ symbol.size();
+        size_t i = 0;
+        for (; i + 8 <= symbol.size(); i += 8) {
+            uint64_t word;
+            std::memcpy(&word, symbol.data() + i, sizeof(word));
+            h = mix(h ^ word);
+        }
+        uint64_t tail = 0;
+        std::memcpy(&tail, symbol.data() + i, symbol.size() - i);
+        return mix(h ^ tail);
+    }
+
+    // Linear probing; returns the symbol's slot or the empty slot where it
+    // would go.
+    size_t probe(std::string_view symbol, uint64_t symbolHash) const {
+        const size_t mask = slots.size() - 1;
+        const uint32_t hashTag = static_cast<uint32_t>(symbolHash);
+        size_t index = static_cast<size_t>(symbolHash >> 32) & mask;
+
+        while (slots[index].id != npos &&
+               (slots[index].hashTag != hashTag || names[slots[index].id] != symbol)) {
+            index = (index + 1) & mask;
+        }
+        return index;
+    }
+
+    void grow() {
+        std::vector<Slot> previous(slots.size() * 2);
+        previous.swap(slots);
+        for (const Slot& slot : previous) {
+            if (slot.id != npos) {
+                slots[probe(names[slot.id], hash(names[slot.id]))] = slot;
+            }
+        }
+    }
+
+    std::vector<Slot> slots;
+    std::vector<std::string> names;
+    SymbolId lastId = npos;
+};
+
+// Per-symbol values stored contiguously by SymbolId, one cache line each, so
+// neighbouring symbols never share a line.
+template <typename T>
+class SymbolMap {
+public:
+    T& operator[](std::string_view symbol) {
+        return values[intern(symbol)].value;
+    }
+
+    T& operator[](SymbolId id) {
+        return values[id].value;
+    }
+
+    const T& operator[](SymbolId id) const {
+        return values[id].value;
+    }
+
+    SymbolId find(std::string_view symbol) const {
+        return symbols.find(symbol);
+    }
+
+    SymbolId intern(std::string_view symbol) {
+        SymbolId id = symbols.intern(symbol);
+        if (id == values.size()) {
+            values.emplace_back();
+        }
+        return id;
+    }
+
+    const std::string& name(SymbolId id) const {
+        return symbols.name(id);
+    }
+
+    size_t size() const {
+        return values.size();
+    }
+
+private:
+    struct alignas(cacheLineSize) Slot {
+        T value{};
+    };
+
+    SymbolTable symbols;
+    std::vector<Slot> values;
+};
+
+#endif // SYMBOL_TABLE_H
@@ -0,0 +1,344 @@
+#ifndef TICK_PARSER_H
+#define TICK_PARSER_H
+
+#include <charconv>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <json/json.h>
+
+// One ndjson record. stockCode and orderNumber point into the parsed line
+// (or into the parser's fallback storage) and are only valid until the next
+// call to parse().
+struct Tick {
+    char type = '\0';
+    int quantity = 0;
+    double price = 0.0;
+    std::string_view stockCode;
+    std::string_view orderNumber;
+    uint64_t eventTime = 0;
+};
+
+// Outcome of parsing one line. Anything but Ok means the line is skipped.
+enum class ParseStatus {
+    Ok,
+    BadJson,          // not a flat JSON object, or a required field is missing or not a number
+    UnknownType,      // "type" is not A, E or P
+    NumericOverflow   // a quantity, price or timestamp does not fit its type
+};
+
+// Skipped lines per error class, summed per shard and printed at the end.
+struct ParseErrorCounts {
+    size_t badJson = 0;
+    size_t unknownType = 0;
+    size_t numericOverflow = 0;
+
+    void count(ParseStatus status) {
+        switch (status) {
+            case ParseStatus::Ok: break;
+            case ParseStatus::BadJson: ++badJson; break;
+            case ParseStatus::UnknownType: ++unknownType; break;
+            case ParseStatus::NumericOverflow: ++numericOverflow; break;
+        }
+    }
+
+    void merge(const ParseErrorCounts& other) {
+        badJson += other.badJson;
+        unknownType += other.unknownType;
+        numericOverflow += other.numericOverflow;
+    }
+
+    size_t total() const {
+        return badJson + unknownType + numericOverflow;
+    }
+};
+
+// Parser specialised for the three record shapes in the feed:
+//   A: type, order_number, order_verb, quantity, order_book, price, stock_code
+//   E: type, order_number, executed_quantity, execution_price, order_verb, stock_code, order_book
+//   P: type, executed_quantity, order_book, execution_price, stock_code
+// plus an optional "timestamp" (nanoseconds since the epoch) on any shape.
+// Lines are flat objects of string values in any key order. Anything else
+// (whitespace, escapes, non-string values, missing fields, numbers that do
+// not fit) goes through jsoncpp, which also classifies lines that cannot be
+// used. Neither path throws.
+class TickParser {
+public:
+    TickParser() : jsonReader(Json::CharReaderBuilder().newCharReader()) {}
+
+    ParseStatus parse(std::string_view line, Tick& tick) {
+        ParseStatus status = parseFast(line, tick) ? ParseStatus::Ok : parseWithJsoncpp(line, tick);
+        if (status == ParseStatus::Ok && tick.type != 'A' && tick.type != 'E' && tick.type != 'P') {
+            return ParseStatus::UnknownType;
+        }
+        return status;
+    }
+
+    bool parseFast(std::string_view line, Tick& tick) const {
+        const char* p = line.data();
+        const char* end = p + line.size();
+        std::string_view quantity;
+        std::string_view price;
+        std::string_view executedQuantity;
+        std::string_view executionPrice;
+        std::string_view type;
+        std::string_view timestamp;
+
+        tick = Tick{};
+        if (p == end || *p++ != '{') {
+            return false;
+        }
+
+        while (true) {
+            std::string_view key;
+            std::string_view value;
+            if (!readString(p, end, key) || p == end || *p++ != ':' || !readString(p, end, value)) {
+                return false;
+            }
+
+            switch (key.size()) {
+                case 4:
+                    if (key == "type") type = value;
+                    break;
+                case 5:
+                    if (key == "price") price = value;
+                    break;
+                case 8:
+                    if (key == "quantity") quantity = value;
+                    break;
+                case 9:
+                    if (key == "timestamp") timestamp = value;
+                    break;
+                case 10:
+                    if (key == "stock_code") tick.stockCode = value;
+                    break;
+                case 12:
+                    if (key == "order_number") tick.orderNumber = value;
+                    break;
+                case 15:
+                    if (key == "execution_price") executionPrice = value;
+                    break;
+                case 17:
+                    if (key == "executed_quantity") executedQuantity = value;
+                    break;
+            }
+
+            if (p == end) {
+                return false;
+            }
+            char separator = *p++;
+            if (separator == '}') {
+                break;
+            }
+            if (separator != ',') {
+                return false;
+            }
+        }
+
+        if (p != end || type.empty() || tick.stockCode.data() == nullptr) {
+            return false;
+        }
+
+        if (timestamp.data() != nullptr && !parseDigits(timestamp, end, tick.eventTime)) {
+            return false;
+        }
+
+        tick.type = type[0];
+        if (tick.type == 'A') {
+            return parseQuantity(quantity, end, tick.quantity) && parsePrice(price, end, tick.price);
+        }
+        if (tick.type == 'E' || tick.type == 'P') {
+            return parseQuantity(executedQuantity, end, tick.quantity) && parsePrice(executionPrice, end, tick.price);
+        }
+        return true;
+    }
+
+    // The original jsoncpp path, with from_chars in place of stoi/stod so a
+    // malformed number is reported instead of thrown.
+    ParseStatus parseWithJsoncpp(std::string_view line, Tick& tick) {
+        Json::Value jsonData;
+        tick = Tick{};
+        ++fallbacks;
+        if (!jsonReader->parse(line.data(), line.data() + line.size(), &jsonData, nullptr) || !jsonData.isObject() ||
+            !readMember(jsonData, "type", fallbackType) || fallbackType.empty() ||
+            !readMember(jsonData, "stock_code", fallbackStockCode)) {
+            return ParseStatus::BadJson;
+        }
+        readMember(jsonData, "order_number", fallbackOrderNumber);
+
+        tick.type = fallbackType[0];
+        ParseStatus status = ParseStatus::Ok;
+        if (tick.type == 'A') {
+            status = readNumber(jsonData, "quantity", tick.quantity, status);
+            status = readNumber(jsonData, "price", tick.price, status);
+        } else if (tick.type == 'E' || tick.type == 'P') {
+            status = readNumber(jsonData, "executed_quantity", tick.quantity, status);
+            status = readNumber(jsonData, "execution_price", tick.price, status);
+        }
+        if (jsonData.isMember("timestamp")) {
+            status = readNumber(jsonData, "timestamp", tick.eventTime, status);
+        }
+
+        tick.stockCode = fallbackStockCode;
+        tick.orderNumber = fallbackOrderNumber;
+        return status;
+    }
+
+    size_t fallbackCount() const {
+        return fallbacks;
+    }
+
+private:
+    static constexpr uint64_t repeatByte(unsigned char byte) {
+        return 0x0101010101010101ULL * byte;
+    }
+
+    static uint64_t loadWord(const char* p) {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        return word;
+    }
+
+    // High bit set in every byte of word that equals byte (exact for the
+    // lowest match, which is the only one used).
+    static uint64_t matchByte(uint64_t word, unsigned char byte) {
+        uint64_t x = word ^ repeatByte(byte);
+        return (x - repeatByte(0x01)) & ~x & repeatByte(0x80);
+    }
+
+    // Reads a "..." string without escapes, eight bytes at a time.
+    static bool readString(const char*& p, const char* end, std::string_view& out) {
+        if (p == end || *p != '"') {
+            return false;
+        }
+        const char* begin = ++p;
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        while (end - p >= 8) {
+            uint64_t word = loadWord(p);
+            uint64_t hits = matchByte(word, '"') | matchByte(word, '\\');
+            if (hits != 0) {
+                p += __builtin_ctzll(hits) / 8;
+                break;
+            }
+            p += 8;
+        }
+#endif
+        while (p != end && *p != '"' && *p != '\\') {
+            ++p;
+        }
+        if (p == end || *p != '"') {
+            return false;
+        }
+
+        out = std::string_view(begin, p - begin);
+        ++p;
+        return true;
+    }
+
+    // Converts up to eight ASCII digits with SWAR multiplies; the caller
+    // guarantees eight readable bytes at digits.data().
+    static bool parseEightDigits(std::string_view digits, uint64_t& result) {
+        const unsigned shift = 8 * (8 - digits.size());
+        uint64_t word = loadWord(digits.data());
+        if (shift != 0) {
+            word = (word << shift) | (repeatByte('0') >> (64 - shift));
+        }
+
+        if (((word & repeatByte(0xF0)) | (((word + repeatByte(0x06)) & repeatByte(0xF0)) >> 4)) != repeatByte(0x33)) {
+            return false;
+        }
+
+        word = ((word & repeatByte(0x0F)) * 2561) >> 8;
+        word = ((word & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+        word = ((word & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+        result = word;
+        return true;
+    }
+
+    // Every value is followed by at least its closing quote and the '}', so
+    // short values can usually be loaded as one word without leaving the line.
+    static bool parseDigits(std::string_view digits, const char* end, uint64_t& result) {
+        if (digits.empty() || digits.size() > 19) {
+            return false;
+        }
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        if (digits.size() <= 8 && end - digits.data() >= 8) {
+            return parseEightDigits(digits, result);
+        }
+#endif
+        result = 0;
+        for (char c : digits) {
+            if (c < '0' || c > '9') {
+                return false;
+            }
+            result = result * 10 + static_cast<uint64_t>(c - '0');
+        }
+        return true;
+    }
+
+    static bool parseQuantity(std::string_view text, const char* end, int& quantity) {
+        uint64_t value;
+        if (!parseDigits(text, end, value) || value > static_cast<uint64_t>(INT_MAX)) {
+            return false;
+        }
+        quantity = static_cast<int>(value);
+        return true;
+    }
+
+    static bool parsePrice(std::string_view text, const char* end, double& price) {
+        uint64_t value;
+        if (parseDigits(text, end, value)) {
+            price = static_cast<double>(value);
+            return true;
+        }
+
+        // Decimal prices: digits '.' digits, same rounding as std::stod.
+        size_t dot = text.find('.');
+        if (dot == std::string_view::npos || dot == 0 || dot + 1 == text.size() ||
+            !parseDigits(text.substr(0, dot), end, value) || !parseDigits(text.substr(dot + 1), end, value)) {
+            return false;
+        }
+        auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), price);
+        return ec == std::errc() && ptr == text.data() + text.size();
+    }
+
+    // Scalar members only; asString() throws on arrays and objects.
+    static bool readMember(const Json::Value& object, const char* key, std::string& out) {
+        const Json::Value& value = object[key];
+        if (value.isNull() || !value.isConvertibleTo(Json::stringValue)) {
+            return false;
+        }
+        out = value.asString();
+        return true;
+    }
+
+    // Keeps the first error seen on the line.
+    template <typename T>
+    ParseStatus readNumber(const Json::Value& object, const char* key, T& out, ParseStatus status) {
+        if (status != ParseStatus::Ok) {
+            return status;
+        }
+        if (!readMember(object, key, numberText)) {
+            return ParseStatus::BadJson;
+        }
+        auto [ptr, ec] = std::from_chars(numberText.data(), numberText.data() + numberText.size(), out);
+        if (ec == std::errc::result_out_of_range) {
+            return ParseStatus::NumericOverflow;
+        }
+        return ec == std::errc() && ptr == numberText.data() + numberText.size() ? ParseStatus::Ok : ParseStatus::BadJson;
+    }
+
+    std::unique_ptr<Json::CharReader> jsonReader;
+    std::string fallbackType;
+    std::string numberText;
+    std::string fallbackStockCode;
+    std::string fallbackOrderNumber;
+    size_t fallbacks = 0;
+};
+
+#endif // TICK_PARSER_H
@@ -0,0 +1,88 @@
+#ifndef WRITE_BATCHER_H
+#define WRITE_BATCHER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Gathers items added from any thread into batches and hands each batch to
+// flush, on the adding thread once maxBatch items are waiting, or on the
+// batcher's own thread once the oldest waiting item is maxDelay old. Batches
+// are handed over in the order they closed, each with its items in the order
+// they were added; flush must not block for long, since adders wait on it.
+template <typename Item>
+class WriteBatcher {
+public:
+    using Flush = std::function<void(std::vector<Item>)>;
+
+    WriteBatcher(size_t maxBatch, std::chrono::microseconds maxDelay, Flush flush)
+        : maxBatch(maxBatch), maxDelay(maxDelay), flush(std::move(flush)), timer([this]() { run(); }) {}
+
+    ~WriteBatcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_one();
+        timer.join();
+    }
+
+    WriteBatcher(const WriteBatcher&) = delete;
+    WriteBatcher& operator=(const WriteBatcher&) = delete;
+
+    void add(Item item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (waiting.empty()) {
+            oldest = std::chrono::steady_clock::now();
+            wake.notify_one();
+        }
+        waiting.push_back(std::move(item));
+        if (waiting.size() >= maxBatch) {
+            closeBatch(lock);
+        }
+    }
+
+private:
+    // Hands over what is waiting. The lock is held while flush runs so that
+    // batches cannot overtake one another.
+    void closeBatch(std::unique_lock<std::mutex>&) {
+        std::vector<Item> batch;
+        batch.swap(waiting);
+        flush(std::move(batch));
+    }
+
+    // Items still waiting at shutdown are flushed before the thread exits.
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopping) {
+            if (waiting.empty()) {
+                wake.wait(lock, [this]() { return stopping || !waiting.empty(); });
+                continue;
+            }
+            auto deadline = oldest + maxDelay;
+            if (std::chrono::steady_clock::now() < deadline) {
+                wake.wait_until(lock, deadline);
+                continue;
+            }
+            closeBatch(lock);
+        }
+        if (!waiting.empty()) {
+            closeBatch(lock);
+        }
+    }
+
+    size_t maxBatch;
+    std::chrono::microseconds maxDelay;
+    Flush flush;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::vector<Item> waiting;
+    std::chrono::steady_clock::time_point oldest;
+    bool stopping = false;
+    std::thread timer;
+};
+
+#endif // WRITE_BATCHER_H